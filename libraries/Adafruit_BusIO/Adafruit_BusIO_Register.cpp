@@ -118,6 +118,9 @@ Adafruit_BusIO_Register::Adafruit_BusIO_Register(
 bool Adafruit_BusIO_Register::write(uint8_t *buffer, uint8_t len) {
   uint8_t addrbuffer[2] = {(uint8_t)(_address & 0xFF),
                            (uint8_t)(_address >> 8)};
+  // raw writes bypass the shadow, so it no longer matches the device
+  _valid = false;
+  _dirty = false;
   if (_i2cdevice) {
     return _i2cdevice->write(buffer, len, true, addrbuffer, _addrwidth);
   }
@@ -166,6 +169,19 @@ bool Adafruit_BusIO_Register::write(uint32_t value, uint8_t numbytes) {
     return false;
   }
 
+  if (_shadow && (numbytes == _width)) {
+    if (_writeback) {
+      // defer the bus transaction until flush()
+      _cached = value;
+      _valid = true;
+      _dirty = true;
+      return true;
+    }
+    if (_valid && !_dirty && (_cached == value)) {
+      return true; // device already has this value
+    }
+  }
+
   // store a copy
   _cached = value;
 
@@ -177,7 +193,11 @@ bool Adafruit_BusIO_Register::write(uint32_t value, uint8_t numbytes) {
     }
     value >>= 8;
   }
-  return write(_buffer, numbytes);
+  if (!write(_buffer, numbytes)) {
+    return false;
+  }
+  _valid = _shadow && (numbytes == _width);
+  return true;
 }
 
 /*!
@@ -186,24 +206,118 @@ bool Adafruit_BusIO_Register::write(uint32_t value, uint8_t numbytes) {
  *    @return Returns 0xFFFFFFFF on failure, value otherwise
  */
 uint32_t Adafruit_BusIO_Register::read(void) {
+  if (_shadow && _valid) {
+    return _cached;
+  }
   if (!read(_buffer, _width)) {
     return -1;
   }
 
+  uint32_t value = decode(_buffer);
+  if (_shadow) {
+    _cached = value;
+    _valid = true;
+  }
+  return value;
+}
+
+/*!
+ *    @brief  Convert register data to a value using this register's width
+ * and byte order
+ *    @param  buffer Pointer to _width bytes of register data
+ *    @return The value
+ */
+uint32_t Adafruit_BusIO_Register::decode(const uint8_t *buffer) {
   uint32_t value = 0;
 
   for (int i = 0; i < _width; i++) {
     value <<= 8;
     if (_byteorder == LSBFIRST) {
-      value |= _buffer[_width - i - 1];
+      value |= buffer[_width - i - 1];
     } else {
-      value |= _buffer[i];
+      value |= buffer[i];
     }
   }
 
   return value;
 }
 
+/*!
+ *    @brief  Enable a shadow copy of the register value. Once the value is
+ * known (from a read(), write() or Adafruit_BusIO_RegisterBatch), read()
+ * returns it without a bus transaction, write() skips writing an unchanged
+ * value and Adafruit_BusIO_RegisterBits read-modify-writes only write. Only
+ * use this for registers the device does not change itself, e.g. config
+ * registers.
+ *    @param  enable True to enable the shadow, false to always use the bus
+ *    @param  writeback If true, write() only updates the shadow and marks it
+ * dirty, call flush() to write it to the device. Several bit slices can then
+ * be changed with a single bus write.
+ */
+void Adafruit_BusIO_Register::enableShadow(bool enable, bool writeback) {
+  _shadow = enable;
+  _writeback = enable && writeback;
+  if (!enable) {
+    _valid = false;
+    _dirty = false;
+  }
+}
+
+/*!
+ *    @brief  Check for a writeback value not yet written to the device
+ *    @return True if flush() needs to write to the device
+ */
+bool Adafruit_BusIO_Register::isDirty(void) { return _dirty; }
+
+/*!
+ *    @brief  Write a dirty shadow value to the device
+ *    @return True if nothing to write or the write was successful
+ */
+bool Adafruit_BusIO_Register::flush(void) {
+  if (!_dirty) {
+    return true;
+  }
+  uint32_t value = _cached;
+  for (int i = 0; i < _width; i++) {
+    if (_byteorder == LSBFIRST) {
+      _buffer[i] = value & 0xFF;
+    } else {
+      _buffer[_width - i - 1] = value & 0xFF;
+    }
+    value >>= 8;
+  }
+  if (!write(_buffer, _width)) {
+    _dirty = true; // keep it for the next flush()
+    _valid = true;
+    return false;
+  }
+  _valid = true;
+  return true;
+}
+
+/*!
+ *    @brief  Forget the shadow value (and any unflushed writeback value), the
+ * next read() uses the bus
+ */
+void Adafruit_BusIO_Register::invalidate(void) {
+  _valid = false;
+  _dirty = false;
+}
+
+/*!
+ *    @brief  Check if another register is on the same device
+ *    @param  other The register to compare with
+ *    @return True if both registers use the same bus device and address width
+ */
+bool Adafruit_BusIO_Register::sameBus(
+    const Adafruit_BusIO_Register *other) const {
+  return (_i2cdevice == other->_i2cdevice) &&
+         (_spidevice == other->_spidevice) &&
+         (_genericdevice == other->_genericdevice) &&
+         (_spiregtype == other->_spiregtype) &&
+         (_addrwidth == other->_addrwidth);
+}
+
 /*!
  *    @brief  Read cached data from last time we wrote to this register
  *    @return Returns 0xFFFFFFFF on failure, value otherwise
@@ -381,4 +495,94 @@ void Adafruit_BusIO_Register::setAddressWidth(uint16_t address_width) {
   _addrwidth = address_width;
 }
 
+/*!
+ *    @brief  Create an empty batch of registers
+ */
+Adafruit_BusIO_RegisterBatch::Adafruit_BusIO_RegisterBatch(void) {
+  _count = 0;
+  _transactions = 0;
+}
+
+/*!
+ *    @brief  Add a register to be read by read()
+ *    @param  reg The register, 1 to 4 bytes wide
+ *    @return False if the batch is full or the register is too wide
+ */
+bool Adafruit_BusIO_RegisterBatch::add(Adafruit_BusIO_Register *reg) {
+  if ((_count >= BUSIO_BATCH_MAX_REGISTERS) || (reg->_width == 0) ||
+      (reg->_width > 4)) {
+    return false;
+  }
+  // keep sorted by address so contiguous registers are next to each other
+  uint8_t i = _count;
+  while ((i > 0) && (_registers[i - 1]->_address > reg->_address)) {
+    _registers[i] = _registers[i - 1];
+    i--;
+  }
+  _registers[i] = reg;
+  _count++;
+  return true;
+}
+
+/*!
+ *    @brief  Remove all registers from the batch
+ */
+void Adafruit_BusIO_RegisterBatch::clear(void) {
+  _count = 0;
+  _transactions = 0;
+}
+
+/*!
+ *    @brief  Read all the registers, one bus transaction per run of
+ * contiguous addresses on the same device
+ *    @return True if all the reads were successful
+ */
+bool Adafruit_BusIO_RegisterBatch::read(void) {
+  uint8_t buffer[BUSIO_BATCH_BUFFER_SIZE];
+  bool ok = true;
+  _transactions = 0;
+
+  uint8_t i = 0;
+  while (i < _count) {
+    Adafruit_BusIO_Register *first = _registers[i];
+    size_t max_len = sizeof(buffer);
+    if (first->_i2cdevice && (first->_i2cdevice->maxBufferSize() < max_len)) {
+      max_len = first->_i2cdevice->maxBufferSize();
+    }
+    size_t len = first->_width;
+    uint8_t j = i + 1;
+    while ((j < _count) && first->sameBus(_registers[j]) &&
+           (_registers[j]->_address == (first->_address + len)) &&
+           ((len + _registers[j]->_width) <= max_len)) {
+      len += _registers[j]->_width;
+      j++;
+    }
+
+    _transactions++;
+    if (first->read(buffer, len)) {
+      size_t offset = 0;
+      for (uint8_t k = i; k < j; k++) {
+        Adafruit_BusIO_Register *reg = _registers[k];
+        if (!reg->_dirty) { // don't lose an unflushed writeback value
+          reg->_cached = reg->decode(buffer + offset);
+          reg->_valid = reg->_shadow;
+        }
+        offset += reg->_width;
+      }
+    } else {
+      ok = false;
+    }
+    i = j;
+  }
+  return ok;
+}
+
+/*!
+ *    @brief  The number of bus transactions used by the last read()
+ *    @return Transaction count
+ */
+uint8_t Adafruit_BusIO_RegisterBatch::transactions(void) {
+  return _transactions;
+}
+
 #endif // SPI exists
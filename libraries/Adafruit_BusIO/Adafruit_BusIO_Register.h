@@ -37,6 +37,15 @@ typedef enum _Adafruit_BusIO_SPIRegType {
 
 } Adafruit_BusIO_SPIRegType;
 
+#ifndef BUSIO_BATCH_MAX_REGISTERS
+#define BUSIO_BATCH_MAX_REGISTERS                                              \
+  8 ///< Max number of registers in one Adafruit_BusIO_RegisterBatch
+#endif
+#ifndef BUSIO_BATCH_BUFFER_SIZE
+#define BUSIO_BATCH_BUFFER_SIZE                                                \
+  32 ///< Max bytes read in one burst, also limited by I2C maxBufferSize()
+#endif
+
 /*!
  * @brief The class which defines a device register (a location to read/write
  * data from)
@@ -73,6 +82,11 @@ public:
 
   uint8_t width(void);
 
+  void enableShadow(bool enable = true, bool writeback = false);
+  bool isDirty(void);
+  bool flush(void);
+  void invalidate(void);
+
   void setWidth(uint8_t width);
   void setAddress(uint16_t address);
   void setAddressWidth(uint16_t address_width);
@@ -86,15 +100,44 @@ public:
 #endif
 
 private:
+  friend class Adafruit_BusIO_RegisterBatch;
+  uint32_t decode(const uint8_t *buffer);
+  bool sameBus(const Adafruit_BusIO_Register *other) const;
+
   Adafruit_I2CDevice *_i2cdevice;
   Adafruit_SPIDevice *_spidevice;
-  Adafruit_GenericDevice *_genericdevice;
-  Adafruit_BusIO_SPIRegType _spiregtype;
+  Adafruit_GenericDevice *_genericdevice = nullptr;
+  Adafruit_BusIO_SPIRegType _spiregtype = ADDRBIT8_HIGH_TOREAD;
   uint16_t _address;
   uint8_t _width, _addrwidth, _byteorder;
   uint8_t _buffer[4]; // we won't support anything larger than uint32 for
                       // non-buffered read
   uint32_t _cached = 0;
+  bool _shadow = false;    // read() returns _cached once it is valid
+  bool _writeback = false; // write() only updates _cached until flush()
+  bool _valid = false;     // _cached matches the device (or is newer if dirty)
+  bool _dirty = false;     // _cached has not been written to the device yet
+};
+
+/*!
+ * @brief Reads several registers of one device with as few bus transactions
+ * as possible. Registers at contiguous addresses are read in one burst of up
+ * to BUSIO_BATCH_BUFFER_SIZE bytes (and the I2C maxBufferSize()), the device
+ * must auto-increment the register address. The values are then available
+ * from each register's readCached(), or read() if its shadow is enabled.
+ */
+class Adafruit_BusIO_RegisterBatch {
+public:
+  Adafruit_BusIO_RegisterBatch(void);
+  bool add(Adafruit_BusIO_Register *reg);
+  void clear(void);
+  bool read(void);
+  uint8_t transactions(void);
+
+private:
+  Adafruit_BusIO_Register *_registers[BUSIO_BATCH_MAX_REGISTERS];
+  uint8_t _count;
+  uint8_t _transactions;
 };
 
 /*!
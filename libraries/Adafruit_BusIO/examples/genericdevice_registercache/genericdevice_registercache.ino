@@ -0,0 +1,142 @@
+/*
+   Counts the bus transactions saved by register shadows and
+   Adafruit_BusIO_RegisterBatch, using a GenericDevice as a mock bus that
+   keeps its registers in RAM. No hardware is needed.
+*/
+
+#include "Adafruit_BusIO_Register.h"
+#include "Adafruit_GenericDevice.h"
+
+class MockRegisterBus {
+public:
+  uint8_t regs[64];
+  uint16_t reads = 0;
+  uint16_t writes = 0;
+
+  static bool bus_read(void *thiz, uint8_t *buffer, size_t len) {
+    (void)thiz;
+    (void)buffer;
+    (void)len;
+    return false;
+  }
+
+  static bool bus_write(void *thiz, const uint8_t *buffer, size_t len) {
+    (void)thiz;
+    (void)buffer;
+    (void)len;
+    return false;
+  }
+
+  // one call == one bus transaction, the address auto-increments
+  static bool bus_readreg(void *thiz, uint8_t *addr_buf, uint8_t addrsiz,
+                          uint8_t *data, uint16_t datalen) {
+    MockRegisterBus *bus = (MockRegisterBus *)thiz;
+    (void)addrsiz;
+    bus->reads++;
+    for (uint16_t i = 0; i < datalen; i++) {
+      data[i] = bus->regs[(addr_buf[0] + i) % sizeof(bus->regs)];
+    }
+    return true;
+  }
+
+  static bool bus_writereg(void *thiz, uint8_t *addr_buf, uint8_t addrsiz,
+                           const uint8_t *data, uint16_t datalen) {
+    MockRegisterBus *bus = (MockRegisterBus *)thiz;
+    (void)addrsiz;
+    bus->writes++;
+    for (uint16_t i = 0; i < datalen; i++) {
+      bus->regs[(addr_buf[0] + i) % sizeof(bus->regs)] = data[i];
+    }
+    return true;
+  }
+
+  void reset(void) { reads = writes = 0; }
+};
+
+MockRegisterBus bus;
+Adafruit_GenericDevice dev(&bus, MockRegisterBus::bus_read,
+                           MockRegisterBus::bus_write,
+                           MockRegisterBus::bus_readreg,
+                           MockRegisterBus::bus_writereg);
+
+void report(const char *what, uint16_t expectReads, uint16_t expectWrites) {
+  Serial.print(what);
+  Serial.print(" reads:");
+  Serial.print(bus.reads);
+  Serial.print(" writes:");
+  Serial.print(bus.writes);
+  bool pass = (bus.reads == expectReads) && (bus.writes == expectWrites);
+  Serial.println(pass ? " PASS" : " FAIL");
+  bus.reset();
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) {
+    delay(10);
+  }
+  Serial.println("Register shadow and batch transaction test");
+  dev.begin();
+  for (uint8_t i = 0; i < sizeof(bus.regs); i++) {
+    bus.regs[i] = i;
+  }
+
+  // 3 bit slices of one config register, without a shadow each write is a
+  // read-modify-write
+  Adafruit_BusIO_Register config(&dev, 0x10);
+  Adafruit_BusIO_RegisterBits mode(&config, 2, 0);
+  Adafruit_BusIO_RegisterBits rate(&config, 3, 2);
+  Adafruit_BusIO_RegisterBits enable(&config, 1, 7);
+  mode.write(1);
+  rate.write(5);
+  enable.write(1);
+  report("no shadow        ", 3, 3);
+
+  config.enableShadow();
+  config.invalidate();
+  mode.write(2);
+  rate.write(3);
+  enable.write(1);
+  enable.write(1); // unchanged, not written
+  report("shadow           ", 1, 2);
+
+  config.enableShadow(true, true); // writeback
+  mode.write(3);
+  rate.write(6);
+  enable.write(0);
+  config.flush();
+  report("shadow writeback ", 0, 1);
+  Serial.print("config = 0x");
+  Serial.println(bus.regs[0x10], HEX);
+
+  // 6 data registers, polled one at a time and then as a batch
+  Adafruit_BusIO_Register accelX(&dev, 0x20, 2, LSBFIRST);
+  Adafruit_BusIO_Register accelY(&dev, 0x22, 2, LSBFIRST);
+  Adafruit_BusIO_Register accelZ(&dev, 0x24, 2, LSBFIRST);
+  Adafruit_BusIO_Register temp(&dev, 0x26, 2, MSBFIRST);
+  Adafruit_BusIO_Register status(&dev, 0x30);
+  Adafruit_BusIO_Register fifo(&dev, 0x31);
+  Adafruit_BusIO_Register *all[] = {&accelX, &accelY, &accelZ,
+                                    &temp,   &status, &fifo};
+  uint32_t single[6];
+  for (uint8_t i = 0; i < 6; i++) {
+    single[i] = all[i]->read();
+  }
+  report("single reads     ", 6, 0);
+
+  Adafruit_BusIO_RegisterBatch batch;
+  for (uint8_t i = 0; i < 6; i++) {
+    batch.add(all[i]);
+  }
+  batch.read();
+  bool same = true;
+  for (uint8_t i = 0; i < 6; i++) {
+    same = same && (all[i]->readCached() == single[i]);
+  }
+  Serial.print("batch transactions:");
+  Serial.print(batch.transactions());
+  Serial.println(same ? " values match" : " values DIFFER");
+  report("batch read       ", 2, 0);
+}
+
+void loop() {}
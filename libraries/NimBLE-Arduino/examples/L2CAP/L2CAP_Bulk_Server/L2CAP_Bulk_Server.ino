@@ -0,0 +1,82 @@
+/**
+ *  L2CAP_Bulk_Server Demo:
+ *
+ *  Receives bulk transfers, e.g. a firmware image or a log dump, over an L2CAP channel and prints the
+ *  transfer rate. A client sends with:
+ *
+ *      NimBLEL2CAPBulkTransfer bulk(L2CAP_PSM, &callbacks);
+ *      bulk.connect(pClient);
+ *      bulk.send(transferId, data, size); // call connect() and send() again to resume after a disconnect
+ */
+
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+
+#define SERVICE_UUID "dcbc7255-1e9e-49a0-a360-b0430b6c6905"
+#define L2CAP_PSM    0x0081
+#define L2CAP_MTU    2048
+
+class GATTCallbacks : public NimBLEServerCallbacks {
+    void onConnect(NimBLEServer* pServer, NimBLEConnInfo& info) override {
+        /** Longer link layer packets and a short interval give the channel more bandwidth. */
+        pServer->setDataLen(info.getConnHandle(), 251);
+        pServer->updateConnParams(info.getConnHandle(), 12, 12, 0, 200);
+    }
+
+    void onDisconnect(NimBLEServer* pServer, NimBLEConnInfo& info, int reason) override {
+        NimBLEDevice::startAdvertising();
+    }
+} gattCallbacks;
+
+/** Called from the NimBLE task, keep the work short, e.g. hand the blocks to a flash writer task. */
+class BulkCallbacks : public NimBLEL2CAPBulkTransferCallbacks {
+    uint32_t onBegin(NimBLEL2CAPBulkTransfer* transfer, uint32_t id, uint32_t size, uint32_t offset) override {
+        Serial.printf("Transfer %" PRIu32 ": %" PRIu32 " bytes, continuing at %" PRIu32 "\n", id, size, offset);
+        return offset;
+    }
+
+    void onData(NimBLEL2CAPBulkTransfer* transfer, uint32_t id, uint32_t offset, const uint8_t* data, size_t length) override {
+        // Store the block at offset here.
+    }
+
+    void onComplete(NimBLEL2CAPBulkTransfer* transfer, uint32_t id, const NimBLEL2CAPBulkStats& stats) override {
+        Serial.printf("Transfer %" PRIu32 " complete: %" PRIu32 " bytes in %" PRIu32 " ms, %" PRIu32
+                      " KB/s, %" PRIu32 " CRC errors\n",
+                      id,
+                      stats.bytes,
+                      stats.elapsedMs,
+                      stats.getBytesPerSecond() / 1024,
+                      stats.crcErrors);
+    }
+
+    void onDisconnect(NimBLEL2CAPBulkTransfer* transfer) override {
+        Serial.printf("Channel closed, the transfer resumes when the client sends it again\n");
+    }
+} bulkCallbacks;
+
+NimBLEL2CAPBulkTransfer bulk(L2CAP_PSM, &bulkCallbacks, L2CAP_MTU);
+
+void setup() {
+    Serial.begin(115200);
+    Serial.println("Starting L2CAP bulk transfer server");
+
+    NimBLEDevice::init("L2CAP-Bulk");
+    NimBLEDevice::setMTU(BLE_ATT_MTU_MAX);
+
+    bulk.listen();
+
+    auto server = NimBLEDevice::createServer();
+    server->setCallbacks(&gattCallbacks);
+    auto service = server->createService(SERVICE_UUID);
+    service->start();
+
+    auto advertising = NimBLEDevice::getAdvertising();
+    advertising->addServiceUUID(SERVICE_UUID);
+    advertising->enableScanResponse(true);
+    NimBLEDevice::startAdvertising();
+    Serial.println("Waiting for transfers");
+}
+
+void loop() {
+    delay(1000);
+}
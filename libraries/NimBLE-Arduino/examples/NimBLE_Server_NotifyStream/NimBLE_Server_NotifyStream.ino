@@ -0,0 +1,103 @@
+
+/**
+ *  NimBLE_Server_NotifyStream Demo:
+ *
+ *  Streams 1kHz sensor samples to a subscribed client, packed into MTU sized notifications.
+ *  Throughput counters are printed every 5 seconds.
+ */
+
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+
+/** A sample as it is sent to the client, packed so the client can decode it without padding. */
+struct __attribute__((packed)) Sample {
+    uint32_t timestamp;
+    int16_t  x, y, z;
+};
+
+static NimBLECharacteristic* pSampleCharacteristic;
+static NimBLENotifyStream*   pStream;
+static volatile uint16_t     subscribedHandle = BLE_HS_CONN_HANDLE_NONE;
+static uint32_t              lastSampleUs;
+static uint32_t              lastPrintMs;
+
+class ServerCallbacks : public NimBLEServerCallbacks {
+    void onConnect(NimBLEServer* pServer, NimBLEConnInfo& connInfo) override {
+        /** Ask for the shortest connection interval so more notifications are sent per second. */
+        pServer->updateConnParams(connInfo.getConnHandle(), 6, 12, 0, 200);
+    }
+
+    void onDisconnect(NimBLEServer* pServer, NimBLEConnInfo& connInfo, int reason) override {
+        subscribedHandle = BLE_HS_CONN_HANDLE_NONE;
+        NimBLEDevice::startAdvertising();
+    }
+} serverCallbacks;
+
+class CharacteristicCallbacks : public NimBLECharacteristicCallbacks {
+    /** Called from the NimBLE task, the stream itself is only used from loop(). */
+    void onSubscribe(NimBLECharacteristic* pCharacteristic, NimBLEConnInfo& connInfo, uint16_t subValue) override {
+        subscribedHandle = (subValue & 1) ? connInfo.getConnHandle() : BLE_HS_CONN_HANDLE_NONE;
+    }
+} chrCallbacks;
+
+void setup() {
+    Serial.begin(115200);
+    Serial.printf("Starting NimBLE Notify Stream Server\n");
+
+    NimBLEDevice::init("NimBLE-Stream");
+    NimBLEDevice::setMTU(247);
+
+    NimBLEServer* pServer = NimBLEDevice::createServer();
+    pServer->setCallbacks(&serverCallbacks);
+
+    NimBLEService* pService = pServer->createService("5AFE");
+    pSampleCharacteristic   = pService->createCharacteristic("5A4D", NIMBLE_PROPERTY::NOTIFY);
+    pSampleCharacteristic->setCallbacks(&chrCallbacks);
+    pService->start();
+
+    NimBLEAdvertising* pAdvertising = NimBLEDevice::getAdvertising();
+    pAdvertising->setName("NimBLE-Stream");
+    pAdvertising->addServiceUUID(pService->getUUID());
+    pAdvertising->start();
+
+    Serial.printf("Advertising Started\n");
+}
+
+void loop() {
+    uint16_t connHandle = subscribedHandle;
+    if (pStream != nullptr && pStream->getConnHandle() != connHandle) {
+        delete pStream;
+        pStream = nullptr;
+    }
+
+    if (pStream == nullptr && connHandle != BLE_HS_CONN_HANDLE_NONE) {
+        pStream = new NimBLENotifyStream(pSampleCharacteristic, connHandle);
+    }
+
+    uint32_t now = micros();
+    if (pStream == nullptr || now - lastSampleUs < 1000) {
+        return;
+    }
+
+    lastSampleUs = now;
+
+    /** Replace with a real sensor reading, a rejected sample means the link can't keep up and it is dropped. */
+    Sample sample{now, static_cast<int16_t>(now & 0xfff), static_cast<int16_t>(-1), 0};
+    pStream->write(sample);
+
+    if (millis() - lastPrintMs >= 5000) {
+        lastPrintMs                        = millis();
+        const NimBLENotifyStreamStats& st  = pStream->getStats();
+        uint32_t                       bps = st.elapsedMs ? static_cast<uint32_t>(uint64_t(st.bytes) * 1000 / st.elapsedMs) : 0;
+        Serial.printf("payload: %u, samples: %" PRIu32 ", notifications: %" PRIu32 ", dropped: %" PRIu32
+                      ", stalls: %" PRIu32 ", errors: %" PRIu32 ", %" PRIu32 " bytes/s\n",
+                      pStream->getPayloadSize(),
+                      st.samples,
+                      st.notifications,
+                      st.dropped,
+                      st.stalls,
+                      st.errors,
+                      bps);
+        pStream->resetStats();
+    }
+}
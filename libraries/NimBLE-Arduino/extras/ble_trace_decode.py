@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+#
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+"""Decodes the NimBLE trace ring into per event latency histograms.
+
+Takes either the output of os_trace_ring_dump() or a copy of g_os_trace_ring
+made with a debugger, e.g. with gdb:
+
+    dump binary value ring.bin g_os_trace_ring
+
+Build with CONFIG_BT_NIMBLE_TRACE_RING_SIZE set to a power of 2 to enable the
+ring, see src/nimble/porting/nimble/include/os/os_trace_ring.h for the record
+layout.
+"""
+
+import argparse
+import csv
+import struct
+import sys
+
+HDR = struct.Struct('<IHHII')
+REC = struct.Struct('<IBBHII')
+MAGIC = 0x5254424e
+
+ID_LOST = 1
+ID_MEMPOOL_EMPTY = 2
+ID_LL = 0x20
+ID_HS = 0x40
+
+ID_LL_SCHED = ID_LL + 0
+ID_LL_SCHED_INSERT = ID_LL + 14
+
+NAMES = {
+    ID_LOST: 'lost',
+    ID_MEMPOOL_EMPTY: 'mempool_empty',
+    ID_LL + 0: 'll_sched',
+    ID_LL + 1: 'll_rx_start',
+    ID_LL + 2: 'll_rx_end',
+    ID_LL + 3: 'll_wfr_timer_exp',
+    ID_LL + 4: 'll_ctrl_rx',
+    ID_LL + 5: 'll_conn_ev_start',
+    ID_LL + 6: 'll_conn_ev_end',
+    ID_LL + 7: 'll_conn_end',
+    ID_LL + 8: 'll_conn_tx',
+    ID_LL + 9: 'll_conn_rx',
+    ID_LL + 10: 'll_adv_txdone',
+    ID_LL + 11: 'll_adv_halt',
+    ID_LL + 12: 'll_aux_ref',
+    ID_LL + 13: 'll_aux_unref',
+    ID_LL + 14: 'll_sched_insert',
+    ID_HS + 0: 'hs_hci_cmd_start',
+    ID_HS + 1: 'hs_hci_cmd_end',
+    ID_HS + 2: 'hs_hci_evt_start',
+    ID_HS + 3: 'hs_hci_evt_end',
+    ID_HS + 4: 'hs_att_rx_start',
+    ID_HS + 5: 'hs_att_rx_end',
+}
+
+# START id: (name of the duration, END id, paired by arg0)
+PAIRS = {
+    ID_LL + 1: ('ll_rx', ID_LL + 2, False),
+    ID_LL + 5: ('ll_conn_ev', ID_LL + 6, True),
+    ID_HS + 0: ('hs_hci_cmd', ID_HS + 1, True),
+    ID_HS + 2: ('hs_hci_evt', ID_HS + 3, True),
+    ID_HS + 4: ('hs_att_rx', ID_HS + 5, True),
+}
+ENDS = {end: (start, keyed) for start, (_, end, keyed) in PAIRS.items()}
+
+
+class Rec(object):
+    __slots__ = ('ts', 'id', 'lap', 'arg0', 'arg1', 'arg2')
+
+    def __init__(self, ts, id, lap, arg0, arg1, arg2):
+        self.ts = ts
+        self.id = id
+        self.lap = lap
+        self.arg0 = arg0
+        self.arg1 = arg1
+        self.arg2 = arg2
+
+
+def s32(v):
+    return v - (1 << 32) if v & 0x80000000 else v
+
+
+def parse(data):
+    if len(data) < HDR.size:
+        raise ValueError('file too short')
+    magic, rec_size, num_recs, ts_freq, head = HDR.unpack_from(data)
+    if magic != MAGIC:
+        raise ValueError('bad magic 0x%08x' % magic)
+    if rec_size != REC.size:
+        raise ValueError('unsupported record size %d' % rec_size)
+    if not ts_freq:
+        raise ValueError('timestamp frequency is 0')
+
+    body = data[HDR.size:]
+    recs = []
+    if num_recs == 0:
+        # Dump, records are oldest first
+        for off in range(0, len(body) - REC.size + 1, REC.size):
+            rec = Rec(*REC.unpack_from(body, off))
+            if rec.id:
+                recs.append(rec)
+        return ts_freq, head, recs
+
+    # Raw copy of the ring, oldest record is the one at head
+    if len(body) < num_recs * REC.size:
+        raise ValueError('ring image has %d of %d records' %
+                         (len(body) // REC.size, num_recs))
+    first = max(head - num_recs, 0)
+    for idx in range(first, head):
+        rec = Rec(*REC.unpack_from(body, (idx % num_recs) * REC.size))
+        # Skip entries reserved but not written when the copy was made
+        if rec.id and rec.lap == (idx // num_recs) % 255 + 1:
+            recs.append(rec)
+    return ts_freq, head, recs
+
+
+class Hist(object):
+    def __init__(self):
+        self.vals = []
+
+    def add(self, us):
+        self.vals.append(us)
+
+    def pct(self, p):
+        vals = sorted(self.vals)
+        return vals[min(len(vals) - 1, int(len(vals) * p / 100))]
+
+    def show(self, name, out):
+        vals = self.vals
+        out.write('%s: n=%d min=%.1f p50=%.1f p90=%.1f p99=%.1f max=%.1f us\n' %
+                  (name, len(vals), min(vals), self.pct(50), self.pct(90),
+                   self.pct(99), max(vals)))
+        buckets = {}
+        for v in vals:
+            b = 0
+            while (1 << b) <= v:
+                b += 1
+            buckets[b] = buckets.get(b, 0) + 1
+        peak = max(buckets.values())
+        for b in sorted(buckets):
+            lo = 0 if b == 0 else 1 << (b - 1)
+            out.write('  %8d - %-8d %7d %s\n' %
+                      (lo, (1 << b) - 1, buckets[b],
+                       '#' * max(1, buckets[b] * 40 // peak)))
+
+
+def decode(ts_freq, recs, csv_out):
+    hists = {}
+    open_starts = {}
+    unmatched = 0
+    lost = 0
+    pools = {}
+    inserts = [0, 0]
+
+    def us(ticks):
+        return ticks * 1000000.0 / ts_freq
+
+    def hist(name):
+        if name not in hists:
+            hists[name] = Hist()
+        return hists[name]
+
+    for rec in recs:
+        if csv_out:
+            csv_out.writerow([rec.ts, NAMES.get(rec.id, '0x%02x' % rec.id),
+                              rec.arg0, rec.arg1, rec.arg2])
+
+        if rec.id == ID_LOST:
+            lost += rec.arg1
+            # Durations spanning the gap are not known
+            open_starts.clear()
+        elif rec.id == ID_MEMPOOL_EMPTY:
+            key = (rec.arg2, rec.arg0, rec.arg1)
+            pools[key] = pools.get(key, 0) + 1
+        elif rec.id == ID_LL_SCHED:
+            # arg1: time the item ran, arg2: time it was scheduled for
+            hist('ll_sched_late').add(us(s32((rec.arg1 - rec.arg2) &
+                                             0xffffffff)))
+        elif rec.id == ID_LL_SCHED_INSERT:
+            inserts[s32(rec.arg2) == 0] += 1
+        elif rec.id in PAIRS:
+            keyed = PAIRS[rec.id][2]
+            open_starts[(rec.id, rec.arg0 if keyed else 0)] = rec.ts
+        elif rec.id in ENDS:
+            start, keyed = ENDS[rec.id]
+            ts = open_starts.pop((start, rec.arg0 if keyed else 0), None)
+            if ts is None:
+                unmatched += 1
+                continue
+            hist(PAIRS[start][0]).add(us((rec.ts - ts) & 0xffffffff))
+
+    out = sys.stdout
+    out.write('%d records, timestamps at %d Hz\n\n' % (len(recs), ts_freq))
+    for name in sorted(hists):
+        hists[name].show(name, out)
+        out.write('\n')
+    if inserts[0] or inserts[1]:
+        out.write('ll_sched_insert: %d scheduled, %d not scheduled\n' %
+                  (inserts[1], inserts[0]))
+    for (pool, size, blocks), cnt in sorted(pools.items()):
+        out.write('mempool 0x%08x (%d x %d bytes) empty %d times\n' %
+                  (pool, blocks, size, cnt))
+    if lost:
+        out.write('%d records lost while reading the ring\n' % lost)
+    if unmatched:
+        out.write('%d end records without a start\n' % unmatched)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('file', help='trace ring dump or image')
+    parser.add_argument('--csv', metavar='FILE',
+                        help='also write all records to a CSV file')
+    args = parser.parse_args()
+
+    with open(args.file, 'rb') as f:
+        data = f.read()
+    try:
+        ts_freq, head, recs = parse(data)
+    except ValueError as e:
+        sys.exit('%s: %s' % (args.file, e))
+
+    csv_file = None
+    csv_out = None
+    if args.csv:
+        csv_file = open(args.csv, 'w', newline='')
+        csv_out = csv.writer(csv_file)
+        csv_out.writerow(['ts', 'id', 'arg0', 'arg1', 'arg2'])
+
+    decode(ts_freq, recs, csv_out)
+
+    if csv_file:
+        csv_file.close()
+
+
+if __name__ == '__main__':
+    main()
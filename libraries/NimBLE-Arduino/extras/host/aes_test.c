@@ -0,0 +1,332 @@
+/*
+ * Host test of the tinycrypt AES-128, CTR and CCM code and of the two CCM
+ * implementations built on it, mesh (aes-ccm.c) and the encrypted advertising
+ * data (ble_aes_ccm.c).
+ *
+ * Checks the FIPS-197 C.1, SP 800-38A F.5.1 and RFC 3610 packet vector #1
+ * known answers, then random messages: multi-block encryption against single
+ * blocks, CTR against a counter built here including 32-bit counter wrap, and
+ * the three CCM implementations against each other with tampered tags. Then
+ * measures ECB and CTR throughput and 20-byte mesh network PDUs per second.
+ */
+
+#include "nimble/ext/tinycrypt/include/tinycrypt/aes.h"
+#include "nimble/ext/tinycrypt/include/tinycrypt/ccm_mode.h"
+#include "nimble/ext/tinycrypt/include/tinycrypt/constants.h"
+#include "nimble/ext/tinycrypt/include/tinycrypt/ctr_mode.h"
+#include "host_test.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* aes-ccm.c, built with BLE_MESH */
+int bt_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t *msg,
+                   size_t msg_len, const uint8_t *aad, size_t aad_len,
+                   uint8_t *out_msg, size_t mic_size);
+int bt_ccm_decrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t *enc_msg,
+                   size_t msg_len, const uint8_t *aad, size_t aad_len,
+                   uint8_t *out_msg, size_t mic_size);
+
+/* ble_aes_ccm.c, built with ENC_ADV_DATA, takes the key byte reversed */
+int ble_aes_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t *msg,
+                        size_t msg_len, const uint8_t *aad, size_t aad_len,
+                        uint8_t *out_msg, size_t mic_size);
+int ble_aes_ccm_decrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t *enc_data,
+                        size_t len, const uint8_t *aad, size_t aad_len,
+                        uint8_t *plaintext, size_t mic_size);
+
+/* Debug logging of aes-ccm.c, lives in mesh glue.c */
+const char *
+bt_hex(const void *buf, size_t len)
+{
+    return "";
+}
+
+/* Keeps the benchmarked output */
+volatile uint8_t bench_sink;
+
+static void
+rand_bytes(uint8_t *buf, int len)
+{
+    while (len--) {
+        *buf++ = rand();
+    }
+}
+
+static void
+reverse_key(uint8_t *dst, const uint8_t *src)
+{
+    int i;
+
+    for (i = 0; i < 16; i++) {
+        dst[i] = src[15 - i];
+    }
+}
+
+static void
+test_known_answers(void)
+{
+    static const uint8_t fips_key[16] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+    };
+    static const uint8_t fips_pt[16] = {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+        0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+    };
+    static const uint8_t fips_ct[16] = {
+        0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+        0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+    };
+    static const uint8_t ctr_key[16] = {
+        0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+        0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+    };
+    static const uint8_t ctr_pt[64] = {
+        0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+        0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+        0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+        0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+        0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+        0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+        0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+        0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+    };
+    static const uint8_t ctr_ct[64] = {
+        0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26,
+        0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+        0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff,
+        0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+        0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e,
+        0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+        0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1,
+        0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee
+    };
+    static const uint8_t ccm_key[16] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+        0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+    };
+    static const uint8_t ccm_nonce[13] = {
+        0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xa0,
+        0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+    };
+    static const uint8_t ccm_aad[8] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07
+    };
+    static const uint8_t ccm_ct[31] = {
+        0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6, 0x63, 0xd2,
+        0xf0, 0x66, 0xd0, 0xc2, 0xc0, 0xf9, 0x89, 0x80,
+        0x6d, 0x5f, 0x6b, 0x61, 0xda, 0xc3, 0x84, 0x17,
+        0xe8, 0xd1, 0x2c, 0xfd, 0xf9, 0x26, 0xe0
+    };
+    struct tc_aes_key_sched_struct sched;
+    struct tc_ccm_mode_struct ccm;
+    uint8_t nonce[13];
+    uint8_t ctr[16];
+    uint8_t key[16];
+    uint8_t pt[23];
+    uint8_t out[64];
+    int i;
+
+    tc_aes128_set_encrypt_key(&sched, fips_key);
+    CHECK(tc_aes_encrypt(out, fips_pt, &sched) == TC_CRYPTO_SUCCESS);
+    CHECK(memcmp(out, fips_ct, 16) == 0);
+
+    /* In place */
+    memcpy(out, fips_pt, 16);
+    CHECK(tc_aes_encrypt(out, out, &sched) == TC_CRYPTO_SUCCESS);
+    CHECK(memcmp(out, fips_ct, 16) == 0);
+
+    for (i = 0; i < 16; i++) {
+        ctr[i] = 0xf0 + i;
+    }
+    tc_aes128_set_encrypt_key(&sched, ctr_key);
+    CHECK(tc_ctr_mode(out, 64, ctr_pt, 64, ctr, &sched) == TC_CRYPTO_SUCCESS);
+    CHECK(memcmp(out, ctr_ct, 64) == 0);
+
+    for (i = 0; i < 23; i++) {
+        pt[i] = 0x08 + i;
+    }
+    memcpy(nonce, ccm_nonce, 13);
+    tc_aes128_set_encrypt_key(&sched, ccm_key);
+    tc_ccm_config(&ccm, &sched, nonce, 13, 8);
+    CHECK(tc_ccm_generation_encryption(out, 31, ccm_aad, 8, pt, 23, &ccm) ==
+          TC_CRYPTO_SUCCESS);
+    CHECK(memcmp(out, ccm_ct, 31) == 0);
+
+    /* Mesh authenticates out_msg, it encrypts in place like net.c */
+    memcpy(out, pt, 23);
+    CHECK(bt_ccm_encrypt(ccm_key, nonce, out, 23, ccm_aad, 8, out, 8) == 0);
+    CHECK(memcmp(out, ccm_ct, 31) == 0);
+
+    memset(out, 0, sizeof out);
+    reverse_key(key, ccm_key);
+    CHECK(ble_aes_ccm_encrypt(key, nonce, pt, 23, ccm_aad, 8, out, 8) == 0);
+    CHECK(memcmp(out, ccm_ct, 31) == 0);
+}
+
+/* Counter mode the way tinycrypt counts, the last 4 bytes big endian */
+static void
+ref_ctr(const struct tc_aes_key_sched_struct *sched, uint8_t ctr[16],
+        const uint8_t *in, uint8_t *out, int len)
+{
+    struct tc_aes_key_sched_struct s = *sched;
+    uint8_t ks[16];
+    int i;
+    int k;
+
+    for (i = 0; i < len; i += 16) {
+        tc_aes_encrypt(ks, ctr, &s);
+        for (k = 15; k >= 12 && ++ctr[k] == 0; k--) {
+        }
+        for (k = 0; k < 16 && i + k < len; k++) {
+            out[i + k] = in[i + k] ^ ks[k];
+        }
+    }
+}
+
+static void
+test_random(void)
+{
+    struct tc_aes_key_sched_struct sched;
+    struct tc_ccm_mode_struct ccm;
+    uint8_t ref[224];
+    uint8_t in[224];
+    uint8_t out[224];
+    uint8_t dec[224];
+    uint8_t mesh[224];
+    uint8_t adv[224];
+    uint8_t ctr1[16];
+    uint8_t ctr2[16];
+    uint8_t nonce[13];
+    uint8_t key[16];
+    uint8_t rkey[16];
+    uint8_t aad[40];
+    int plen;
+    int alen;
+    int mlen;
+    int bad;
+    int it;
+    int i;
+
+    for (it = 0; it < 50000; it++) {
+        rand_bytes(key, 16);
+        rand_bytes(in, sizeof in);
+        rand_bytes(aad, sizeof aad);
+        tc_aes128_set_encrypt_key(&sched, key);
+
+        /* Multi-block encryption, in place, against single blocks */
+        plen = rand() % 13 + 1;
+        for (i = 0; i < plen; i++) {
+            tc_aes_encrypt(ref + i * 16, in + i * 16, &sched);
+        }
+        memcpy(out, in, plen * 16);
+        CHECK(tc_aes_encrypt_blocks(out, out, plen, &sched) == TC_CRYPTO_SUCCESS);
+        CHECK(memcmp(out, ref, plen * 16) == 0);
+
+        /* Counter mode, sometimes across the wrap of the 32-bit counter */
+        rand_bytes(ctr1, 16);
+        if (it % 7 == 0) {
+            memset(ctr1 + 12, 0xff, 3);
+        }
+        memcpy(ctr2, ctr1, 16);
+        plen = rand() % 200 + 1;
+        CHECK(tc_ctr_mode(out, plen, in, plen, ctr1, &sched) == TC_CRYPTO_SUCCESS);
+        ref_ctr(&sched, ctr2, in, ref, plen);
+        CHECK(memcmp(out, ref, plen) == 0);
+        CHECK(memcmp(ctr1, ctr2, 16) == 0);
+
+        /* CCM, tinycrypt against mesh and advertising data */
+        rand_bytes(nonce, 13);
+        plen = rand() % 120 + 1;
+        alen = rand() % 40;
+        mlen = 4 + 2 * (rand() % 7);
+        tc_ccm_config(&ccm, &sched, nonce, 13, mlen);
+        CHECK(tc_ccm_generation_encryption(out, plen + mlen, aad, alen, in,
+                                           plen, &ccm) == TC_CRYPTO_SUCCESS);
+        memcpy(mesh, in, plen);
+        CHECK(bt_ccm_encrypt(key, nonce, mesh, plen, aad, alen, mesh, mlen) == 0);
+        CHECK(memcmp(out, mesh, plen + mlen) == 0);
+        reverse_key(rkey, key);
+        CHECK(ble_aes_ccm_encrypt(rkey, nonce, in, plen, aad, alen, adv, mlen) == 0);
+        CHECK(memcmp(out, adv, plen + mlen) == 0);
+
+        bad = it % 3 == 0;
+        if (bad) {
+            i = rand() % (plen + mlen);
+            out[i] ^= 1 << (rand() % 8);
+            mesh[i] = out[i];
+        }
+        CHECK((tc_ccm_decryption_verification(dec, plen, aad, alen, out,
+                                              plen + mlen, &ccm) ==
+               TC_CRYPTO_SUCCESS) == !bad);
+        CHECK(bt_ccm_decrypt(key, nonce, mesh, plen, aad, alen, dec, mlen) ==
+              (bad ? -EBADMSG : 0));
+        if (!bad) {
+            CHECK(memcmp(dec, in, plen) == 0);
+        }
+
+        /* Does not check the tag */
+        CHECK(ble_aes_ccm_decrypt(rkey, nonce, adv, plen, aad, alen, dec, mlen) == 0);
+        CHECK(memcmp(dec, in, plen) == 0);
+    }
+}
+
+static double
+now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+bench(void)
+{
+    static uint8_t buf[1 << 16];
+    struct tc_aes_key_sched_struct sched;
+    uint8_t key[16] = { 0 };
+    uint8_t nonce[13] = { 0 };
+    uint8_t ctr[16] = { 0 };
+    uint8_t pdu[32] = { 0 };
+    double start;
+    int i;
+
+    tc_aes128_set_encrypt_key(&sched, key);
+
+    start = now_sec();
+    for (i = 0; i < 1000000; i++) {
+        tc_aes_encrypt(buf + (i & 1023) * 16, buf + (i & 1023) * 16, &sched);
+    }
+    printf("aes: ECB %.0f MB/s\n", 16e6 / (now_sec() - start) / 1e6);
+
+    start = now_sec();
+    for (i = 0; i < 200; i++) {
+        tc_ctr_mode(buf, sizeof buf, buf, sizeof buf, ctr, &sched);
+    }
+    printf("aes: CTR %.0f MB/s\n", 200.0 * sizeof buf / (now_sec() - start) / 1e6);
+
+    start = now_sec();
+    for (i = 0; i < 500000; i++) {
+        bt_ccm_encrypt(key, nonce, pdu, 20, NULL, 0, pdu, 4);
+    }
+    printf("aes: mesh CCM %.2fM 20-byte network PDUs/s\n",
+           0.5 / (now_sec() - start));
+
+    bench_sink = buf[0] ^ pdu[0];
+}
+
+int
+main(void)
+{
+    srand(1);
+
+    test_known_answers();
+    test_random();
+    bench();
+
+    return hostTestResult("aes");
+}
@@ -0,0 +1,172 @@
+/*
+ * Host test of the handle index of the ATT server attribute table.
+ *
+ * Checks ble_att_svr_find_by_handle() and ble_att_svr_find_first() against a
+ * walk of the attribute list while ranges are hidden, restored and attributes
+ * are registered after the index was built. Then replays the handle lookups
+ * of a stream of read requests against a 200 attribute table, with the index
+ * and with the list walk the lookups used before.
+ *
+ * Includes ble_att_svr.c to reach its static list and helpers.
+ */
+
+#include "nimble/nimble/host/src/ble_att_svr.c"
+#include "host_test.h"
+
+#include <stdlib.h>
+#include <time.h>
+
+uint16_t ble_hs_max_attrs = 250;
+
+/* Keeps the benchmarked lookups */
+volatile uintptr_t bench_sink;
+
+static int
+access_cb(uint16_t conn_handle, uint16_t attr_handle, uint8_t op,
+          uint16_t offset, struct os_mbuf **om, void *arg)
+{
+    return 0;
+}
+
+static struct ble_att_svr_entry *
+walk_by_handle(uint16_t handle_id)
+{
+    struct ble_att_svr_entry *entry;
+
+    STAILQ_FOREACH(entry, &ble_att_svr_list, ha_next) {
+        if (entry->ha_handle_id == handle_id) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static struct ble_att_svr_entry *
+walk_first(uint16_t handle_id)
+{
+    struct ble_att_svr_entry *entry;
+
+    STAILQ_FOREACH(entry, &ble_att_svr_list, ha_next) {
+        if (entry->ha_handle_id >= handle_id) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static void
+check_table(int max_handle)
+{
+    int i;
+
+    for (i = 0; i <= max_handle + 2; i++) {
+        CHECK(ble_att_svr_find_by_handle(i) == walk_by_handle(i));
+        CHECK(ble_att_svr_find_first(i) == walk_first(i));
+    }
+}
+
+static void
+register_attrs(int cnt)
+{
+    static const ble_uuid16_t uuid = BLE_UUID16_INIT(0x2a00);
+    uint16_t handle_id;
+    int i;
+
+    for (i = 0; i < cnt; i++) {
+        CHECK(ble_att_svr_register(&uuid.u, BLE_ATT_F_READ, 0, &handle_id,
+                                   access_cb, NULL) == 0);
+    }
+}
+
+static void
+test_index(void)
+{
+    ble_att_svr_start();
+
+    register_attrs(150);
+    check_table(150);
+
+    ble_att_svr_build_idx();
+    check_table(150);
+
+    ble_att_svr_hide_range(1, 10);
+    ble_att_svr_hide_range(50, 60);
+    ble_att_svr_hide_range(140, 150);
+    check_table(150);
+    CHECK(ble_att_svr_find_by_handle(55) == NULL);
+
+    /* Not in the index, found by the list walk */
+    register_attrs(20);
+    check_table(170);
+    CHECK(ble_att_svr_find_by_handle(165)->ha_handle_id == 165);
+
+    ble_att_svr_restore_range(140, 150);
+    ble_att_svr_restore_range(1, 10);
+    ble_att_svr_restore_range(50, 60);
+    check_table(170);
+    CHECK(ble_att_svr_find_by_handle(55)->ha_handle_id == 55);
+
+    ble_att_svr_reset();
+    CHECK(ble_att_svr_find_by_handle(5) == NULL);
+}
+
+static double
+now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+bench(void)
+{
+    struct ble_att_svr_entry *(*find[2])(uint16_t) = {
+        ble_att_svr_find_by_handle, walk_by_handle
+    };
+    static const char *name[2] = { "index", "list walk" };
+    enum { NUM_ATTRS = 200, NUM_REQS = 4000000 };
+    uint16_t *handles;
+    uintptr_t sum;
+    double start;
+    int i;
+    int k;
+
+    ble_att_svr_start();
+    register_attrs(NUM_ATTRS);
+    ble_att_svr_build_idx();
+
+    handles = malloc(NUM_REQS * sizeof *handles);
+    for (i = 0; i < NUM_REQS; i++) {
+        handles[i] = rand() % NUM_ATTRS + 1;
+    }
+
+    for (k = 0; k < 2; k++) {
+        sum = 0;
+        start = now_sec();
+        for (i = 0; i < NUM_REQS; i++) {
+            sum += (uintptr_t)find[k](handles[i]);
+        }
+        bench_sink = sum;
+        printf("att_index: %s %.1fM lookups/s, %d attributes\n",
+               name[k], NUM_REQS / (now_sec() - start) / 1e6, NUM_ATTRS);
+    }
+
+    free(handles);
+    ble_att_svr_reset();
+}
+
+int
+main(void)
+{
+    srand(1);
+    CHECK(ble_att_svr_init() == 0);
+
+    test_index();
+    bench();
+
+    return hostTestResult("att_index");
+}
@@ -0,0 +1,301 @@
+/*
+ * Host test of the tinycrypt P-256 code used by LE Secure Connections.
+ *
+ * Checks the NIST CAVS ECDH vector, the Bluetooth debug key pair and the
+ * RFC 6979 ECDSA signature of "sample", then random keys: each public key
+ * from uECC_make_key() and uECC_compute_public_key() is on the curve and its
+ * x matches the product of the generator with the ladder of
+ * uECC_shared_secret(), both sides of an exchange get the same secret, and
+ * signatures verify until a bit of the hash or the signature flips. Then
+ * measures keys, secrets, signatures and verifications per second.
+ *
+ * bin/ecc builds the public keys with the comb table, bin/ecc_ladder with
+ * the ladder (TINYCRYPT_UECC_GEN_COMB), the results must be the same.
+ */
+
+#include "nimble/ext/tinycrypt/include/tinycrypt/constants.h"
+#include "nimble/ext/tinycrypt/include/tinycrypt/ecc.h"
+#include "nimble/ext/tinycrypt/include/tinycrypt/ecc_dh.h"
+#include "nimble/ext/tinycrypt/include/tinycrypt/ecc_dsa.h"
+#include "nimble/porting/nimble/include/syscfg/syscfg.h"
+#include "host_test.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NUM_KEYS        500
+#define BENCH_OPS       500
+
+/* Keeps the benchmarked output */
+volatile uint8_t bench_sink;
+
+/* Repeatable keys and nonces */
+static int
+test_rng(uint8_t *dest, unsigned int size)
+{
+    while (size--) {
+        *dest++ = rand();
+    }
+    return 1;
+}
+
+/* Generator, the secret of the ladder with it is the x of the public key */
+static void
+generator(uint8_t *pub)
+{
+    uECC_vli_nativeToBytes(pub, NUM_ECC_BYTES, uECC_secp256r1()->G);
+    uECC_vli_nativeToBytes(pub + NUM_ECC_BYTES, NUM_ECC_BYTES,
+                           uECC_secp256r1()->G + NUM_ECC_WORDS);
+}
+
+static void
+test_known_answers(void)
+{
+    /* NIST CAVS 14.1 ECC CDH primitive, P-256 COUNT = 0 */
+    static const uint8_t cavs_peer[64] = {
+        0x70, 0x0c, 0x48, 0xf7, 0x7f, 0x56, 0x58, 0x4c,
+        0x5c, 0xc6, 0x32, 0xca, 0x65, 0x64, 0x0d, 0xb9,
+        0x1b, 0x6b, 0xac, 0xce, 0x3a, 0x4d, 0xf6, 0xb4,
+        0x2c, 0xe7, 0xcc, 0x83, 0x88, 0x33, 0xd2, 0x87,
+        0xdb, 0x71, 0xe5, 0x09, 0xe3, 0xfd, 0x9b, 0x06,
+        0x0d, 0xdb, 0x20, 0xba, 0x5c, 0x51, 0xdc, 0xc5,
+        0x94, 0x8d, 0x46, 0xfb, 0xf6, 0x40, 0xdf, 0xe0,
+        0x44, 0x17, 0x82, 0xca, 0xb8, 0x5f, 0xa4, 0xac
+    };
+    static const uint8_t cavs_priv[32] = {
+        0x7d, 0x7d, 0xc5, 0xf7, 0x1e, 0xb2, 0x9d, 0xda,
+        0xf8, 0x0d, 0x62, 0x14, 0x63, 0x2e, 0xea, 0xe0,
+        0x3d, 0x90, 0x58, 0xaf, 0x1f, 0xb6, 0xd2, 0x2e,
+        0xd8, 0x0b, 0xad, 0xb6, 0x2b, 0xc1, 0xa5, 0x34
+    };
+    static const uint8_t cavs_pub[64] = {
+        0xea, 0xd2, 0x18, 0x59, 0x01, 0x19, 0xe8, 0x87,
+        0x6b, 0x29, 0x14, 0x6f, 0xf8, 0x9c, 0xa6, 0x17,
+        0x70, 0xc4, 0xed, 0xbb, 0xf9, 0x7d, 0x38, 0xce,
+        0x38, 0x5e, 0xd2, 0x81, 0xd8, 0xa6, 0xb2, 0x30,
+        0x28, 0xaf, 0x61, 0x28, 0x1f, 0xd3, 0x5e, 0x2f,
+        0xa7, 0x00, 0x25, 0x23, 0xac, 0xc8, 0x5a, 0x42,
+        0x9c, 0xb0, 0x6e, 0xe6, 0x64, 0x83, 0x25, 0x38,
+        0x9f, 0x59, 0xed, 0xfc, 0xe1, 0x40, 0x51, 0x41
+    };
+    static const uint8_t cavs_secret[32] = {
+        0x46, 0xfc, 0x62, 0x10, 0x64, 0x20, 0xff, 0x01,
+        0x2e, 0x54, 0xa4, 0x34, 0xfb, 0xdd, 0x2d, 0x25,
+        0xcc, 0xc5, 0x85, 0x20, 0x60, 0x56, 0x1e, 0x68,
+        0x04, 0x0d, 0xd7, 0x77, 0x89, 0x97, 0xbd, 0x7b
+    };
+    /* Core Specification Vol 3, Part H, 2.3.5.6.1, debug key */
+    static const uint8_t debug_priv[32] = {
+        0x3f, 0x49, 0xf6, 0xd4, 0xa3, 0xc5, 0x5f, 0x38,
+        0x74, 0xc9, 0xb3, 0xe3, 0xd2, 0x10, 0x3f, 0x50,
+        0x4a, 0xff, 0x60, 0x7b, 0xeb, 0x40, 0xb7, 0x99,
+        0x58, 0x99, 0xb8, 0xa6, 0xcd, 0x3c, 0x1a, 0xbd
+    };
+    static const uint8_t debug_pub[64] = {
+        0x20, 0xb0, 0x03, 0xd2, 0xf2, 0x97, 0xbe, 0x2c,
+        0x5e, 0x2c, 0x83, 0xa7, 0xe9, 0xf9, 0xa5, 0xb9,
+        0xef, 0xf4, 0x91, 0x11, 0xac, 0xf4, 0xfd, 0xdb,
+        0xcc, 0x03, 0x01, 0x48, 0x0e, 0x35, 0x9d, 0xe6,
+        0xdc, 0x80, 0x9c, 0x49, 0x65, 0x2a, 0xeb, 0x6d,
+        0x63, 0x32, 0x9a, 0xbf, 0x5a, 0x52, 0x15, 0x5c,
+        0x76, 0x63, 0x45, 0xc2, 0x8f, 0xed, 0x30, 0x24,
+        0x74, 0x1c, 0x8e, 0xd0, 0x15, 0x89, 0xd2, 0x8b
+    };
+    /* RFC 6979 A.2.5, SHA-256 of "sample" */
+    static const uint8_t rfc6979_priv[32] = {
+        0xc9, 0xaf, 0xa9, 0xd8, 0x45, 0xba, 0x75, 0x16,
+        0x6b, 0x5c, 0x21, 0x57, 0x67, 0xb1, 0xd6, 0x93,
+        0x4e, 0x50, 0xc3, 0xdb, 0x36, 0xe8, 0x9b, 0x12,
+        0x7b, 0x8a, 0x62, 0x2b, 0x12, 0x0f, 0x67, 0x21
+    };
+    static const uint8_t rfc6979_pub[64] = {
+        0x60, 0xfe, 0xd4, 0xba, 0x25, 0x5a, 0x9d, 0x31,
+        0xc9, 0x61, 0xeb, 0x74, 0xc6, 0x35, 0x6d, 0x68,
+        0xc0, 0x49, 0xb8, 0x92, 0x3b, 0x61, 0xfa, 0x6c,
+        0xe6, 0x69, 0x62, 0x2e, 0x60, 0xf2, 0x9f, 0xb6,
+        0x79, 0x03, 0xfe, 0x10, 0x08, 0xb8, 0xbc, 0x99,
+        0xa4, 0x1a, 0xe9, 0xe9, 0x56, 0x28, 0xbc, 0x64,
+        0xf2, 0xf1, 0xb2, 0x0c, 0x2d, 0x7e, 0x9f, 0x51,
+        0x77, 0xa3, 0xc2, 0x94, 0xd4, 0x46, 0x22, 0x99
+    };
+    static const uint8_t rfc6979_hash[32] = {
+        0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1,
+        0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+        0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15,
+        0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf
+    };
+    static const uint8_t rfc6979_k[32] = {
+        0xa6, 0xe3, 0xc5, 0x7d, 0xd0, 0x1a, 0xbe, 0x90,
+        0x08, 0x65, 0x38, 0x39, 0x83, 0x55, 0xdd, 0x4c,
+        0x3b, 0x17, 0xaa, 0x87, 0x33, 0x82, 0xb0, 0xf2,
+        0x4d, 0x61, 0x29, 0x49, 0x3d, 0x8a, 0xad, 0x60
+    };
+    static const uint8_t rfc6979_sig[64] = {
+        0xef, 0xd4, 0x8b, 0x2a, 0xac, 0xb6, 0xa8, 0xfd,
+        0x11, 0x40, 0xdd, 0x9c, 0xd4, 0x5e, 0x81, 0xd6,
+        0x9d, 0x2c, 0x87, 0x7b, 0x56, 0xaa, 0xf9, 0x91,
+        0xc3, 0x4d, 0x0e, 0xa8, 0x4e, 0xaf, 0x37, 0x16,
+        0xf7, 0xcb, 0x1c, 0x94, 0x2d, 0x65, 0x7c, 0x41,
+        0xd4, 0x36, 0xc7, 0xa1, 0xb6, 0xe2, 0x9f, 0x65,
+        0xf3, 0xe9, 0x00, 0xdb, 0xb9, 0xaf, 0xf4, 0x06,
+        0x4d, 0xc4, 0xab, 0x2f, 0x84, 0x3a, 0xcd, 0xa8
+    };
+    const struct uECC_Curve_t *curve = uECC_secp256r1();
+    unsigned int k[NUM_ECC_WORDS];
+    uint8_t priv[32];
+    uint8_t pub[64];
+    uint8_t out[64];
+
+    CHECK(uECC_compute_public_key(cavs_priv, pub, curve) == 1);
+    CHECK(memcmp(pub, cavs_pub, 64) == 0);
+    CHECK(uECC_shared_secret(cavs_peer, cavs_priv, out, curve) == 1);
+    CHECK(memcmp(out, cavs_secret, 32) == 0);
+
+    CHECK(uECC_compute_public_key(debug_priv, pub, curve) == 1);
+    CHECK(memcmp(pub, debug_pub, 64) == 0);
+    uECC_vli_bytesToNative(k, debug_priv, 32);
+    CHECK(uECC_make_key_with_d(pub, priv, k, curve) == 1);
+    CHECK(memcmp(pub, debug_pub, 64) == 0);
+    CHECK(memcmp(priv, debug_priv, 32) == 0);
+
+    CHECK(uECC_compute_public_key(rfc6979_priv, pub, curve) == 1);
+    CHECK(memcmp(pub, rfc6979_pub, 64) == 0);
+    uECC_vli_bytesToNative(k, rfc6979_k, 32);
+    CHECK(uECC_sign_with_k(rfc6979_priv, rfc6979_hash, 32, k, out, curve) == 1);
+    CHECK(memcmp(out, rfc6979_sig, 64) == 0);
+    CHECK(uECC_verify(rfc6979_pub, rfc6979_hash, 32, rfc6979_sig, curve) == 1);
+
+    /* 1 * G, and keys out of range */
+    memset(priv, 0, 32);
+    priv[31] = 1;
+    generator(out);
+    CHECK(uECC_compute_public_key(priv, pub, curve) == MYNEWT_VAL(TINYCRYPT_UECC_GEN_COMB));
+    if (MYNEWT_VAL(TINYCRYPT_UECC_GEN_COMB)) {
+        CHECK(memcmp(pub, out, 64) == 0);
+    }
+    priv[31] = 0;
+    CHECK(uECC_compute_public_key(priv, pub, curve) == 0);
+    uECC_vli_nativeToBytes(priv, 32, curve->n);
+    CHECK(uECC_compute_public_key(priv, pub, curve) == 0);
+    CHECK(uECC_valid_public_key(cavs_peer, curve) == 0);
+    CHECK(uECC_valid_public_key(out, curve) != 0);
+}
+
+static void
+test_random(void)
+{
+    const struct uECC_Curve_t *curve = uECC_secp256r1();
+    uint8_t priv[2][32];
+    uint8_t pub[2][64];
+    uint8_t secret[2][32];
+    uint8_t gen[64];
+    uint8_t hash[32];
+    uint8_t sig[64];
+    uint8_t x[32];
+    int i;
+    int n;
+
+    generator(gen);
+    for (n = 0; n < NUM_KEYS; n++) {
+        for (i = 0; i < 2; i++) {
+            if (n % 2) {
+                CHECK(uECC_make_key(pub[i], priv[i], curve) == 1);
+            } else {
+                test_rng(priv[i], 32);
+                priv[i][0] &= 0x7f;
+                CHECK(uECC_compute_public_key(priv[i], pub[i], curve) == 1);
+            }
+            CHECK(uECC_valid_public_key(pub[i], curve) == 0);
+
+            /* The ladder, without the comb */
+            CHECK(uECC_shared_secret(gen, priv[i], x, curve) == 1);
+            CHECK(memcmp(x, pub[i], 32) == 0);
+        }
+
+        CHECK(uECC_shared_secret(pub[1], priv[0], secret[0], curve) == 1);
+        CHECK(uECC_shared_secret(pub[0], priv[1], secret[1], curve) == 1);
+        CHECK(memcmp(secret[0], secret[1], 32) == 0);
+
+        test_rng(hash, 32);
+        CHECK(uECC_sign(priv[0], hash, 32, sig, curve) == 1);
+        CHECK(uECC_verify(pub[0], hash, 32, sig, curve) == 1);
+        CHECK(uECC_verify(pub[1], hash, 32, sig, curve) == 0);
+        if (n % 2) {
+            hash[rand() % 32] ^= 1 << (rand() % 8);
+        } else {
+            sig[rand() % 64] ^= 1 << (rand() % 8);
+        }
+        CHECK(uECC_verify(pub[0], hash, 32, sig, curve) == 0);
+    }
+}
+
+static double
+now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+bench(void)
+{
+    const struct uECC_Curve_t *curve = uECC_secp256r1();
+    uint8_t priv[32];
+    uint8_t pub[64];
+    uint8_t peer[64];
+    uint8_t secret[32];
+    uint8_t hash[32] = { 0 };
+    uint8_t sig[64];
+    double start;
+    int ok;
+    int i;
+
+    uECC_make_key(peer, priv, curve);
+    ok = 0;
+
+    start = now_sec();
+    for (i = 0; i < BENCH_OPS; i++) {
+        ok += uECC_make_key(pub, priv, curve);
+    }
+    printf("ecc (%s): make_key %.0f/s\n",
+           MYNEWT_VAL(TINYCRYPT_UECC_GEN_COMB) ? "comb" : "ladder",
+           BENCH_OPS / (now_sec() - start));
+
+    start = now_sec();
+    for (i = 0; i < BENCH_OPS; i++) {
+        ok += uECC_shared_secret(peer, priv, secret, curve);
+    }
+    printf("ecc: shared_secret %.0f/s\n", BENCH_OPS / (now_sec() - start));
+
+    start = now_sec();
+    for (i = 0; i < BENCH_OPS; i++) {
+        hash[0] = i;
+        ok += uECC_sign(priv, hash, 32, sig, curve);
+    }
+    printf("ecc: sign %.0f/s\n", BENCH_OPS / (now_sec() - start));
+
+    start = now_sec();
+    for (i = 0; i < BENCH_OPS; i++) {
+        ok += uECC_verify(pub, hash, 32, sig, curve);
+    }
+    printf("ecc: verify %.0f/s\n", BENCH_OPS / (now_sec() - start));
+
+    CHECK(ok == 4 * BENCH_OPS);
+    bench_sink = secret[0] ^ sig[0];
+}
+
+int
+main(void)
+{
+    srand(1);
+    uECC_set_rng(test_rng);
+
+    test_known_answers();
+    test_random();
+    bench();
+
+    return hostTestResult(MYNEWT_VAL(TINYCRYPT_UECC_GEN_COMB) ? "ecc" : "ecc_ladder");
+}
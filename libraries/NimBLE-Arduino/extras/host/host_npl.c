@@ -0,0 +1,55 @@
+/*
+ * NimBLE porting layer and FreeRTOS functions for the host builds. Everything
+ * runs on one thread, so semaphores never block and critical sections are
+ * empty.
+ */
+
+#include "nimble/porting/nimble/include/syscfg/syscfg.h"
+#include "nimble/nimble/include/nimble/nimble_npl.h"
+
+ble_npl_error_t
+npl_freertos_sem_init(struct ble_npl_sem *sem, uint16_t tokens)
+{
+    return BLE_NPL_OK;
+}
+
+ble_npl_error_t
+npl_freertos_sem_deinit(struct ble_npl_sem *sem)
+{
+    return BLE_NPL_OK;
+}
+
+ble_npl_error_t
+npl_freertos_sem_pend(struct ble_npl_sem *sem, ble_npl_time_t timeout)
+{
+    return BLE_NPL_OK;
+}
+
+ble_npl_error_t
+npl_freertos_sem_release(struct ble_npl_sem *sem)
+{
+    return BLE_NPL_OK;
+}
+
+ble_npl_error_t
+npl_freertos_time_ms_to_ticks(uint32_t ms, ble_npl_time_t *out_ticks)
+{
+    *out_ticks = ms;
+    return BLE_NPL_OK;
+}
+
+ble_npl_time_t
+npl_freertos_time_ms_to_ticks32(uint32_t ms)
+{
+    return ms;
+}
+
+void
+vPortEnterCritical(void)
+{
+}
+
+void
+vPortExitCritical(void)
+{
+}
@@ -0,0 +1,29 @@
+/*
+ * Checks shared by the host test programs, see Makefile.
+ */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+
+static int host_test_fails;
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            if (host_test_fails++ < 10) {                                    \
+                printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            }                                                                \
+        }                                                                    \
+    } while (0)
+
+static inline int
+hostTestResult(const char *name)
+{
+    printf("%s: %s (%d failed checks)\n", name, host_test_fails ? "FAIL" : "PASS",
+           host_test_fails);
+    return host_test_fails ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,4 @@
+/*
+ * User configuration of the host builds, see ../Makefile. Tests can add
+ * to it with -D on their command line.
+ */
@@ -0,0 +1,58 @@
+/*
+ * Just enough of FreeRTOS for the host builds, see ../../Makefile.
+ */
+
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t StackType_t;
+typedef void *QueueHandle_t;
+typedef void *SemaphoreHandle_t;
+typedef void *TaskHandle_t;
+typedef void *TimerHandle_t;
+typedef struct { int unused; } portMUX_TYPE;
+
+#define portMAX_DELAY                   0xffffffffUL
+#define portTICK_PERIOD_MS              1
+#define portMUX_INITIALIZER_UNLOCKED    {0}
+#define portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL(mux)
+#define pdTRUE                          1
+#define pdFALSE                         0
+#define pdPASS                          1
+#define pdMS_TO_TICKS(ms)               (ms)
+#define configTICK_RATE_HZ              1000
+#define configMAX_PRIORITIES            25
+#define tskNO_AFFINITY                  0x7fffffff
+#define taskSCHEDULER_NOT_STARTED       1
+#define eNoAction                       0
+#define eSetBits                        1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+BaseType_t xTaskGetSchedulerState(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+TickType_t xTaskGetTickCountFromISR(void);
+void vTaskDelay(TickType_t ticks);
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t item_size);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueIsQueueEmptyFromISR(QueueHandle_t queue);
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t sem);
+UBaseType_t uxGetCriticalNestingDepth(void);
+void vPortEnterCritical(void);
+void vPortExitCritical(void);
+BaseType_t xPortInIsrContext(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * The host C library's sys/queue.h with the FreeBSD macros of the ESP-IDF
+ * version that NimBLE uses. The circular queues come from os/queue.h.
+ */
+
+#ifndef HOST_SYS_QUEUE_H
+#define HOST_SYS_QUEUE_H
+
+#include_next <sys/queue.h>
+
+#undef CIRCLEQ_HEAD
+#undef CIRCLEQ_HEAD_INITIALIZER
+#undef CIRCLEQ_ENTRY
+#undef CIRCLEQ_EMPTY
+#undef CIRCLEQ_FIRST
+#undef CIRCLEQ_FOREACH
+#undef CIRCLEQ_FOREACH_REVERSE
+#undef CIRCLEQ_INIT
+#undef CIRCLEQ_INSERT_AFTER
+#undef CIRCLEQ_INSERT_BEFORE
+#undef CIRCLEQ_INSERT_HEAD
+#undef CIRCLEQ_INSERT_TAIL
+#undef CIRCLEQ_LAST
+#undef CIRCLEQ_LOOP_NEXT
+#undef CIRCLEQ_LOOP_PREV
+#undef CIRCLEQ_NEXT
+#undef CIRCLEQ_PREV
+#undef CIRCLEQ_REMOVE
+
+#ifndef SLIST_FOREACH_SAFE
+#define SLIST_FOREACH_SAFE(var, head, field, tvar)                          \
+    for ((var) = SLIST_FIRST((head));                                       \
+         (var) && ((tvar) = SLIST_NEXT((var), field), 1);                   \
+         (var) = (tvar))
+#endif
+
+#ifndef SLIST_REMOVE_AFTER
+#define SLIST_REMOVE_AFTER(elm, field) do {                                 \
+    SLIST_NEXT(elm, field) = SLIST_NEXT(SLIST_NEXT(elm, field), field);     \
+} while (0)
+#endif
+
+#ifndef STAILQ_LAST
+#define STAILQ_LAST(head, type, field)                                      \
+    (STAILQ_EMPTY((head)) ? NULL :                                          \
+     (struct type *)(void *)((char *)((head)->stqh_last) -                  \
+                             __builtin_offsetof(struct type, field)))
+#endif
+
+#ifndef STAILQ_REMOVE_AFTER
+#define STAILQ_REMOVE_AFTER(head, elm, field) do {                          \
+    if ((STAILQ_NEXT(elm, field) =                                          \
+         STAILQ_NEXT(STAILQ_NEXT(elm, field), field)) == NULL) {            \
+        (head)->stqh_last = &STAILQ_NEXT((elm), field);                     \
+    }                                                                       \
+} while (0)
+#endif
+
+#ifndef TAILQ_FOREACH_SAFE
+#define TAILQ_FOREACH_SAFE(var, head, field, tvar)                          \
+    for ((var) = TAILQ_FIRST((head));                                       \
+         (var) && ((tvar) = TAILQ_NEXT((var), field), 1);                   \
+         (var) = (tvar))
+#endif
+
+#endif
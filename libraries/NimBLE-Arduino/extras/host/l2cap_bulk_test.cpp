@@ -0,0 +1,170 @@
+/*
+ * Loopback test of NimBLEL2CAPBulkTransfer over the real L2CAP CoC code.
+ *
+ * A central and a peripheral endpoint, each with its NimBLEL2CAPChannel,
+ * talk through ble_l2cap_coc.c on both sides of the simulated link of
+ * l2cap_loopback.c: 6 LL PDUs of 251 bytes each way per 7.5 ms connection
+ * event. A 300 KB image is sent with several channel MTU and MPS settings and
+ * must arrive byte for byte, the rates are printed in simulated time. Then
+ * the image is sent with 1 in 37 K-frames corrupted, and with the link lost
+ * halfway and the transfer resumed after reconnecting.
+ */
+
+#include "NimBLEDevice.h"
+#include "host_test.h"
+#include "l2cap_loopback.h"
+
+#include <cstdlib>
+
+extern "C" int ble_hs_id_gen_rnd(int, ble_addr_t*) {
+    return 0;
+}
+
+NimBLEL2CAPServer* NimBLEDevice::createL2CAPServer() {
+    static NimBLEL2CAPServer* server = new NimBLEL2CAPServer();
+    return server;
+}
+
+/* The GAP connection of the central is the simulated link */
+bool NimBLEClient::isConnected() const {
+    return lb_is_connected();
+}
+
+uint16_t NimBLEClient::getConnHandle() const {
+    return LB_CENTRAL_HANDLE;
+}
+
+static const uint32_t ImageSize = 300 * 1024;
+
+static std::vector<uint8_t> image;
+
+class SenderCallbacks : public NimBLEL2CAPBulkTransferCallbacks {};
+
+/* Stores the received transfer */
+class ReceiverCallbacks : public NimBLEL2CAPBulkTransferCallbacks {
+  public:
+    uint32_t onBegin(NimBLEL2CAPBulkTransfer*, uint32_t, uint32_t size, uint32_t offset) override {
+        data.resize(size);
+        beginOffset = offset;
+        return offset;
+    }
+
+    void onData(NimBLEL2CAPBulkTransfer*, uint32_t, uint32_t offset, const uint8_t* buf, size_t length) override {
+        CHECK(offset + length <= data.size());
+        memcpy(&data[offset], buf, length);
+    }
+
+    void onComplete(NimBLEL2CAPBulkTransfer*, uint32_t, const NimBLEL2CAPBulkStats& stats) override {
+        completed++;
+        crcErrors += stats.crcErrors;
+    }
+
+    std::vector<uint8_t> data;
+    uint32_t             beginOffset{0};
+    uint32_t             completed{0};
+    uint32_t             crcErrors{0};
+};
+
+/* Only the image is compared, the simulated client needs no state */
+static NimBLEClient* client = reinterpret_cast<NimBLEClient*>(&image);
+
+static SenderCallbacks senderCb;
+static uint16_t        nextPsm = 0x80;
+
+struct Endpoints {
+    NimBLEL2CAPBulkTransfer* central;
+    NimBLEL2CAPBulkTransfer* peripheral;
+    ReceiverCallbacks*       received;
+};
+
+/* Endpoints on a new PSM, they stay registered with the server until the end */
+static Endpoints open(uint16_t mtu, uint16_t mps) {
+    Endpoints e;
+    e.received   = new ReceiverCallbacks();
+    e.central    = new NimBLEL2CAPBulkTransfer(nextPsm, &senderCb, mtu);
+    e.peripheral = new NimBLEL2CAPBulkTransfer(nextPsm, e.received, mtu);
+    nextPsm++;
+
+    lb_params.mps = mps;
+    CHECK(e.peripheral->listen());
+    lb_connect();
+    CHECK(e.central->connect(client));
+    CHECK(e.peripheral->isConnected());
+    return e;
+}
+
+static void sendImage(uint16_t mtu, uint16_t mps) {
+    Endpoints e = open(mtu, mps);
+    CHECK(e.central->send(1, image.data(), image.size()));
+    CHECK(e.received->completed == 1);
+    CHECK(e.received->data == image);
+
+    auto& stats = e.central->getTxStats();
+    CHECK(stats.bytes == ImageSize && stats.retransmits == 0);
+    printf("l2cap_bulk: MTU %4u / MPS %3u %6.1f KB/s\n", mtu, mps, stats.getBytesPerSecond() / 1000.0);
+    lb_disconnect();
+}
+
+static void sendCorrupted() {
+    Endpoints e = open(2048, 247);
+    lb_params.corrupt_every = 37;
+    CHECK(e.central->send(2, image.data(), image.size()));
+    lb_params.corrupt_every = 0;
+    CHECK(e.received->data == image);
+
+    auto& stats = e.central->getTxStats();
+    CHECK(lb_stats.corrupted > 0 && e.received->crcErrors > 0);
+    CHECK(stats.retransmits > 0);
+    printf("l2cap_bulk: 1 in 37 corrupted  %6.1f KB/s, %u CRC errors, %u blocks sent again\n",
+           stats.getBytesPerSecond() / 1000.0,
+           static_cast<unsigned>(e.received->crcErrors),
+           static_cast<unsigned>(stats.retransmits));
+    lb_disconnect();
+}
+
+static void sendResumed() {
+    Endpoints e = open(2048, 247);
+    lb_params.drop_after = ImageSize / 2;
+    CHECK(!e.central->send(3, image.data(), image.size()));
+    CHECK(!e.central->isConnected() && !e.peripheral->isConnected());
+    CHECK(e.received->completed == 0);
+    uint32_t blocksBefore = e.central->getTxStats().blocks;
+
+    lb_connect();
+    CHECK(e.central->connect(client));
+    CHECK(e.central->send(3, image.data(), image.size()));
+    // The frame headers count towards drop_after, and the blocks in flight are lost
+    CHECK(e.received->beginOffset >= ImageSize / 2 - 2 * 2048);
+    CHECK(e.received->completed == 1);
+    CHECK(e.received->data == image);
+    // At most the window of unacknowledged blocks is sent again
+    uint32_t blocks = (ImageSize + 2048 - 13 - 1) / (2048 - 13);
+    CHECK(blocksBefore + e.central->getTxStats().blocks <= blocks + NimBLEL2CAPBulkTransfer::DefaultWindow);
+    printf("l2cap_bulk: resumed at %u of %u bytes\n", static_cast<unsigned>(e.received->beginOffset),
+           static_cast<unsigned>(ImageSize));
+    lb_disconnect();
+}
+
+int main() {
+    srand(1);
+    image.resize(ImageSize);
+    for (auto& b : image) {
+        b = rand();
+    }
+
+    lb_init();
+
+    sendImage(5000, 247);
+    sendImage(2048, 247);
+    sendImage(512, 247);
+    sendImage(247, 247);
+    sendImage(2048, 64);
+    sendImage(2048, 23);
+    CHECK(lb_stats.protocol_errors == 0);
+
+    sendCorrupted();
+    sendResumed();
+    CHECK(lb_stats.hung_waits == 0);
+
+    return hostTestResult("l2cap_bulk");
+}
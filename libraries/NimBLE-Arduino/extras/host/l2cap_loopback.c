@@ -0,0 +1,612 @@
+/*
+ * Two NimBLE hosts connected by a simulated link, to run the real L2CAP
+ * connection oriented channel code (ble_l2cap_coc.c) without a controller.
+ *
+ * Stands in for the connection table, the signalling channel and the ACL
+ * path of the host. K-frames and credit packets are queued per direction and
+ * sent as LL PDUs at each connection event, a frame of a given length taking
+ * as many PDUs as it would on air. Time is simulated: every wait of the
+ * porting layer (semaphores, delays) runs connection events until it is
+ * released or times out, so a blocking sender and the host task callbacks of
+ * both sides run on the calling thread in a fixed order.
+ *
+ * Also provides the porting layer functions of host_npl.c, a test links one
+ * or the other.
+ */
+
+#include "nimble/porting/nimble/include/syscfg/syscfg.h"
+#include "nimble/nimble/host/src/ble_hs_priv.h"
+#include "nimble/nimble/host/src/ble_l2cap_coc_priv.h"
+#include "nimble/nimble/host/src/ble_l2cap_sig_priv.h"
+#include "l2cap_loopback.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LB_L2CAP_HDR_LEN        4
+/* Signalling header, command header and LE credits payload */
+#define LB_CREDITS_PKT_LEN      (4 + 4 + 4)
+#define LB_MBUF_BLOCK_SIZE      272
+#define LB_MBUF_COUNT           512
+/* A wait without a timeout gives up after this much simulated time */
+#define LB_WAIT_FOREVER_MS      60000
+
+struct lb_params lb_params = {
+    .itvl_us = 7500,
+    .pdus_per_event = 6,
+    .ll_payload = 251,
+    .mps = MYNEWT_VAL(BLE_L2CAP_COC_MPS),
+};
+
+struct lb_stats lb_stats;
+
+struct lb_frame {
+    struct lb_frame *next;
+    /* K-frame, or NULL for a credits packet */
+    struct os_mbuf *om;
+    /* Destination CID of the K-frame, source CID of the credits */
+    uint16_t cid;
+    uint16_t credits;
+    uint16_t pdus_left;
+};
+
+struct lb_side {
+    struct ble_hs_conn conn;
+    struct lb_frame *tx_head;
+    struct lb_frame *tx_tail;
+};
+
+static struct lb_side lb_sides[2];
+static bool lb_connected;
+static uint32_t lb_now_us;
+static uint32_t lb_next_event_us;
+static uint32_t lb_to_peripheral;
+static uint32_t lb_kframes_from_central;
+/* Set by a channel that closes itself, the link drops after the event */
+static bool lb_drop;
+
+/* Channel opened by the central, the request reaches the peer at the next event */
+static struct ble_l2cap_chan *lb_connect_chan;
+
+static os_membuf_t lb_mbuf_mem[OS_MEMPOOL_SIZE(LB_MBUF_COUNT, LB_MBUF_BLOCK_SIZE)];
+static struct os_mempool lb_mbuf_mempool;
+static struct os_mbuf_pool lb_mbuf_pool;
+
+static struct lb_side *
+lb_side(uint16_t conn_handle)
+{
+    assert(conn_handle == LB_CENTRAL_HANDLE || conn_handle == LB_PERIPHERAL_HANDLE);
+    return &lb_sides[conn_handle - 1];
+}
+
+static struct lb_side *
+lb_peer(struct lb_side *side)
+{
+    return side == &lb_sides[0] ? &lb_sides[1] : &lb_sides[0];
+}
+
+static void
+lb_queue(struct lb_side *side, struct os_mbuf *om, uint16_t cid, uint16_t credits, uint16_t len)
+{
+    struct lb_frame *frame;
+
+    frame = calloc(1, sizeof *frame);
+    assert(frame != NULL);
+    frame->om = om;
+    frame->cid = cid;
+    frame->credits = credits;
+    frame->pdus_left = (len + lb_params.ll_payload - 1) / lb_params.ll_payload;
+
+    if (side->tx_tail == NULL) {
+        side->tx_head = frame;
+    } else {
+        side->tx_tail->next = frame;
+    }
+    side->tx_tail = frame;
+}
+
+/* The central opened a channel, what ble_l2cap_sig.c does for the request
+ * on the peripheral and for the response on the central.
+ */
+static void
+lb_connect_chan_rx(void)
+{
+    struct ble_l2cap_chan *chan = lb_connect_chan;
+    struct ble_l2cap_chan *srv_chan;
+    struct ble_l2cap_event event = { 0 };
+    int rc;
+
+    lb_connect_chan = NULL;
+
+    rc = ble_l2cap_coc_create_srv_chan(&lb_sides[1].conn, chan->psm, &srv_chan);
+    assert(rc == 0);
+    ble_l2cap_coc_set_new_mtu_mps(srv_chan, srv_chan->coc_rx.mtu, lb_params.mps);
+    srv_chan->coc_rx.credits = srv_chan->initial_credits;
+    srv_chan->dcid = chan->scid;
+    srv_chan->peer_coc_mps = chan->my_coc_mps;
+    srv_chan->coc_tx.credits = chan->coc_rx.credits;
+    srv_chan->coc_tx.mtu = chan->coc_rx.mtu;
+    ble_hs_conn_chan_insert(&lb_sides[1].conn, srv_chan);
+
+    event.type = BLE_L2CAP_EVENT_COC_ACCEPT;
+    event.accept.conn_handle = LB_PERIPHERAL_HANDLE;
+    event.accept.chan = srv_chan;
+    event.accept.peer_sdu_size = chan->coc_rx.mtu;
+    rc = srv_chan->cb(&event, srv_chan->cb_arg);
+    assert(rc == 0);
+
+    chan->dcid = srv_chan->scid;
+    chan->peer_coc_mps = srv_chan->my_coc_mps;
+    chan->coc_tx.credits = srv_chan->coc_rx.credits;
+    chan->coc_tx.mtu = srv_chan->coc_rx.mtu;
+    ble_hs_conn_chan_insert(&lb_sides[0].conn, chan);
+
+    memset(&event, 0, sizeof event);
+    event.type = BLE_L2CAP_EVENT_COC_CONNECTED;
+    event.connect.conn_handle = LB_PERIPHERAL_HANDLE;
+    event.connect.chan = srv_chan;
+    srv_chan->cb(&event, srv_chan->cb_arg);
+
+    event.connect.conn_handle = LB_CENTRAL_HANDLE;
+    event.connect.chan = chan;
+    chan->cb(&event, chan->cb_arg);
+}
+
+static void
+lb_deliver(struct lb_side *peer, struct lb_frame *frame)
+{
+    struct ble_l2cap_chan *chan;
+
+    if (frame->om == NULL) {
+        lb_stats.credit_pkts++;
+        ble_l2cap_coc_le_credits_update(peer->conn.bhc_handle, frame->cid, frame->credits);
+        return;
+    }
+
+    chan = ble_hs_conn_chan_find_by_scid(&peer->conn, frame->cid);
+    if (chan == NULL) {
+        os_mbuf_free_chain(frame->om);
+        return;
+    }
+
+    /* What ble_l2cap_rx() does with a complete frame */
+    lb_stats.kframes++;
+    chan->rx_buf = frame->om;
+    chan->rx_fn(chan);
+    os_mbuf_free_chain(chan->rx_buf);
+    chan->rx_buf = NULL;
+}
+
+/* Sends the PDUs of one direction for one connection event */
+static void
+lb_event_tx(struct lb_side *side)
+{
+    struct lb_frame *frame;
+    int budget;
+
+    budget = lb_params.pdus_per_event;
+    while (lb_connected && budget > 0 && side->tx_head != NULL) {
+        frame = side->tx_head;
+        if (frame->pdus_left > budget) {
+            frame->pdus_left -= budget;
+            return;
+        }
+
+        budget -= frame->pdus_left;
+        side->tx_head = frame->next;
+        if (side->tx_head == NULL) {
+            side->tx_tail = NULL;
+        }
+
+        if (side == &lb_sides[0] && frame->om != NULL) {
+            lb_to_peripheral += OS_MBUF_PKTLEN(frame->om);
+        }
+        lb_deliver(lb_peer(side), frame);
+        free(frame);
+
+        if (lb_params.drop_after != 0 && lb_to_peripheral >= lb_params.drop_after) {
+            lb_params.drop_after = 0;
+            lb_drop = true;
+        }
+        if (lb_drop) {
+            lb_drop = false;
+            lb_disconnect();
+        }
+    }
+}
+
+static void
+lb_step(void)
+{
+    lb_now_us = lb_next_event_us;
+    lb_next_event_us += lb_params.itvl_us;
+
+    if (!lb_connected) {
+        return;
+    }
+
+    if (lb_connect_chan != NULL) {
+        lb_connect_chan_rx();
+    }
+
+    lb_event_tx(&lb_sides[0]);
+    lb_event_tx(&lb_sides[1]);
+}
+
+static uint32_t
+lb_now_ms(void)
+{
+    return lb_now_us / 1000;
+}
+
+void
+lb_init(void)
+{
+    int rc;
+
+    rc = os_mempool_init(&lb_mbuf_mempool, LB_MBUF_COUNT, LB_MBUF_BLOCK_SIZE,
+                         lb_mbuf_mem, "lb_mbuf");
+    assert(rc == 0);
+    rc = os_mbuf_pool_init(&lb_mbuf_pool, &lb_mbuf_mempool, LB_MBUF_BLOCK_SIZE,
+                           LB_MBUF_COUNT);
+    assert(rc == 0);
+    rc = ble_l2cap_coc_init();
+    assert(rc == 0);
+}
+
+void
+lb_connect(void)
+{
+    int i;
+
+    for (i = 0; i < 2; i++) {
+        memset(&lb_sides[i], 0, sizeof lb_sides[i]);
+        lb_sides[i].conn.bhc_handle = i + 1;
+        SLIST_INIT(&lb_sides[i].conn.bhc_channels);
+    }
+    lb_to_peripheral = 0;
+    lb_connected = true;
+}
+
+/* Link loss, what ble_hs_conn_free() does for the channels of both sides */
+void
+lb_disconnect(void)
+{
+    struct ble_l2cap_chan *chan;
+    struct lb_frame *frame;
+    struct lb_side *side;
+    int i;
+
+    lb_connected = false;
+
+    for (i = 0; i < 2; i++) {
+        side = &lb_sides[i];
+        while ((frame = side->tx_head) != NULL) {
+            side->tx_head = frame->next;
+            os_mbuf_free_chain(frame->om);
+            free(frame);
+        }
+        side->tx_tail = NULL;
+
+        while ((chan = SLIST_FIRST(&side->conn.bhc_channels)) != NULL) {
+            SLIST_REMOVE_HEAD(&side->conn.bhc_channels, next);
+            os_mbuf_free_chain(chan->rx_buf);
+            ble_l2cap_coc_cleanup_chan(&side->conn, chan);
+            free(chan);
+        }
+    }
+}
+
+bool
+lb_is_connected(void)
+{
+    return lb_connected;
+}
+
+/* Connection table */
+
+void
+ble_hs_lock(void)
+{
+}
+
+void
+ble_hs_unlock(void)
+{
+}
+
+struct ble_hs_conn *
+ble_hs_conn_find(uint16_t conn_handle)
+{
+    if (!lb_connected) {
+        return NULL;
+    }
+
+    return &lb_side(conn_handle)->conn;
+}
+
+struct ble_hs_conn *
+ble_hs_conn_find_assert(uint16_t conn_handle)
+{
+    struct ble_hs_conn *conn;
+
+    conn = ble_hs_conn_find(conn_handle);
+    assert(conn != NULL);
+    return conn;
+}
+
+struct ble_l2cap_chan *
+ble_hs_conn_chan_find_by_scid(struct ble_hs_conn *conn, uint16_t cid)
+{
+    struct ble_l2cap_chan *chan;
+
+    SLIST_FOREACH(chan, &conn->bhc_channels, next) {
+        if (chan->scid == cid) {
+            return chan;
+        }
+    }
+
+    return NULL;
+}
+
+struct ble_l2cap_chan *
+ble_hs_conn_chan_find_by_dcid(struct ble_hs_conn *conn, uint16_t cid)
+{
+    struct ble_l2cap_chan *chan;
+
+    SLIST_FOREACH(chan, &conn->bhc_channels, next) {
+        if (chan->dcid == cid) {
+            return chan;
+        }
+    }
+
+    return NULL;
+}
+
+int
+ble_hs_conn_chan_insert(struct ble_hs_conn *conn, struct ble_l2cap_chan *chan)
+{
+    SLIST_INSERT_HEAD(&conn->bhc_channels, chan, next);
+    return 0;
+}
+
+/* ACL path and signalling */
+
+struct os_mbuf *
+ble_hs_mbuf_l2cap_pkt(void)
+{
+    return os_mbuf_get_pkthdr(&lb_mbuf_pool, 0);
+}
+
+int
+ble_hs_mbuf_pullup_base(struct os_mbuf **om, int base_len)
+{
+    if (OS_MBUF_PKTLEN(*om) < base_len) {
+        return BLE_HS_EBADDATA;
+    }
+
+    *om = os_mbuf_pullup(*om, base_len);
+    if (*om == NULL) {
+        return BLE_HS_ENOMEM;
+    }
+
+    return 0;
+}
+
+struct ble_l2cap_chan *
+ble_l2cap_chan_alloc(uint16_t conn_handle)
+{
+    struct ble_l2cap_chan *chan;
+
+    chan = calloc(1, sizeof *chan);
+    if (chan != NULL) {
+        chan->conn_handle = conn_handle;
+    }
+
+    return chan;
+}
+
+int
+ble_l2cap_tx(struct ble_hs_conn *conn, struct ble_l2cap_chan *chan,
+             struct os_mbuf *txom)
+{
+    uint16_t len = OS_MBUF_PKTLEN(txom);
+    uint8_t byte;
+
+    if (conn->bhc_handle == LB_CENTRAL_HANDLE && lb_params.corrupt_every != 0 &&
+        len > 32 && ++lb_kframes_from_central % lb_params.corrupt_every == 0) {
+        lb_stats.corrupted++;
+        /* The last byte is always payload, never a header field */
+        os_mbuf_copydata(txom, len - 1, 1, &byte);
+        byte ^= 0x5a;
+        os_mbuf_copyinto(txom, len - 1, &byte, 1);
+    }
+
+    lb_queue(lb_side(conn->bhc_handle), txom, chan->dcid, 0, LB_L2CAP_HDR_LEN + len);
+    return 0;
+}
+
+int
+ble_l2cap_sig_le_credits(uint16_t conn_handle, uint16_t scid, uint16_t credits)
+{
+    lb_queue(lb_side(conn_handle), NULL, scid, credits, LB_CREDITS_PKT_LEN);
+    return 0;
+}
+
+int
+ble_l2cap_sig_disconnect(struct ble_l2cap_chan *chan)
+{
+    lb_stats.protocol_errors++;
+    lb_drop = true;
+    return 0;
+}
+
+/* The API of ble_l2cap.c */
+
+int
+ble_l2cap_create_server(uint16_t psm, uint16_t mtu, ble_l2cap_event_fn *cb, void *cb_arg)
+{
+    return ble_l2cap_coc_create_server(psm, mtu, cb, cb_arg);
+}
+
+int
+ble_l2cap_connect(uint16_t conn_handle, uint16_t psm, uint16_t mtu,
+                  struct os_mbuf *sdu_rx, ble_l2cap_event_fn *cb, void *cb_arg)
+{
+    struct ble_l2cap_chan *chan;
+
+    if (!lb_connected || conn_handle != LB_CENTRAL_HANDLE || lb_connect_chan != NULL) {
+        return BLE_HS_EBUSY;
+    }
+
+    chan = ble_l2cap_coc_chan_alloc(&lb_sides[0].conn, psm, mtu, sdu_rx, cb, cb_arg);
+    if (chan == NULL) {
+        return BLE_HS_ENOMEM;
+    }
+    ble_l2cap_coc_set_new_mtu_mps(chan, mtu, lb_params.mps);
+    chan->coc_rx.credits = chan->initial_credits;
+
+    lb_connect_chan = chan;
+    return 0;
+}
+
+int
+ble_l2cap_disconnect(struct ble_l2cap_chan *chan)
+{
+    return ble_l2cap_sig_disconnect(chan);
+}
+
+int
+ble_l2cap_get_chan_info(struct ble_l2cap_chan *chan, struct ble_l2cap_chan_info *chan_info)
+{
+    if (!chan || !chan_info) {
+        return BLE_HS_EINVAL;
+    }
+
+    memset(chan_info, 0, sizeof(*chan_info));
+    chan_info->dcid = chan->dcid;
+    chan_info->scid = chan->scid;
+    chan_info->our_l2cap_mtu = chan->my_mtu;
+    chan_info->peer_l2cap_mtu = chan->peer_mtu;
+    chan_info->psm = chan->psm;
+    chan_info->our_coc_mtu = chan->coc_rx.mtu;
+    chan_info->peer_coc_mtu = chan->coc_tx.mtu;
+
+    return 0;
+}
+
+int
+ble_l2cap_send(struct ble_l2cap_chan *chan, struct os_mbuf *sdu)
+{
+    return ble_l2cap_coc_send(chan, sdu);
+}
+
+int
+ble_l2cap_recv_ready(struct ble_l2cap_chan *chan, struct os_mbuf *sdu_rx)
+{
+    return ble_l2cap_coc_recv_ready(chan, sdu_rx);
+}
+
+/* Porting layer, the waits run the link */
+
+struct lb_sem {
+    uint16_t count;
+};
+
+ble_npl_error_t
+npl_freertos_sem_init(struct ble_npl_sem *sem, uint16_t tokens)
+{
+    struct lb_sem *s;
+
+    s = calloc(1, sizeof *s);
+    if (s == NULL) {
+        return BLE_NPL_ENOMEM;
+    }
+    s->count = tokens;
+    sem->handle = s;
+
+    return BLE_NPL_OK;
+}
+
+ble_npl_error_t
+npl_freertos_sem_deinit(struct ble_npl_sem *sem)
+{
+    free(sem->handle);
+    sem->handle = NULL;
+    return BLE_NPL_OK;
+}
+
+ble_npl_error_t
+npl_freertos_sem_pend(struct ble_npl_sem *sem, ble_npl_time_t timeout)
+{
+    struct lb_sem *s = sem->handle;
+    uint32_t deadline;
+
+    if (timeout == BLE_NPL_TIME_FOREVER) {
+        timeout = LB_WAIT_FOREVER_MS;
+    }
+    deadline = lb_now_ms() + timeout;
+
+    while (s->count == 0) {
+        if (lb_now_ms() >= deadline) {
+            if (timeout == LB_WAIT_FOREVER_MS) {
+                fprintf(stderr, "l2cap_loopback: a wait forever was never released\n");
+                lb_stats.hung_waits++;
+            }
+            return BLE_NPL_TIMEOUT;
+        }
+        lb_step();
+    }
+
+    s->count--;
+    return BLE_NPL_OK;
+}
+
+ble_npl_error_t
+npl_freertos_sem_release(struct ble_npl_sem *sem)
+{
+    struct lb_sem *s = sem->handle;
+
+    s->count++;
+    return BLE_NPL_OK;
+}
+
+ble_npl_error_t
+npl_freertos_time_ms_to_ticks(uint32_t ms, ble_npl_time_t *out_ticks)
+{
+    *out_ticks = ms;
+    return BLE_NPL_OK;
+}
+
+ble_npl_time_t
+npl_freertos_time_ms_to_ticks32(uint32_t ms)
+{
+    return ms;
+}
+
+TickType_t
+xTaskGetTickCountFromISR(void)
+{
+    return lb_now_ms();
+}
+
+void
+vTaskDelay(TickType_t ticks)
+{
+    uint32_t until = lb_now_ms() + ticks;
+
+    while (lb_now_ms() < until) {
+        lb_step();
+    }
+}
+
+void
+vPortEnterCritical(void)
+{
+}
+
+void
+vPortExitCritical(void)
+{
+}
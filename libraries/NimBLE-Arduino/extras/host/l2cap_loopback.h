@@ -0,0 +1,56 @@
+/*
+ * Simulated link between two hosts for the L2CAP tests, see l2cap_loopback.c.
+ */
+
+#ifndef L2CAP_LOOPBACK_H
+#define L2CAP_LOOPBACK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Handle of the connection on the side that opens the channels */
+#define LB_CENTRAL_HANDLE       1
+/* Handle of the connection on the side that listens */
+#define LB_PERIPHERAL_HANDLE    2
+
+struct lb_params {
+    /* Connection interval, microseconds */
+    uint32_t itvl_us;
+    /* LL PDUs each direction can send in one connection event */
+    uint8_t pdus_per_event;
+    /* LL PDU payload size */
+    uint16_t ll_payload;
+    /* MPS of the channels opened after it is set */
+    uint16_t mps;
+    /* Corrupt one in this many K-frames from the central, 0 for none */
+    uint32_t corrupt_every;
+    /* Drop the link once this many bytes went to the peripheral, 0 never */
+    uint32_t drop_after;
+};
+
+struct lb_stats {
+    uint32_t kframes;
+    uint32_t credit_pkts;
+    uint32_t corrupted;
+    uint32_t protocol_errors;
+    /* Waits forever that nothing released within a simulated minute */
+    uint32_t hung_waits;
+};
+
+extern struct lb_params lb_params;
+extern struct lb_stats lb_stats;
+
+void lb_init(void);
+void lb_connect(void);
+void lb_disconnect(void);
+bool lb_is_connected(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,297 @@
+/*
+ * Host test of os_mbuf_to_iovec() on mbuf chains and of the mempool failure
+ * counters.
+ *
+ * Builds random packet header chains with odd segment sizes and some empty
+ * mbufs, and checks the segments of random ranges against os_mbuf_copydata():
+ * the same bytes, one segment per non-empty mbuf in the range, only iov_cnt
+ * of them filled in, and -1 for ranges past the packet. Then empties a pool
+ * and checks mp_num_fail, mp_min_free, os_mempool_stats_clear() and the
+ * values reported by os_mempool_info_get_next(). Finally reads 1 KB packets
+ * through the segments and through os_mbuf_copydata() and prints both rates.
+ *
+ * Links the real os_mbuf.c and os_mempool.c.
+ */
+
+#include "nimble/porting/nimble/include/syscfg/syscfg.h"
+#include "nimble/porting/nimble/include/os/os_mbuf.h"
+#include "nimble/porting/nimble/include/os/os_mempool.h"
+#include "host_test.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MBUF_COUNT      64
+#define MBUF_DATA       48
+#define MBUF_BLOCK_SIZE (MBUF_DATA + sizeof(struct os_mbuf) + \
+                         sizeof(struct os_mbuf_pkthdr))
+#define MAX_PKT         1024
+#define MAX_IOV         MBUF_COUNT
+
+static os_membuf_t mbuf_mem[OS_MEMPOOL_SIZE(MBUF_COUNT, MBUF_BLOCK_SIZE)];
+static struct os_mempool mbuf_mempool;
+static struct os_mbuf_pool mbuf_pool;
+
+/* Keeps the benchmarked sums */
+volatile unsigned bench_sink;
+
+/* A packet of random segments of 0..MBUF_DATA bytes, "data" holds its bytes */
+static struct os_mbuf *
+make_chain(uint8_t *data, int *len)
+{
+    struct os_mbuf *om;
+    struct os_mbuf *next;
+    uint16_t seg;
+    int i;
+
+    om = os_mbuf_get_pkthdr(&mbuf_pool, 0);
+    CHECK(om != NULL);
+
+    *len = 0;
+    while (*len < MAX_PKT - MBUF_DATA && rand() % 24 != 0) {
+        seg = rand() % (MBUF_DATA + 1);
+        if (rand() % 6 == 0) {
+            seg = 0;
+        }
+        for (i = 0; i < seg; i++) {
+            data[*len + i] = rand();
+        }
+        next = os_mbuf_get(&mbuf_pool, 0);
+        if (next == NULL) {
+            break;
+        }
+        memcpy(next->om_data, data + *len, seg);
+        next->om_len = seg;
+        os_mbuf_concat(om, next);
+        *len += seg;
+    }
+
+    return om;
+}
+
+/* The segments of a range, each inside one mbuf and in chain order */
+static void
+check_range(const struct os_mbuf *om, const uint8_t *data, int pkt_len,
+            int off, int len, int iov_cnt)
+{
+    struct os_mbuf_iovec iov[MAX_IOV];
+    const struct os_mbuf *cur;
+    int expect;
+    int pos;
+    int cnt;
+    int i;
+
+    /* One segment per mbuf with bytes in [off, off + len) */
+    expect = 0;
+    pos = 0;
+    for (cur = om; cur != NULL; cur = SLIST_NEXT(cur, om_next)) {
+        if (len > 0 && cur->om_len > 0 && pos + cur->om_len > off &&
+            pos < off + len) {
+            expect++;
+        }
+        pos += cur->om_len;
+    }
+
+    cnt = os_mbuf_to_iovec(om, off, len, iov, iov_cnt);
+    if (off + len > pkt_len) {
+        CHECK(cnt == -1);
+        return;
+    }
+    CHECK(cnt == expect);
+
+    pos = off;
+    for (i = 0; i < cnt && i < iov_cnt; i++) {
+        CHECK(iov[i].iov_len > 0);
+        CHECK(memcmp(iov[i].iov_base, data + pos, iov[i].iov_len) == 0);
+        pos += iov[i].iov_len;
+    }
+    if (cnt <= iov_cnt) {
+        CHECK(pos == off + len);
+    }
+}
+
+static void
+test_iovec(void)
+{
+    static uint8_t data[MAX_PKT];
+    static uint8_t copy[MAX_PKT];
+    struct os_mbuf *om;
+    int pkt_len;
+    int off;
+    int len;
+    int n;
+    int i;
+
+    for (n = 0; n < 20000; n++) {
+        om = make_chain(data, &pkt_len);
+        CHECK(OS_MBUF_PKTLEN(om) == pkt_len);
+        CHECK(os_mbuf_len(om) == pkt_len);
+        CHECK(os_mbuf_copydata(om, 0, pkt_len, copy) == 0);
+        CHECK(memcmp(copy, data, pkt_len) == 0);
+
+        for (i = 0; i < 8; i++) {
+            off = rand() % (pkt_len + 1);
+            len = rand() % (pkt_len - off + 1);
+            check_range(om, data, pkt_len, off, len, MAX_IOV);
+            check_range(om, data, pkt_len, off, len, rand() % 4);
+        }
+
+        /* Whole packet, empty ranges, and ranges past the end */
+        check_range(om, data, pkt_len, 0, pkt_len, MAX_IOV);
+        check_range(om, data, pkt_len, pkt_len, 0, MAX_IOV);
+        check_range(om, data, pkt_len, 0, pkt_len + 1, MAX_IOV);
+        check_range(om, data, pkt_len, pkt_len, 1, MAX_IOV);
+        CHECK(os_mbuf_to_iovec(om, 0, 0, NULL, 0) == 0);
+        CHECK(os_mbuf_to_iovec(om, pkt_len + 5, 1, NULL, 0) == -1);
+
+        os_mbuf_free_chain(om);
+        CHECK(mbuf_mempool.mp_num_free == MBUF_COUNT);
+    }
+}
+
+static void
+test_stats(void)
+{
+    struct os_mempool_info omi;
+    struct os_mempool *mp;
+    void *blocks[MBUF_COUNT];
+    int found;
+    int i;
+
+    os_mempool_stats_clear(&mbuf_mempool);
+    CHECK(mbuf_mempool.mp_num_fail == 0);
+    CHECK(mbuf_mempool.mp_min_free == MBUF_COUNT);
+
+    for (i = 0; i < MBUF_COUNT; i++) {
+        blocks[i] = os_memblock_get(&mbuf_mempool);
+        CHECK(blocks[i] != NULL);
+    }
+    CHECK(mbuf_mempool.mp_min_free == 0);
+    CHECK(mbuf_mempool.mp_num_fail == 0);
+
+    CHECK(os_memblock_get(&mbuf_mempool) == NULL);
+    CHECK(os_mbuf_get(&mbuf_pool, 0) == NULL);
+    CHECK(os_mbuf_get_pkthdr(&mbuf_pool, 0) == NULL);
+    CHECK(mbuf_mempool.mp_num_fail == 3);
+
+    found = 0;
+    mp = NULL;
+    while ((mp = os_mempool_info_get_next(mp, &omi)) != NULL) {
+        if (mp == &mbuf_mempool) {
+            CHECK(omi.omi_num_fail == 3);
+            CHECK(omi.omi_min_free == 0);
+            CHECK(omi.omi_num_free == 0);
+            CHECK(strcmp(omi.omi_name, "mbuf_test") == 0);
+            found = 1;
+        }
+    }
+    CHECK(found);
+
+    /* Saturates instead of wrapping */
+    for (i = 0; i < UINT16_MAX; i++) {
+        os_memblock_get(&mbuf_mempool);
+    }
+    CHECK(mbuf_mempool.mp_num_fail == UINT16_MAX);
+
+    for (i = 0; i < MBUF_COUNT / 2; i++) {
+        CHECK(os_memblock_put(&mbuf_mempool, blocks[i]) == 0);
+    }
+
+    /* A new period starts from the current use */
+    os_mempool_stats_clear(&mbuf_mempool);
+    CHECK(mbuf_mempool.mp_num_fail == 0);
+    CHECK(mbuf_mempool.mp_min_free == MBUF_COUNT / 2);
+
+    blocks[0] = os_memblock_get(&mbuf_mempool);
+    CHECK(mbuf_mempool.mp_min_free == MBUF_COUNT / 2 - 1);
+    CHECK(os_memblock_put(&mbuf_mempool, blocks[0]) == 0);
+    CHECK(mbuf_mempool.mp_min_free == MBUF_COUNT / 2 - 1);
+
+    for (i = MBUF_COUNT / 2; i < MBUF_COUNT; i++) {
+        CHECK(os_memblock_put(&mbuf_mempool, blocks[i]) == 0);
+    }
+    CHECK(mbuf_mempool.mp_num_free == MBUF_COUNT);
+    CHECK(mbuf_mempool.mp_num_fail == 0);
+}
+
+static double
+now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+bench(void)
+{
+    static uint8_t data[MAX_PKT];
+    static uint8_t copy[MAX_PKT];
+    struct os_mbuf_iovec iov[MAX_IOV];
+    struct os_mbuf *om;
+    double t_iov;
+    double t_copy;
+    double start;
+    unsigned sum;
+    int pkt_len;
+    int cnt;
+    int n;
+    int i;
+    int j;
+
+    do {
+        om = make_chain(data, &pkt_len);
+        if (pkt_len < 900) {
+            os_mbuf_free_chain(om);
+            om = NULL;
+        }
+    } while (om == NULL);
+
+    sum = 0;
+    start = now_sec();
+    for (n = 0; n < 200000; n++) {
+        cnt = os_mbuf_to_iovec(om, 0, pkt_len, iov, MAX_IOV);
+        for (i = 0; i < cnt; i++) {
+            for (j = 0; j < iov[i].iov_len; j++) {
+                sum += iov[i].iov_base[j];
+            }
+        }
+    }
+    t_iov = now_sec() - start;
+
+    start = now_sec();
+    for (n = 0; n < 200000; n++) {
+        os_mbuf_copydata(om, 0, pkt_len, copy);
+        for (j = 0; j < pkt_len; j++) {
+            sum -= copy[j];
+        }
+    }
+    t_copy = now_sec() - start;
+    CHECK(sum == 0);
+    bench_sink = sum;
+
+    printf("mbuf: %d byte packet, iovec %.0f MB/s, copydata %.0f MB/s\n",
+           pkt_len, 200000.0 * pkt_len / t_iov / 1e6,
+           200000.0 * pkt_len / t_copy / 1e6);
+
+    os_mbuf_free_chain(om);
+}
+
+int
+main(void)
+{
+    srand(1);
+
+    CHECK(os_mempool_init(&mbuf_mempool, MBUF_COUNT, MBUF_BLOCK_SIZE,
+                          mbuf_mem, "mbuf_test") == 0);
+    CHECK(os_mbuf_pool_init(&mbuf_pool, &mbuf_mempool, MBUF_BLOCK_SIZE,
+                            MBUF_COUNT) == 0);
+
+    test_iovec();
+    test_stats();
+    bench();
+
+    return hostTestResult("mbuf");
+}
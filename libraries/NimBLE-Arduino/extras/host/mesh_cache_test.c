@@ -0,0 +1,259 @@
+/*
+ * Host test of the hash indexed mesh network message cache and advertising
+ * duplicate cache.
+ *
+ * Runs random adds, lookups and removals of the last entry against a FIFO
+ * that is scanned linearly, the way the caches worked before the index. Then
+ * floods check_dup() and the message cache with 400k PDUs from 1000 origin
+ * nodes, each heard from up to 3 relays within a reordering window. The relay
+ * decisions are checked against the same scanned FIFOs, and the PDU rates of
+ * both are printed.
+ *
+ * The index is only built for caches of more than 64 entries, below that
+ * net.c scans too (bin/mesh_cache and bin/mesh_cache_1024).
+ *
+ * Includes net.c to reach its static caches and helpers. Build with
+ * MYNEWT_VAL_BLE_MESH_MSG_CACHE_SIZE and MYNEWT_VAL_BLE_MESH_MSG_CACHE_INDEX
+ * set to try other cache sizes.
+ */
+
+#include "nimble/nimble/host/mesh/src/net.c"
+#include "host_test.h"
+
+#include <stdlib.h>
+#include <time.h>
+
+#define CACHE_SIZE      MYNEWT_VAL(BLE_MESH_MSG_CACHE_SIZE)
+#define NUM_PDUS        400000
+#define NUM_NODES       1000
+#define PDU_LEN         29
+
+/* FIFO scanned linearly, the cache before the index */
+struct scan_cache {
+    uint32_t key[CACHE_SIZE];
+    bool used[CACHE_SIZE];
+    uint16_t next;
+};
+
+static bool
+scan_find(const struct scan_cache *cache, uint32_t key)
+{
+    int i;
+
+    for (i = 0; i < CACHE_SIZE; i++) {
+        if (cache->used[i] && cache->key[i] == key) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static uint16_t
+scan_add(struct scan_cache *cache, uint32_t key)
+{
+    uint16_t idx = cache->next;
+
+    cache->key[idx] = key;
+    cache->used[idx] = true;
+    cache->next = (idx + 1) % CACHE_SIZE;
+
+    return idx;
+}
+
+static void
+scan_remove(struct scan_cache *cache, uint16_t idx)
+{
+    cache->used[idx] = false;
+    cache->next = idx;
+}
+
+/* Keeps the benchmarked decisions */
+volatile int bench_sink;
+
+static uint8_t pdus[NUM_PDUS][PDU_LEN];
+
+static void
+test_ops(void)
+{
+    static struct scan_cache model;
+    uint32_t key;
+    uint16_t idx;
+    int i;
+
+    net_cache_reset(&msg_cache);
+    for (i = 0; i < 200000; i++) {
+        /* Small key space so that lookups hit, 0 is the empty entry */
+        key = 1 + rand() % (CACHE_SIZE * 3);
+
+        CHECK(net_cache_find(&msg_cache, key) == scan_find(&model, key));
+        if (scan_find(&model, key)) {
+            continue;
+        }
+
+        idx = net_cache_add(&msg_cache, key);
+        CHECK(idx == scan_add(&model, key));
+        CHECK(net_cache_find(&msg_cache, key));
+
+        /* Like a message rejected by the transport layer */
+        if (rand() % 8 == 0) {
+            net_cache_remove(&msg_cache, idx);
+            scan_remove(&model, idx);
+            CHECK(!net_cache_find(&msg_cache, key));
+        }
+    }
+
+    net_cache_reset(&msg_cache);
+    CHECK(!net_cache_find(&msg_cache, key));
+}
+
+/* Each origination is heard from up to 3 relays and delivered within a
+ * window of recent traffic, like a flood through a dense network.
+ */
+static void
+make_flood(void)
+{
+    static uint32_t seq[NUM_NODES + 1];
+    uint8_t tmp[PDU_LEN];
+    uint8_t *pdu;
+    uint32_t s;
+    int copies;
+    int src;
+    int n;
+    int i;
+    int j;
+    int k;
+
+    n = 0;
+    while (n < NUM_PDUS) {
+        src = 1 + rand() % NUM_NODES;
+        copies = 1 + rand() % 3;
+        s = ++seq[src];
+        for (k = 0; k < copies && n < NUM_PDUS; k++) {
+            pdu = pdus[n++];
+            for (j = 0; j < PDU_LEN; j++) {
+                pdu[j] = rand();
+            }
+            /* Each relay sends a different TTL and obfuscated tail */
+            pdu[1] = 5 - k;
+            sys_put_be24(s, &pdu[2]);
+            sys_put_be16(src, &pdu[5]);
+        }
+    }
+
+    for (i = 0; i + 1 < NUM_PDUS; i++) {
+        j = i + rand() % 8;
+        if (j < NUM_PDUS) {
+            memcpy(tmp, pdus[i], PDU_LEN);
+            memcpy(pdus[i], pdus[j], PDU_LEN);
+            memcpy(pdus[j], tmp, PDU_LEN);
+        }
+    }
+}
+
+/* The cache steps of bt_mesh_net_recv(), true if the PDU is relayed */
+static bool
+recv_indexed(uint8_t *data)
+{
+    struct os_mbuf om = { .om_data = data, .om_len = PDU_LEN };
+    struct bt_mesh_net_rx rx = { 0 };
+
+    if (check_dup(&om) || msg_cache_match(&om)) {
+        return false;
+    }
+
+    rx.ctx.addr = SRC(data);
+    rx.seq = SEQ(data);
+    msg_cache_add(&rx);
+
+    return true;
+}
+
+static bool
+recv_scan(struct scan_cache *dup, struct scan_cache *msg, const uint8_t *data)
+{
+    uint32_t val;
+    uint32_t key;
+
+    val = sys_get_be32(data + PDU_LEN - 4) ^ sys_get_be32(data + PDU_LEN - 8);
+    if (scan_find(dup, val)) {
+        return false;
+    }
+    scan_add(dup, val);
+
+    key = MSG_CACHE_KEY(SRC(data), SEQ(data));
+    if (scan_find(msg, key)) {
+        return false;
+    }
+    scan_add(msg, key);
+
+    return true;
+}
+
+static double
+now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+test_flood(void)
+{
+    static struct scan_cache dup;
+    static struct scan_cache msg;
+    double t_index;
+    double t_scan;
+    double start;
+    int relayed;
+    int i;
+
+    make_flood();
+
+    net_cache_reset(&dup_cache);
+    net_cache_reset(&msg_cache);
+    relayed = 0;
+    for (i = 0; i < NUM_PDUS; i++) {
+        bool a = recv_indexed(pdus[i]);
+
+        CHECK(a == recv_scan(&dup, &msg, pdus[i]));
+        relayed += a;
+    }
+    printf("mesh_cache: relayed %d of %d PDUs, cache size %d\n",
+           relayed, NUM_PDUS, CACHE_SIZE);
+
+    net_cache_reset(&dup_cache);
+    net_cache_reset(&msg_cache);
+    relayed = 0;
+    start = now_sec();
+    for (i = 0; i < NUM_PDUS; i++) {
+        relayed += recv_indexed(pdus[i]);
+    }
+    t_index = now_sec() - start;
+
+    memset(&dup, 0, sizeof dup);
+    memset(&msg, 0, sizeof msg);
+    start = now_sec();
+    for (i = 0; i < NUM_PDUS; i++) {
+        relayed += recv_scan(&dup, &msg, pdus[i]);
+    }
+    t_scan = now_sec() - start;
+    bench_sink = relayed;
+
+    printf("mesh_cache: net.c (index %d) %.1fM PDUs/s, linear scan %.1fM PDUs/s\n",
+           MYNEWT_VAL(BLE_MESH_MSG_CACHE_INDEX), NUM_PDUS / t_index / 1e6,
+           NUM_PDUS / t_scan / 1e6);
+}
+
+int
+main(void)
+{
+    srand(1);
+
+    test_ops();
+    test_flood();
+
+    return hostTestResult("mesh_cache");
+}
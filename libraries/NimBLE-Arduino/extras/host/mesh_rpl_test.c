@@ -0,0 +1,235 @@
+/*
+ * Host test of the source address index of the mesh replay protection list.
+ *
+ * Replays a stream of unicast messages from more sources than the list has
+ * entries, with repeated and stale sequence numbers, old IV index messages
+ * and IV index updates, through bt_mesh_rpl_check(). Each decision and the
+ * list contents are checked against a list that is scanned linearly for the
+ * source, and the check rates of both are printed.
+ *
+ * The index is only built for lists of 16 entries or more, below that rpl.c
+ * scans too (bin/mesh_rpl and bin/mesh_rpl_1024).
+ *
+ * Includes rpl.c to reach its static list. Build with MYNEWT_VAL_BLE_MESH_CRPL
+ * and MYNEWT_VAL_BLE_MESH_RPL_INDEX set to try other list sizes.
+ */
+
+#include "nimble/porting/nimble/include/logcfg/logcfg.h"
+
+/* The stream fills the list on purpose, drop the "RPL is full!" errors */
+#undef BLE_MESH_RPL_LOG_ERROR
+#define BLE_MESH_RPL_LOG_ERROR(...) IGNORE(__VA_ARGS__)
+
+#include "nimble/nimble/host/mesh/src/rpl.c"
+#include "host_test.h"
+
+#include <stdlib.h>
+#include <time.h>
+
+#define CRPL            MYNEWT_VAL(BLE_MESH_CRPL)
+#define NUM_MSGS        400000
+/* A few more sources than entries, so that the list fills up */
+#define NUM_NODES       (CRPL + CRPL / 4 + 1)
+
+struct scan_rpl {
+    uint16_t src;
+    bool old_iv;
+    uint32_t seq;
+};
+
+static struct scan_rpl model[CRPL];
+
+/* The check as a scan of the whole list, true if the message is rejected */
+static bool
+scan_check(const struct bt_mesh_net_rx *rx)
+{
+    struct scan_rpl *empty = NULL;
+    struct scan_rpl *rpl;
+    int i;
+
+    for (i = 0; i < CRPL; i++) {
+        rpl = &model[i];
+
+        if (!rpl->src) {
+            if (!empty) {
+                empty = rpl;
+            }
+            continue;
+        }
+
+        if (rpl->src == rx->ctx.addr) {
+            if (rx->old_iv && !rpl->old_iv) {
+                return true;
+            }
+
+            if ((!rx->old_iv && rpl->old_iv) || rpl->seq < rx->seq) {
+                rpl->seq = rx->seq;
+                rpl->old_iv = rx->old_iv;
+                return false;
+            }
+
+            return true;
+        }
+    }
+
+    if (empty) {
+        empty->src = rx->ctx.addr;
+        empty->seq = rx->seq;
+        empty->old_iv = rx->old_iv;
+        return false;
+    }
+
+    return true;
+}
+
+static void
+scan_reset(void)
+{
+    int i;
+
+    for (i = 0; i < CRPL; i++) {
+        if (model[i].old_iv) {
+            memset(&model[i], 0, sizeof model[i]);
+        } else {
+            model[i].old_iv = true;
+        }
+    }
+}
+
+static void
+check_list(void)
+{
+    int i;
+
+    for (i = 0; i < CRPL; i++) {
+        CHECK(replay_list[i].src == model[i].src);
+        if (model[i].src) {
+            CHECK(replay_list[i].seq == model[i].seq);
+            CHECK(replay_list[i].old_iv == model[i].old_iv);
+        }
+    }
+}
+
+/* Keeps the benchmarked decisions */
+volatile int bench_sink;
+
+static struct bt_mesh_net_rx msgs[NUM_MSGS];
+
+/* Mostly new sequence numbers, some repeated or stale, and after the first
+ * IV index update some messages still on the old IV index.
+ */
+static void
+make_msgs(void)
+{
+    static uint32_t seq[NUM_NODES + 1];
+    struct bt_mesh_net_rx *rx;
+    int src;
+    int i;
+
+    for (i = 0; i < NUM_MSGS; i++) {
+        rx = &msgs[i];
+        src = 1 + rand() % NUM_NODES;
+        rx->local_match = 1;
+        rx->ctx.addr = src;
+        if (rand() % 4 == 0 && seq[src] >= 2) {
+            rx->seq = seq[src] - rand() % 3;
+        } else {
+            rx->seq = ++seq[src];
+        }
+        rx->old_iv = i > NUM_MSGS / 4 && rand() % 16 == 0;
+    }
+}
+
+static bool
+is_iv_update(int i)
+{
+    return i == NUM_MSGS / 4 || i == NUM_MSGS / 2 || i == NUM_MSGS / 2 + 1000;
+}
+
+static void
+test_stream(void)
+{
+    int rejected;
+    int i;
+
+    bt_mesh_rpl_clear();
+    memset(model, 0, sizeof model);
+
+    rejected = 0;
+    for (i = 0; i < NUM_MSGS; i++) {
+        if (is_iv_update(i)) {
+            bt_mesh_rpl_reset();
+            scan_reset();
+            check_list();
+        }
+
+        bool a = bt_mesh_rpl_check(&msgs[i], NULL);
+
+        CHECK(a == scan_check(&msgs[i]));
+        rejected += a;
+        if (i % 1000 == 0) {
+            check_list();
+        }
+    }
+    check_list();
+
+    printf("mesh_rpl: rejected %d of %d messages, %d sources, CRPL %d\n",
+           rejected, NUM_MSGS, NUM_NODES, CRPL);
+}
+
+static double
+now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+bench(void)
+{
+    double t_index;
+    double t_scan;
+    double start;
+    int rejected;
+    int i;
+
+    bt_mesh_rpl_clear();
+    rejected = 0;
+    start = now_sec();
+    for (i = 0; i < NUM_MSGS; i++) {
+        if (is_iv_update(i)) {
+            bt_mesh_rpl_reset();
+        }
+        rejected += bt_mesh_rpl_check(&msgs[i], NULL);
+    }
+    t_index = now_sec() - start;
+
+    memset(model, 0, sizeof model);
+    start = now_sec();
+    for (i = 0; i < NUM_MSGS; i++) {
+        if (is_iv_update(i)) {
+            scan_reset();
+        }
+        rejected += scan_check(&msgs[i]);
+    }
+    t_scan = now_sec() - start;
+    bench_sink = rejected;
+
+    printf("mesh_rpl: rpl.c (index %d) %.1fM checks/s, linear scan %.1fM checks/s\n",
+           MYNEWT_VAL(BLE_MESH_RPL_INDEX), NUM_MSGS / t_index / 1e6,
+           NUM_MSGS / t_scan / 1e6);
+}
+
+int
+main(void)
+{
+    srand(1);
+
+    make_msgs();
+    test_stream();
+    bench();
+
+    return hostTestResult("mesh_rpl");
+}
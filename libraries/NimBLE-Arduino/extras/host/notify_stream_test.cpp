@@ -0,0 +1,233 @@
+/*
+ * Loopback test of NimBLENotifyStream.
+ *
+ * The notifications go to a simulated link instead of a radio. It shares a
+ * pool of host buffers with the stream and sends a configurable number of
+ * packets at each connection event on a simulated millisecond clock. A 1 kHz
+ * stream of 10 byte samples runs through an MTU exchange, a free link, a
+ * stalled and then congested link, a failed notification and a disconnect.
+ * Every accepted sample must arrive once and in order, unless a failed
+ * notification discarded it. The stream counters must match what the test
+ * saw. The delivered payload rate of each phase is printed, in simulated time.
+ *
+ * Includes NimBLENotifyStream.cpp with a stand-in for the characteristic.
+ */
+
+#include <cstdint>
+
+#define NIMBLE_CPP_CHARACTERISTIC_H_
+class NimBLECharacteristic {
+  public:
+    uint16_t getHandle() const { return 42; }
+};
+
+#include "NimBLENotifyStream.cpp"
+#include "host_test.h"
+
+#include <deque>
+
+static const uint16_t connHandle = 1;
+
+/* The simulated link */
+static uint32_t                         nowMs;
+static bool                             connected = true;
+static uint16_t                         mtu       = BLE_ATT_MTU_DFLT;
+static uint16_t                         connItvl  = 6; // 7.5 ms
+static int                              txPerEvent = 6;
+static int                              freeBufs   = 8;
+static int                              failNext;      // error for the next notification
+static uint32_t                         nextEventUs;
+static std::deque<std::vector<uint8_t>> txQueue;
+static std::vector<uint8_t>             received;
+
+extern "C" {
+TickType_t xTaskGetTickCountFromISR(void) {
+    return nowMs;
+}
+
+int ble_gap_conn_find(uint16_t handle, struct ble_gap_conn_desc* desc) {
+    if (!connected || handle != connHandle) {
+        return BLE_HS_ENOTCONN;
+    }
+    desc->conn_itvl = connItvl;
+    return 0;
+}
+
+uint16_t ble_att_mtu(uint16_t handle) {
+    return connected && handle == connHandle ? mtu : 0;
+}
+
+/* The mbuf only carries the payload to ble_gattc_notify_custom() */
+struct os_mbuf* ble_hs_mbuf_from_flat(const void* buf, uint16_t len) {
+    if (freeBufs == 0) {
+        return nullptr;
+    }
+    freeBufs--;
+    auto data = static_cast<const uint8_t*>(buf);
+    return reinterpret_cast<os_mbuf*>(new std::vector<uint8_t>(data, data + len));
+}
+
+int ble_gattc_notify_custom(uint16_t handle, uint16_t attrHandle, struct os_mbuf* om) {
+    auto payload = reinterpret_cast<std::vector<uint8_t>*>(om);
+    int  rc      = 0;
+
+    CHECK(handle == connHandle && attrHandle == 42);
+    CHECK(payload->size() <= static_cast<size_t>(mtu - 3));
+    if (!connected) {
+        rc = BLE_HS_ENOTCONN;
+    } else if (failNext) {
+        rc       = failNext;
+        failNext = 0;
+    } else if (freeBufs == 0) {
+        // No buffer left for the ACL packet
+        rc = BLE_HS_ENOMEM;
+    }
+
+    if (rc == 0) {
+        txQueue.push_back(*payload);
+    } else {
+        freeBufs++;
+    }
+    delete payload;
+    return rc;
+}
+}
+
+const char* NimBLEUtils::returnCodeToString(int) {
+    return "";
+}
+
+/* Sends up to txPerEvent packets at each connection event that has passed */
+static void linkTick() {
+    while (nowMs * 1000 >= nextEventUs) {
+        nextEventUs += connItvl * 1250;
+        for (int i = 0; i < txPerEvent && !txQueue.empty(); i++) {
+            auto& p = txQueue.front();
+            received.insert(received.end(), p.begin(), p.end());
+            txQueue.pop_front();
+            freeBufs++;
+        }
+    }
+}
+
+struct __attribute__((packed)) Sample {
+    uint32_t seq;
+    int16_t  x, y, z;
+};
+
+static std::vector<uint32_t> expected; // accepted samples, in order
+static uint32_t              rejected;
+static uint32_t              seq;
+
+/* Streams one sample per millisecond for ms milliseconds */
+static void run(NimBLENotifyStream& stream, uint32_t ms, const char* phase) {
+    size_t start = received.size();
+    for (uint32_t end = nowMs + ms; nowMs < end; nowMs++) {
+        Sample s{seq, 1, 2, 3};
+        if (stream.write(s)) {
+            expected.push_back(seq);
+        } else {
+            rejected++;
+        }
+        seq++;
+        linkTick();
+    }
+    printf("notify_stream: %-20s %6.1f KB/s\n", phase, (received.size() - start) / static_cast<double>(ms));
+}
+
+/* Lets the link drain what the stream holds */
+static void drain(NimBLENotifyStream& stream) {
+    for (int i = 0; i < 100; i++) {
+        nowMs++;
+        stream.flush();
+        linkTick();
+    }
+    CHECK(stream.getBufferedLength() == 0);
+    CHECK(txQueue.empty());
+}
+
+/* Each sample arrived once and in order, or was discarded by a failed send */
+static void checkReceived(const std::vector<uint32_t>& discarded) {
+    CHECK(received.size() % sizeof(Sample) == 0);
+    size_t n = received.size() / sizeof(Sample);
+    CHECK(n + discarded.size() == expected.size());
+
+    size_t d = 0;
+    size_t i = 0;
+    for (uint32_t want : expected) {
+        if (d < discarded.size() && discarded[d] == want) {
+            d++;
+            continue;
+        }
+        if (i == n) {
+            break;
+        }
+        Sample s;
+        memcpy(&s, &received[i++ * sizeof(Sample)], sizeof(s));
+        CHECK(s.seq == want && s.x == 1 && s.z == 3);
+    }
+}
+
+int main() {
+    NimBLECharacteristic chr;
+    NimBLENotifyStream   stream(&chr, connHandle, 4);
+    std::vector<uint32_t> discarded;
+
+    run(stream, 1000, "MTU 23");
+    CHECK(stream.getPayloadSize() == 20);
+
+    // The payload size follows the exchanged MTU once the buffer is empty
+    mtu = 247;
+    run(stream, 3000, "free link");
+    CHECK(stream.getPayloadSize() == 244);
+
+    // The controller stops for 200 ms and then sends one packet per event
+    txPerEvent = 0;
+    run(stream, 200, "stalled link");
+    txPerEvent = 1;
+    run(stream, 1000, "congested link");
+    CHECK(stream.getStats().stalls > 0);
+    CHECK(rejected > 0);
+    txPerEvent = 6;
+    drain(stream);
+
+    // Out of buffers, the full notification stays buffered
+    int bufs = freeBufs;
+    freeBufs = 0;
+    for (int i = 0; i < 24; i++) {
+        Sample s{seq, 1, 2, 3};
+        CHECK(stream.write(s));
+        discarded.push_back(seq++);
+    }
+    CHECK(stream.getBufferedLength() == 240);
+    expected.insert(expected.end(), discarded.begin(), discarded.end());
+
+    // The next sample sends it and the send fails, the samples are discarded but the new one is kept
+    freeBufs = bufs;
+    nowMs   += 10;
+    failNext = BLE_HS_EINVAL;
+    uint32_t dropped = stream.getStats().dropped;
+    Sample   s{seq, 1, 2, 3};
+    CHECK(stream.write(s));
+    expected.push_back(seq++);
+    CHECK(stream.getStats().errors == 1);
+    CHECK(stream.getStats().dropped == dropped);
+    CHECK(stream.getBufferedLength() == sizeof(Sample));
+    drain(stream);
+
+    checkReceived(discarded);
+    auto& stats = stream.getStats();
+    CHECK(stats.samples == expected.size());
+    CHECK(stats.dropped == rejected);
+    CHECK(stats.bytes == received.size());
+
+    // Disconnected, every sample is dropped
+    connected = false;
+    for (int i = 0; i < 10; i++) {
+        Sample s{seq++, 1, 2, 3};
+        CHECK(!stream.write(s));
+    }
+    CHECK(stream.getStats().dropped == rejected + 10);
+
+    return hostTestResult("notify_stream");
+}
@@ -0,0 +1,296 @@
+/*
+ * Host test of the RPA cache of the controller resolving list.
+ *
+ * Replays a stream of advertisement addresses through
+ * ble_ll_resolv_peer_rpa_any() and ble_ll_resolv_rpa_rl(): 20 known peers
+ * with 16 of them on the resolving list, a few busy ones, rotating RPAs,
+ * strangers, list changes and RPA timeouts. Each result is checked against
+ * a scan of the whole list without the cache. The AES blocks per packet of
+ * both are printed. The block cipher is a counting stand-in, only the
+ * number of blocks matters here.
+ *
+ * Includes ble_ll_resolv.c to reach its static data. Build with
+ * MYNEWT_VAL_BLE_LL_RESOLV_RPA_CACHE_SIZE set to try other cache sizes.
+ */
+
+#include "nimble/nimble/controller/src/ble_ll_resolv.c"
+#include "host_test.h"
+
+#include <stdio.h>
+
+#define NUM_PKTS        200000
+#define NUM_PEERS       20
+#define NUM_BONDED      16
+#define NUM_STRANGERS   300
+
+struct ble_ll_obj g_ble_ll_data;
+
+static unsigned long aes_blocks;
+static ble_npl_event_fn *rpa_timer_fn;
+static uint32_t seed = 1;
+
+static uint8_t
+rnd(void)
+{
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 16;
+}
+
+static uint32_t
+rnd32(void)
+{
+    return ((uint32_t)rnd() << 16) | ((uint32_t)rnd() << 8) | rnd();
+}
+
+/* Not AES, but a keyed mix with the same interface */
+int
+ble_hw_encrypt_block(struct ble_encryption_block *ecb)
+{
+    uint32_t h = 2166136261u;
+    int i;
+
+    aes_blocks++;
+    for (i = 0; i < 16; i++) {
+        h = (h ^ ecb->key[i]) * 16777619u;
+    }
+    for (i = 0; i < 16; i++) {
+        h = (h ^ ecb->plain_text[i]) * 16777619u;
+        ecb->cipher_text[i] = h >> 24;
+    }
+    return 0;
+}
+
+int ble_hw_resolv_list_add(uint8_t *irk) { return 0; }
+void ble_hw_resolv_list_clear(void) {}
+void ble_hw_resolv_list_rmv(int index) {}
+uint8_t ble_hw_resolv_list_size(void) { return MYNEWT_VAL(BLE_LL_RESOLV_LIST_SIZE); }
+int ble_ll_is_busy(unsigned int flags) { return 0; }
+void ble_ll_adv_rpa_timeout(void) {}
+
+void
+ble_ll_rand_prand_get(uint8_t *prand)
+{
+    prand[0] = rnd();
+    prand[1] = rnd();
+    prand[2] = (rnd() & 0x3f) | 0x40;
+}
+
+int
+npl_freertos_callout_init(struct ble_npl_callout *co, struct ble_npl_eventq *evq,
+                          ble_npl_event_fn *ev_cb, void *ev_arg)
+{
+    rpa_timer_fn = ev_cb;
+    return 0;
+}
+
+ble_npl_error_t
+npl_freertos_callout_reset(struct ble_npl_callout *co, ble_npl_time_t ticks)
+{
+    return 0;
+}
+
+void npl_freertos_callout_stop(struct ble_npl_callout *co) {}
+void vPortEnterCritical(void) {}
+void vPortExitCritical(void) {}
+
+void
+swap_buf(uint8_t *dst, const uint8_t *src, int len)
+{
+    int i;
+
+    for (i = 0; i < len; i++) {
+        dst[i] = src[len - 1 - i];
+    }
+}
+
+static uint8_t peer_id[NUM_PEERS][6];
+static uint8_t peer_irk[NUM_PEERS][16];
+static uint8_t peer_rpa[NUM_PEERS][6];
+static bool peer_listed[NUM_PEERS];
+static uint8_t stranger_rpa[NUM_STRANGERS][6];
+
+static void
+list_add(int p)
+{
+    struct ble_hci_le_add_resolv_list_cp cmd;
+    int i;
+
+    cmd.peer_addr_type = BLE_ADDR_PUBLIC;
+    memcpy(cmd.peer_id_addr, peer_id[p], 6);
+    memcpy(cmd.peer_irk, peer_irk[p], 16);
+    for (i = 0; i < 16; i++) {
+        cmd.local_irk[i] = (p & 1) ? 0 : 0x11 + i;
+    }
+    if (ble_ll_resolv_list_add((uint8_t *)&cmd, sizeof(cmd)) == 0) {
+        peer_listed[p] = true;
+    }
+}
+
+static void
+list_rmv(int p)
+{
+    struct ble_hci_le_rmv_resolve_list_cp cmd;
+
+    cmd.peer_addr_type = BLE_ADDR_PUBLIC;
+    memcpy(cmd.peer_id_addr, peer_id[p], 6);
+    if (ble_ll_resolv_list_rmv((uint8_t *)&cmd, sizeof(cmd)) == 0) {
+        peer_listed[p] = false;
+    }
+}
+
+/* A new RPA of the peer, the list keeps the IRKs byte swapped */
+static void
+new_rpa(int p)
+{
+    struct ble_encryption_block ecb;
+    uint8_t *rpa = peer_rpa[p];
+
+    rpa[3] = rnd();
+    rpa[4] = rnd();
+    rpa[5] = (rnd() & 0x3f) | 0x40;
+
+    swap_buf(ecb.key, peer_irk[p], 16);
+    memset(ecb.plain_text, 0, 16);
+    ecb.plain_text[15] = rpa[3];
+    ecb.plain_text[14] = rpa[4];
+    ecb.plain_text[13] = rpa[5];
+    ble_hw_encrypt_block(&ecb);
+    aes_blocks--;
+
+    rpa[0] = ecb.cipher_text[15];
+    rpa[1] = ecb.cipher_text[14];
+    rpa[2] = ecb.cipher_text[13];
+}
+
+/* The resolving list index without the cache, counting its AES blocks */
+static int
+scan_resolve(const uint8_t *rpa, unsigned long *blocks)
+{
+    unsigned long saved = aes_blocks;
+    int i;
+
+    for (i = 0; i < g_ble_ll_resolv_data.rl_cnt_hw; i++) {
+        if (ble_ll_resolv_rpa(rpa, g_ble_ll_resolv_list[i].rl_peer_irk)) {
+            break;
+        }
+    }
+    *blocks += aes_blocks - saved;
+    aes_blocks = saved;
+
+    return i == g_ble_ll_resolv_data.rl_cnt_hw ? -1 : i;
+}
+
+/* ble_ll_resolv_rpa() without counting its AES block */
+static int
+resolv_rpa_uncounted(const uint8_t *rpa, const uint8_t *irk)
+{
+    unsigned long saved = aes_blocks;
+    int rc;
+
+    rc = ble_ll_resolv_rpa(rpa, irk);
+    aes_blocks = saved;
+    return rc;
+}
+
+int
+main(void)
+{
+    unsigned long scan_blocks = 0;
+    unsigned long resolved = 0;
+    unsigned long saved;
+    const uint8_t *rpa;
+    unsigned ev;
+    int expected;
+    int idx;
+    int p;
+    int i;
+    int k;
+
+    ble_ll_resolv_init();
+    for (p = 0; p < NUM_PEERS; p++) {
+        for (i = 0; i < 6; i++) {
+            peer_id[p][i] = rnd();
+        }
+        for (i = 0; i < 16; i++) {
+            peer_irk[p][i] = rnd();
+        }
+        new_rpa(p);
+    }
+    for (p = 0; p < NUM_BONDED; p++) {
+        list_add(p);
+    }
+    for (i = 0; i < NUM_STRANGERS; i++) {
+        for (k = 0; k < 6; k++) {
+            stranger_rpa[i][k] = rnd();
+        }
+        stranger_rpa[i][5] = (stranger_rpa[i][5] & 0x3f) | 0x40;
+    }
+
+    aes_blocks = 0;
+    for (k = 0; k < NUM_PKTS; k++) {
+        ev = rnd32() % 10000;
+
+        if (ev < 2) {
+            rpa_timer_fn(NULL);
+            continue;
+        }
+        if (ev < 4) {
+            p = rnd() % NUM_PEERS;
+            if (peer_listed[p]) {
+                list_rmv(p);
+            } else {
+                list_add(p);
+            }
+            continue;
+        }
+
+        if (ev < 40) {
+            new_rpa(rnd() % NUM_PEERS);
+        }
+        if (ev < 6000) {
+            /* A few busy peers */
+            p = rnd() % 8;
+            rpa = peer_rpa[p];
+        } else if (ev < 7000) {
+            p = rnd() % NUM_PEERS;
+            rpa = peer_rpa[p];
+        } else {
+            /* Strangers, a few of them are around for a while */
+            p = -1;
+            rpa = stranger_rpa[rnd32() % (ev < 9500 ? 6 : NUM_STRANGERS)];
+        }
+
+        expected = scan_resolve(rpa, &scan_blocks);
+        idx = ble_ll_resolv_peer_rpa_any(rpa);
+        CHECK(idx == expected);
+        if (p >= 0 && peer_listed[p]) {
+            CHECK(idx >= 0 && memcmp(g_ble_ll_resolv_list[idx].rl_identity_addr, peer_id[p], 6) == 0);
+        } else {
+            CHECK(idx < 0);
+        }
+        if (idx < 0) {
+            continue;
+        }
+        resolved++;
+
+        /* The single entry check agrees, for the peer IRK and for the local
+         * one. Not counted, the scanner does these only for some packets.
+         */
+        saved = aes_blocks;
+        CHECK(ble_ll_resolv_rpa_rl(rpa, idx, 0) == 1);
+        i = (idx + 1) % g_ble_ll_resolv_data.rl_cnt_hw;
+        CHECK(ble_ll_resolv_rpa_rl(rpa, i, 0) ==
+              resolv_rpa_uncounted(rpa, g_ble_ll_resolv_list[i].rl_peer_irk));
+        if ((k & 7) == 0) {
+            CHECK(ble_ll_resolv_rpa_rl(rpa, idx, 1) ==
+                  resolv_rpa_uncounted(rpa, g_ble_ll_resolv_list[idx].rl_local_irk));
+        }
+        aes_blocks = saved;
+    }
+
+    printf("rpa_cache: %d packets, %lu resolved, AES blocks per packet %.2f with %d cache entries, "
+           "%.2f without\n", NUM_PKTS, resolved, (double)aes_blocks / NUM_PKTS,
+           MYNEWT_VAL(BLE_LL_RESOLV_RPA_CACHE_SIZE), (double)scan_blocks / NUM_PKTS);
+
+    return hostTestResult("rpa_cache");
+}
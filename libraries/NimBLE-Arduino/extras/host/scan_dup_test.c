@@ -0,0 +1,466 @@
+/*
+ * Host test of the duplicate filter of the controller scanner.
+ *
+ * Fills the filter and checks that advertisers looked up again survive the
+ * clock hand while those seen once are evicted. Then replays a stream of
+ * legacy advertising reports through ble_ll_scan_dup_check_legacy() and
+ * ble_ll_scan_dup_update_legacy(): a few busy advertisers, many passing ones,
+ * ADV_IND, ADV_DIRECT_IND and SCAN_RSP PDUs. Each result, the table slots and
+ * the hit, miss and eviction counts are checked against a model of the clock,
+ * the hash buckets are walked regularly. Finally the statistics are read
+ * with ble_ll_scan_dup_stats_read() and the BLE_HCI_OCF_VS_RD_SCAN_DUP_STATS
+ * vendor command, with and without clearing, and the lookup rate is printed.
+ *
+ * Includes ble_ll_scan.c and ble_ll_hci_vs.c to reach the static filter and
+ * command handler. Build with MYNEWT_VAL_BLE_LL_NUM_SCAN_DUP_ADVS set to try
+ * other filter sizes.
+ */
+
+#include "nimble/nimble/controller/src/ble_ll_scan.c"
+#include "nimble/nimble/controller/src/ble_ll_hci_vs.c"
+#include "host_test.h"
+
+#include <endian.h>
+#include <time.h>
+
+#define DUP_NUM         MYNEWT_VAL(BLE_LL_NUM_SCAN_DUP_ADVS)
+#define NUM_BUSY        (DUP_NUM / 4 + 1)
+#define NUM_ADVS        (4 * DUP_NUM)
+#define NUM_PKTS        500000
+#define BENCH_PKTS      5000000
+
+int8_t g_ble_ll_tx_power;
+int8_t g_ble_ll_tx_power_compensation;
+
+struct ble_ll_conn_sm *ble_ll_conn_find_by_handle(uint16_t handle) { return NULL; }
+int ble_ll_hci_check_dle(uint16_t max_octets, uint16_t max_time) { return 0; }
+int ble_ll_conn_set_data_len(struct ble_ll_conn_sm *connsm, uint16_t tx_octets,
+                             uint16_t tx_time, uint16_t rx_octets,
+                             uint16_t rx_time) { return 0; }
+int ble_ll_is_busy(unsigned int flags) { return 0; }
+int ble_ll_tx_power_round(int tx_power) { return tx_power; }
+int ble_hw_get_static_addr(ble_addr_t *addr) { return -1; }
+void vPortEnterCritical(void) {}
+void vPortExitCritical(void) {}
+
+/* Keeps the benchmarked lookups */
+volatile int bench_sink;
+
+/* The filter as a plain table with the same clock */
+struct model_entry {
+    uint8_t type;
+    uint8_t addr[BLE_DEV_ADDR_LEN];
+    uint8_t flags;
+    uint8_t ref;
+};
+
+static struct model_entry model[DUP_NUM];
+static int model_cnt;
+static int model_hand;
+static struct ble_ll_scan_dup_stats model_stats;
+
+static uint32_t seed = 3;
+
+static uint32_t
+rnd(void)
+{
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+}
+
+static void
+adv_addr(int adv, uint8_t *addr_type, uint8_t *addr)
+{
+    uint32_t h = adv * 2654435761u;
+
+    *addr_type = adv & 1;
+    addr[0] = h;
+    addr[1] = h >> 8;
+    addr[2] = h >> 16;
+    addr[3] = h >> 24;
+    addr[4] = adv;
+    addr[5] = 0xc0 | (adv >> 8);
+}
+
+static uint8_t
+pdu_flag(uint8_t pdu_type)
+{
+    switch (pdu_type) {
+    case BLE_ADV_PDU_TYPE_ADV_DIRECT_IND:
+        return BLE_LL_SCAN_DUP_F_DIR_ADV_REPORT_SENT;
+    case BLE_ADV_PDU_TYPE_SCAN_RSP:
+        return BLE_LL_SCAN_DUP_F_SCAN_RSP_SENT;
+    default:
+        return BLE_LL_SCAN_DUP_F_ADV_REPORT_SENT;
+    }
+}
+
+/* Expected result of ble_ll_scan_dup_check_legacy(), updates the model */
+static int
+model_check(uint8_t addr_type, const uint8_t *addr, uint8_t pdu_type)
+{
+    struct model_entry *e;
+    uint8_t type;
+    int i;
+
+    type = BLE_LL_SCAN_ENTRY_TYPE_LEGACY(addr_type);
+    for (i = 0; i < model_cnt; i++) {
+        e = &model[i];
+        if (e->type == type && !memcmp(e->addr, addr, BLE_DEV_ADDR_LEN)) {
+            model_stats.hits++;
+            e->ref = 1;
+            return (e->flags & pdu_flag(pdu_type)) != 0;
+        }
+    }
+
+    if (model_cnt < DUP_NUM) {
+        i = model_cnt++;
+    } else {
+        while (model[model_hand].ref) {
+            model[model_hand].ref = 0;
+            model_hand = (model_hand + 1) % DUP_NUM;
+        }
+        i = model_hand;
+        model_hand = (model_hand + 1) % DUP_NUM;
+        model_stats.evictions++;
+    }
+    model_stats.misses++;
+
+    e = &model[i];
+    memset(e, 0, sizeof(*e));
+    e->type = type;
+    memcpy(e->addr, addr, BLE_DEV_ADDR_LEN);
+
+    return 0;
+}
+
+static void
+model_update(uint8_t addr_type, const uint8_t *addr, uint8_t pdu_type)
+{
+    int i;
+
+    for (i = 0; i < model_cnt; i++) {
+        if (model[i].type == BLE_LL_SCAN_ENTRY_TYPE_LEGACY(addr_type) &&
+            !memcmp(model[i].addr, addr, BLE_DEV_ADDR_LEN)) {
+            model[i].flags |= pdu_flag(pdu_type);
+        }
+    }
+}
+
+static void
+model_clear(void)
+{
+    model_cnt = 0;
+    model_hand = 0;
+}
+
+/* Like ble_ll_scan_send_adv_report() after a check which found no report */
+static void
+report_sent(uint8_t addr_type, const uint8_t *addr, uint8_t pdu_type)
+{
+    uint8_t subev;
+    uint8_t evtype;
+
+    subev = BLE_HCI_LE_SUBEV_ADV_RPT;
+    evtype = BLE_HCI_ADV_RPT_EVTYPE_ADV_IND;
+    if (pdu_type == BLE_ADV_PDU_TYPE_ADV_DIRECT_IND) {
+        subev = BLE_HCI_LE_SUBEV_DIRECT_ADV_RPT;
+    } else if (pdu_type == BLE_ADV_PDU_TYPE_SCAN_RSP) {
+        evtype = BLE_HCI_ADV_RPT_EVTYPE_SCAN_RSP;
+    }
+
+    ble_ll_scan_dup_update_legacy(addr_type, addr, subev, evtype);
+    model_update(addr_type, addr, pdu_type);
+}
+
+/* One report through the filter and the model */
+static int
+scan_adv(int adv, uint8_t pdu_type)
+{
+    uint8_t addr[BLE_DEV_ADDR_LEN];
+    uint8_t addr_type;
+    int expect;
+    int rc;
+
+    adv_addr(adv, &addr_type, addr);
+    expect = model_check(addr_type, addr, pdu_type);
+    rc = ble_ll_scan_dup_check_legacy(addr_type, addr, pdu_type) != 0;
+    CHECK(rc == expect);
+    if (!rc) {
+        report_sent(addr_type, addr, pdu_type);
+    }
+
+    return rc;
+}
+
+/* Each entry in use is in the bucket of its type and address, once */
+static void
+check_buckets(void)
+{
+    static uint8_t seen[DUP_NUM];
+    uint16_t idx;
+    int linked;
+    int b;
+
+    memset(seen, 0, sizeof(seen));
+    linked = 0;
+    for (b = 0; b < BLE_LL_SCAN_DUP_HASH_SIZE; b++) {
+        for (idx = g_scan_dup_hash[b]; idx != BLE_LL_SCAN_DUP_IDX_NONE;
+             idx = g_scan_dup_tbl[idx].next) {
+            CHECK(idx < g_scan_dup_cnt);
+            if (idx >= g_scan_dup_cnt || seen[idx]) {
+                CHECK(idx >= g_scan_dup_cnt || !seen[idx]);
+                return;
+            }
+            seen[idx] = 1;
+            CHECK(ble_ll_scan_dup_hash(g_scan_dup_tbl[idx].type,
+                                       g_scan_dup_tbl[idx].addr) == b);
+            linked++;
+        }
+    }
+    CHECK(linked == g_scan_dup_cnt);
+}
+
+/* Same advertisers in the same slots, same clock hand */
+static void
+check_model(void)
+{
+    int i;
+
+    CHECK(g_scan_dup_cnt == model_cnt);
+    CHECK(g_scan_dup_cnt < DUP_NUM || g_scan_dup_hand == model_hand);
+    for (i = 0; i < model_cnt; i++) {
+        CHECK(g_scan_dup_tbl[i].type == model[i].type);
+        CHECK(!memcmp(g_scan_dup_tbl[i].addr, model[i].addr, BLE_DEV_ADDR_LEN));
+        CHECK((g_scan_dup_tbl[i].flags & ~BLE_LL_SCAN_DUP_F_REFERENCED) ==
+              model[i].flags);
+    }
+}
+
+static void
+check_stats(void)
+{
+    struct ble_ll_scan_dup_stats stats;
+
+    CHECK(ble_ll_scan_dup_stats_read(&stats, 0) == model_cnt);
+    CHECK(stats.hits == model_stats.hits);
+    CHECK(stats.misses == model_stats.misses);
+    CHECK(stats.evictions == model_stats.evictions);
+}
+
+/* Advertisers found again get another round, new ones are evicted first */
+static void
+test_clock(void)
+{
+    int adv;
+
+    for (adv = 0; adv < DUP_NUM; adv++) {
+        CHECK(scan_adv(adv, BLE_ADV_PDU_TYPE_ADV_IND) == 0);
+    }
+    CHECK(g_scan_dup_cnt == DUP_NUM);
+    check_buckets();
+
+    /* Second report of the first half is filtered, the scan response not */
+    for (adv = 0; adv < DUP_NUM / 2; adv++) {
+        CHECK(scan_adv(adv, BLE_ADV_PDU_TYPE_ADV_IND) == 1);
+        CHECK(scan_adv(adv, BLE_ADV_PDU_TYPE_SCAN_RSP) == 0);
+        CHECK(scan_adv(adv, BLE_ADV_PDU_TYPE_SCAN_RSP) == 1);
+        CHECK(scan_adv(adv, BLE_ADV_PDU_TYPE_ADV_DIRECT_IND) == 0);
+    }
+
+    /* New advertisers take the slots of the second half */
+    for (adv = DUP_NUM; adv < DUP_NUM + (DUP_NUM + 1) / 2; adv++) {
+        CHECK(scan_adv(adv, BLE_ADV_PDU_TYPE_ADV_IND) == 0);
+    }
+    CHECK(g_scan_dup_cnt == DUP_NUM);
+    check_buckets();
+    check_model();
+    for (adv = 0; adv < DUP_NUM / 2; adv++) {
+        CHECK(scan_adv(adv, BLE_ADV_PDU_TYPE_ADV_IND) == 1);
+    }
+    CHECK(model_stats.evictions == (DUP_NUM + 1) / 2);
+    check_stats();
+
+    /* Evicted advertisers are reported again */
+    CHECK(scan_adv(DUP_NUM - 1, BLE_ADV_PDU_TYPE_ADV_IND) == 0);
+    check_model();
+}
+
+/* Busy advertisers among many passing ones */
+static void
+test_stream(void)
+{
+    static const uint8_t pdus[] = {
+        BLE_ADV_PDU_TYPE_ADV_IND, BLE_ADV_PDU_TYPE_ADV_IND,
+        BLE_ADV_PDU_TYPE_SCAN_RSP, BLE_ADV_PDU_TYPE_ADV_DIRECT_IND,
+    };
+    unsigned long busy_reports;
+    unsigned long busy_pkts;
+    int adv;
+    int n;
+
+    busy_pkts = 0;
+    busy_reports = 0;
+    for (n = 0; n < NUM_PKTS; n++) {
+        if (rnd() % 2) {
+            adv = rnd() % NUM_BUSY;
+            busy_pkts++;
+            busy_reports += !scan_adv(adv, pdus[rnd() % 4]);
+        } else {
+            adv = NUM_BUSY + rnd() % NUM_ADVS;
+            scan_adv(adv, pdus[rnd() % 4]);
+        }
+
+        if (n % 997 == 0) {
+            check_buckets();
+            check_model();
+        }
+        if (n == NUM_PKTS / 2) {
+            /* Like a new scan with filtering */
+            ble_ll_scan_dup_clear();
+            model_clear();
+            check_buckets();
+        }
+    }
+    check_buckets();
+    check_model();
+    check_stats();
+
+    printf("scan_dup: %d entries, %d busy of %d advertisers, %lu of %lu busy reports passed\n",
+           DUP_NUM, NUM_BUSY, NUM_BUSY + NUM_ADVS, busy_reports, busy_pkts);
+}
+
+static void
+test_stats_cmd(void)
+{
+    struct ble_hci_vs_rd_scan_dup_stats_cp cmd;
+    struct ble_hci_vs_rd_scan_dup_stats_rp rsp;
+    struct ble_ll_scan_dup_stats stats;
+    uint8_t rsplen;
+
+    ble_ll_hci_vs_init();
+
+    cmd.clear = 0;
+    rsplen = 0;
+    CHECK(ble_ll_hci_vs_cmd_proc((uint8_t *)&cmd, sizeof(cmd),
+                                 BLE_HCI_OCF_VS_RD_SCAN_DUP_STATS,
+                                 (uint8_t *)&rsp, &rsplen) == BLE_ERR_SUCCESS);
+    CHECK(rsplen == sizeof(rsp));
+    CHECK(le32toh(rsp.hits) == model_stats.hits);
+    CHECK(le32toh(rsp.misses) == model_stats.misses);
+    CHECK(le32toh(rsp.evictions) == model_stats.evictions);
+    CHECK(le16toh(rsp.capacity) == DUP_NUM);
+    CHECK(le16toh(rsp.count) == model_cnt);
+
+    /* Reads and restarts the counts, the advertisers stay */
+    cmd.clear = 1;
+    CHECK(ble_ll_hci_vs_cmd_proc((uint8_t *)&cmd, sizeof(cmd),
+                                 BLE_HCI_OCF_VS_RD_SCAN_DUP_STATS,
+                                 (uint8_t *)&rsp, &rsplen) == BLE_ERR_SUCCESS);
+    CHECK(le32toh(rsp.hits) == model_stats.hits);
+    CHECK(le32toh(rsp.evictions) == model_stats.evictions);
+    memset(&model_stats, 0, sizeof(model_stats));
+    check_stats();
+
+    scan_adv(0, BLE_ADV_PDU_TYPE_ADV_IND);
+    scan_adv(NUM_BUSY + NUM_ADVS, BLE_ADV_PDU_TYPE_ADV_IND);
+    cmd.clear = 0;
+    CHECK(ble_ll_hci_vs_cmd_proc((uint8_t *)&cmd, sizeof(cmd),
+                                 BLE_HCI_OCF_VS_RD_SCAN_DUP_STATS,
+                                 (uint8_t *)&rsp, &rsplen) == BLE_ERR_SUCCESS);
+    CHECK(le32toh(rsp.hits) == model_stats.hits);
+    CHECK(le32toh(rsp.misses) == model_stats.misses);
+    CHECK(le32toh(rsp.hits) + le32toh(rsp.misses) == 2);
+    CHECK(le16toh(rsp.count) == DUP_NUM);
+
+    /* Bad length and bad clear value */
+    cmd.clear = 2;
+    CHECK(ble_ll_hci_vs_cmd_proc((uint8_t *)&cmd, sizeof(cmd),
+                                 BLE_HCI_OCF_VS_RD_SCAN_DUP_STATS,
+                                 (uint8_t *)&rsp, &rsplen) ==
+          BLE_ERR_INV_HCI_CMD_PARMS);
+    cmd.clear = 1;
+    CHECK(ble_ll_hci_vs_cmd_proc((uint8_t *)&cmd, 0,
+                                 BLE_HCI_OCF_VS_RD_SCAN_DUP_STATS,
+                                 (uint8_t *)&rsp, &rsplen) ==
+          BLE_ERR_INV_HCI_CMD_PARMS);
+    check_stats();
+
+    /* Clearing the filter keeps the counts */
+    ble_ll_scan_dup_clear();
+    model_clear();
+    CHECK(ble_ll_scan_dup_stats_read(&stats, 0) == 0);
+    CHECK(stats.hits == model_stats.hits);
+    CHECK(stats.misses == model_stats.misses);
+}
+
+static double
+now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Checks of a full filter, without the model */
+static void
+bench(void)
+{
+    static uint8_t addrs[NUM_BUSY + NUM_ADVS][BLE_DEV_ADDR_LEN];
+    static uint8_t types[NUM_BUSY + NUM_ADVS];
+    struct ble_ll_scan_dup_stats stats;
+    double start;
+    double secs;
+    int filtered;
+    int adv;
+    int n;
+
+    for (adv = 0; adv < NUM_BUSY + NUM_ADVS; adv++) {
+        adv_addr(adv, &types[adv], addrs[adv]);
+    }
+    ble_ll_scan_dup_clear();
+    ble_ll_scan_dup_stats_read(&stats, 1);
+
+    filtered = 0;
+    start = now_sec();
+    for (n = 0; n < BENCH_PKTS; n++) {
+        if (n & 1) {
+            adv = (n >> 1) % NUM_BUSY;
+        } else {
+            adv = NUM_BUSY + (rnd() % NUM_ADVS);
+        }
+        if (ble_ll_scan_dup_check_legacy(types[adv], addrs[adv],
+                                         BLE_ADV_PDU_TYPE_ADV_IND)) {
+            filtered++;
+        } else {
+            ble_ll_scan_dup_update_legacy(types[adv], addrs[adv],
+                                          BLE_HCI_LE_SUBEV_ADV_RPT,
+                                          BLE_HCI_ADV_RPT_EVTYPE_ADV_IND);
+        }
+    }
+    secs = now_sec() - start;
+    bench_sink = filtered;
+
+    ble_ll_scan_dup_stats_read(&stats, 1);
+    CHECK(stats.hits + stats.misses == BENCH_PKTS);
+    CHECK(stats.hits == filtered);
+    check_buckets();
+
+    printf("scan_dup: %d entries, %.1fM checks/s, %.1f%% hits, %lu evictions\n",
+           DUP_NUM, BENCH_PKTS / secs / 1e6, 100.0 * stats.hits / BENCH_PKTS,
+           (unsigned long)stats.evictions);
+}
+
+int
+main(void)
+{
+    ble_ll_scan_dup_clear();
+
+    test_clock();
+    test_stream();
+    test_stats_cmd();
+    bench();
+
+    return hostTestResult("scan_dup");
+}
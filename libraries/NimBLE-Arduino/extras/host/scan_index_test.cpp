@@ -0,0 +1,375 @@
+/*
+ * Host test of the NimBLEScan device index, device pool and LRU eviction.
+ *
+ * Feeds synthetic BLE_GAP_EVENT_DISC events through NimBLEScan::handleGapEvent()
+ * and checks the index against the results vector after adds, erases and
+ * evictions, then measures the events per second with 250 known advertisers.
+ * Also checks the scan filters on devices that only match with their scan
+ * response and, built with CONFIG_BT_NIMBLE_EXT_ADV (scan_index_ext), on
+ * chained extended advertising reports.
+ */
+
+#define private public
+#include "NimBLEDevice.h"
+#undef private
+
+#include "host_test.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+
+#if CONFIG_BT_NIMBLE_EXT_ADV
+# define TEST_NAME "scan_index_ext"
+#else
+# define TEST_NAME "scan_index"
+#endif
+
+extern "C" {
+int ble_gap_disc(uint8_t, int32_t, const ble_gap_disc_params*, ble_gap_event_fn*, void*) {
+    return 0;
+}
+#if CONFIG_BT_NIMBLE_EXT_ADV
+int ble_gap_ext_disc(uint8_t, uint16_t, uint16_t, uint8_t, uint8_t, uint8_t,
+                     const ble_gap_ext_disc_params*, const ble_gap_ext_disc_params*, ble_gap_event_fn*, void*) {
+    return 0;
+}
+#endif
+int ble_gap_disc_active(void) {
+    return 1;
+}
+int ble_gap_disc_cancel(void) {
+    return 0;
+}
+int ble_hs_id_gen_rnd(int, ble_addr_t*) {
+    return 0;
+}
+}
+
+uint8_t     NimBLEDevice::m_ownAddrType = 0;
+NimBLEScan* NimBLEDevice::getScan() {
+    static NimBLEScan* scan = new NimBLEScan();
+    return scan;
+}
+NimBLEClient* NimBLEDevice::getClientByPeerAddress(const NimBLEAddress&) {
+    return nullptr;
+}
+bool NimBLEClient::isConnected() const {
+    return false;
+}
+
+static uint8_t advData[] = {2, 1, 6};
+
+static ble_addr_t makeAddr(uint32_t id) {
+    ble_addr_t addr{};
+    addr.type = id & 1;
+    for (int i = 0; i < 4; i++) {
+        addr.val[i] = (id * 2654435761u) >> (i * 8);
+    }
+    addr.val[4] = id;
+    addr.val[5] = id >> 8;
+    return addr;
+}
+
+/* A legacy advertising report, as an extended report when extended advertising is enabled */
+static void report(uint32_t id, uint8_t eventType, const uint8_t* data, uint8_t length) {
+    ble_gap_event event{};
+#if CONFIG_BT_NIMBLE_EXT_ADV
+    event.type                       = BLE_GAP_EVENT_EXT_DISC;
+    event.ext_disc.props             = BLE_HCI_ADV_LEGACY_MASK;
+    event.ext_disc.legacy_event_type = eventType;
+    event.ext_disc.data_status       = BLE_GAP_EXT_ADV_DATA_STATUS_COMPLETE;
+    event.ext_disc.addr              = makeAddr(id);
+    event.ext_disc.data              = data;
+    event.ext_disc.length_data       = length;
+    event.ext_disc.rssi              = -50;
+#else
+    event.type             = BLE_GAP_EVENT_DISC;
+    event.disc.event_type  = eventType;
+    event.disc.addr        = makeAddr(id);
+    event.disc.data        = data;
+    event.disc.length_data = length;
+    event.disc.rssi        = -50;
+#endif
+    NimBLEScan::handleGapEvent(&event, nullptr);
+}
+
+static void feed(uint32_t id) {
+    report(id, BLE_HCI_ADV_RPT_EVTYPE_NONCONN_IND, advData, sizeof(advData));
+}
+
+static bool present(NimBLEScan* scan, uint32_t id) {
+    ble_addr_t addr = makeAddr(id);
+    return scan->findDevice(NimBLEAddress(addr), 0) != nullptr;
+}
+
+/* The index, the results vector and the LRU list hold the same devices */
+static void checkConsistent(NimBLEScan* scan) {
+    auto&  devices = scan->m_scanResults.m_deviceVec;
+    size_t indexed = std::count_if(scan->m_index.begin(), scan->m_index.end(), [](NimBLEAdvertisedDevice* d) {
+        return d != nullptr;
+    });
+    CHECK(indexed == devices.size());
+
+    for (auto dev : devices) {
+#if CONFIG_BT_NIMBLE_EXT_ADV
+        CHECK(scan->findDevice(dev->getAddress(), dev->getSetId()) == dev);
+#else
+        CHECK(scan->findDevice(dev->getAddress(), 0) == dev);
+#endif
+    }
+
+    size_t lru = 0;
+    for (auto dev = scan->m_lruHead; dev != nullptr; dev = dev->m_lruNext) {
+        CHECK(std::find(devices.begin(), devices.end(), dev) != devices.end());
+        lru++;
+    }
+    CHECK(lru == devices.size());
+}
+
+static void testAddErase(NimBLEScan* scan) {
+    for (int i = 0; i < 20000; i++) {
+        feed(rand() % 300);
+    }
+    CHECK(scan->getResults().getCount() == 300);
+    checkConsistent(scan);
+
+    for (int i = 0; i < 2000; i++) {
+        auto& devices = scan->m_scanResults.m_deviceVec;
+        if (rand() % 2) {
+            feed(rand() % 400);
+        } else if (!devices.empty()) {
+            scan->erase(devices[rand() % devices.size()]);
+        }
+        if (i % 50 == 0) {
+            checkConsistent(scan);
+        }
+    }
+    checkConsistent(scan);
+
+    scan->clearResults();
+    CHECK(scan->getResults().getCount() == 0);
+    CHECK(scan->m_lruHead == nullptr);
+    CHECK(scan->m_devicePool.size() == CONFIG_NIMBLE_CPP_SCAN_DEVICE_POOL_SIZE);
+}
+
+/* Checks the eviction order against a list of the ids by time last seen */
+static void testEviction(NimBLEScan* scan) {
+    std::deque<uint32_t> model;
+
+    scan->setMaxResults(50, true);
+    for (int i = 0; i < 20000; i++) {
+        uint32_t id = rand() % 120;
+        auto     it = std::find(model.begin(), model.end(), id);
+        if (it != model.end()) {
+            model.erase(it);
+        } else if (model.size() == 50) {
+            model.pop_front();
+        }
+        model.push_back(id);
+        feed(id);
+
+        if (i % 500 == 0) {
+            CHECK((size_t)scan->getResults().getCount() == model.size());
+            for (uint32_t id : model) {
+                CHECK(present(scan, id));
+            }
+            checkConsistent(scan);
+        }
+    }
+
+    scan->setMaxResults(0xFF);
+    scan->clearResults();
+}
+
+/* maxResults 0 only calls back, devices come from the pool */
+static void testCallbacksOnly(NimBLEScan* scan) {
+    scan->setMaxResults(0);
+    for (int i = 0; i < 1000; i++) {
+        feed(rand() % 250 + 5000);
+    }
+    CHECK(scan->getResults().getCount() == 0);
+    CHECK(scan->m_devicePool.size() <= CONFIG_NIMBLE_CPP_SCAN_DEVICE_POOL_SIZE);
+    scan->setMaxResults(0xFF);
+}
+
+class CountCallbacks : public NimBLEScanCallbacks {
+  public:
+    void onDiscovered(const NimBLEAdvertisedDevice*) override { discovered++; }
+    void onResult(const NimBLEAdvertisedDevice*) override { results++; }
+
+    int discovered = 0;
+    int results    = 0;
+};
+
+static const uint8_t hrmUuid[]  = {3, BLE_HS_ADV_TYPE_COMP_UUIDS16, 0x0d, 0x18};
+static const uint8_t nameData[] = {5, BLE_HS_ADV_TYPE_COMP_NAME, 'h', 'o', 's', 't'};
+
+static std::vector<uint8_t> concat(std::initializer_list<std::vector<uint8_t>> parts) {
+    std::vector<uint8_t> all;
+    for (const auto& part : parts) {
+        all.insert(all.end(), part.begin(), part.end());
+    }
+    return all;
+}
+
+static const std::vector<uint8_t> advBytes(advData, advData + sizeof(advData));
+static const std::vector<uint8_t> hrmBytes(hrmUuid, hrmUuid + sizeof(hrmUuid));
+static const std::vector<uint8_t> nameBytes(nameData, nameData + sizeof(nameData));
+
+/* The filter is checked with the scan response of scannable devices in an active scan */
+static void testScanResponseFilter(NimBLEScan* scan) {
+    CountCallbacks cb;
+    scan->setScanCallbacks(&cb, true);
+    scan->setActiveScan(true);
+    scan->addServiceUUIDFilter(NimBLEUUID((uint16_t)0x180d));
+
+    // Matches only with the scan response: stored with the advertisement and the scan response
+    report(1, BLE_HCI_ADV_RPT_EVTYPE_ADV_IND, advData, sizeof(advData));
+    CHECK(scan->getResults().getCount() == 0);
+    CHECK(scan->m_heldDevices.size() == 1);
+    CHECK(cb.discovered == 0 && cb.results == 0);
+    report(1, BLE_HCI_ADV_RPT_EVTYPE_SCAN_RSP, hrmUuid, sizeof(hrmUuid));
+    CHECK(scan->getResults().getCount() == 1);
+    CHECK(scan->m_heldDevices.empty());
+    const NimBLEAdvertisedDevice* dev = scan->findDevice(NimBLEAddress(makeAddr(1)), 0);
+    CHECK(dev != nullptr);
+    if (dev != nullptr) {
+        CHECK(dev->getAdvType() == BLE_HCI_ADV_RPT_EVTYPE_ADV_IND);
+        CHECK(dev->getPayload() == concat({advBytes, hrmBytes}));
+        CHECK(dev->isAdvertisingService(NimBLEUUID((uint16_t)0x180d)));
+    }
+    CHECK(cb.discovered == 1 && cb.results == 1);
+
+    // Matches with the advertisement: stored at once, reported with the scan response
+    report(2, BLE_HCI_ADV_RPT_EVTYPE_SCAN_IND, hrmUuid, sizeof(hrmUuid));
+    CHECK(scan->getResults().getCount() == 2);
+    CHECK(cb.discovered == 2 && cb.results == 1);
+    report(2, BLE_HCI_ADV_RPT_EVTYPE_SCAN_RSP, nameData, sizeof(nameData));
+    CHECK(cb.discovered == 2 && cb.results == 2);
+
+    // Matches with neither: released with the scan response
+    report(3, BLE_HCI_ADV_RPT_EVTYPE_ADV_IND, advData, sizeof(advData));
+    report(3, BLE_HCI_ADV_RPT_EVTYPE_SCAN_RSP, nameData, sizeof(nameData));
+    CHECK(scan->getResults().getCount() == 2);
+    CHECK(scan->m_heldDevices.empty());
+
+    // Not scannable: no scan response to wait for
+    report(4, BLE_HCI_ADV_RPT_EVTYPE_NONCONN_IND, advData, sizeof(advData));
+    CHECK(scan->m_heldDevices.empty());
+
+    // Scan response without advertisement is checked alone
+    report(5, BLE_HCI_ADV_RPT_EVTYPE_SCAN_RSP, hrmUuid, sizeof(hrmUuid));
+    CHECK(scan->getResults().getCount() == 3);
+
+    // Devices whose scan response never comes don't pile up
+    for (uint32_t id = 100; id < 100 + 3 * CONFIG_NIMBLE_CPP_SCAN_HELD_DEVICES; id++) {
+        report(id, BLE_HCI_ADV_RPT_EVTYPE_ADV_IND, advData, sizeof(advData));
+        CHECK(scan->m_heldDevices.size() <= CONFIG_NIMBLE_CPP_SCAN_HELD_DEVICES);
+    }
+    CHECK(scan->getResults().getCount() == 3);
+    checkConsistent(scan);
+
+    // Passive scans get no scan responses, nothing is held
+    scan->clearResults();
+    CHECK(scan->m_heldDevices.empty());
+    scan->setActiveScan(false);
+    report(6, BLE_HCI_ADV_RPT_EVTYPE_ADV_IND, advData, sizeof(advData));
+    CHECK(scan->getResults().getCount() == 0);
+    CHECK(scan->m_heldDevices.empty());
+
+    scan->clearFilters();
+    scan->setScanCallbacks(nullptr);
+}
+
+#if CONFIG_BT_NIMBLE_EXT_ADV
+/* One fragment of a chained extended advertising report */
+static void fragment(uint32_t id, uint8_t sid, const uint8_t* data, uint8_t length, bool last) {
+    ble_gap_event event{};
+    event.type                 = BLE_GAP_EVENT_EXT_DISC;
+    event.ext_disc.props       = 0;
+    event.ext_disc.data_status = last ? BLE_GAP_EXT_ADV_DATA_STATUS_COMPLETE : BLE_GAP_EXT_ADV_DATA_STATUS_INCOMPLETE;
+    event.ext_disc.addr        = makeAddr(id);
+    event.ext_disc.sid         = sid;
+    event.ext_disc.data        = data;
+    event.ext_disc.length_data = length;
+    event.ext_disc.rssi        = -50;
+    NimBLEScan::handleGapEvent(&event, nullptr);
+}
+
+/* The filter is checked on the data of all fragments of an extended advertisement */
+static void testChainedFilter(NimBLEScan* scan) {
+    CountCallbacks cb;
+    scan->setScanCallbacks(&cb, true);
+    scan->addServiceUUIDFilter(NimBLEUUID((uint16_t)0x180d));
+
+    // Matches in the last fragment, interleaved with a device that never matches
+    fragment(10, 1, advData, sizeof(advData), false);
+    fragment(11, 1, advData, sizeof(advData), false);
+    fragment(10, 1, nameData, sizeof(nameData), false);
+    fragment(11, 1, nameData, sizeof(nameData), false);
+    CHECK(scan->getResults().getCount() == 0);
+    CHECK(scan->m_heldDevices.size() == 2);
+    fragment(10, 1, hrmUuid, sizeof(hrmUuid), true);
+    fragment(11, 1, nameData, sizeof(nameData), true);
+    CHECK(scan->getResults().getCount() == 1);
+    CHECK(scan->m_heldDevices.empty());
+    const NimBLEAdvertisedDevice* dev = scan->findDevice(NimBLEAddress(makeAddr(10)), 1);
+    CHECK(dev != nullptr);
+    if (dev != nullptr) {
+        CHECK(dev->getPayload() == concat({advBytes, nameBytes, hrmBytes}));
+        CHECK(dev->getDataStatus() == BLE_GAP_EXT_ADV_DATA_STATUS_COMPLETE);
+    }
+    CHECK(scan->findDevice(NimBLEAddress(makeAddr(11)), 1) == nullptr);
+    CHECK(cb.discovered == 1 && cb.results == 1);
+
+    // Matches in the first fragment: stored at once, reported with the last fragment
+    fragment(12, 2, hrmUuid, sizeof(hrmUuid), false);
+    CHECK(scan->getResults().getCount() == 2);
+    CHECK(cb.results == 1);
+    fragment(12, 2, nameData, sizeof(nameData), true);
+    dev = scan->findDevice(NimBLEAddress(makeAddr(12)), 2);
+    CHECK(dev != nullptr && dev->getPayload() == concat({hrmBytes, nameBytes}));
+    CHECK(cb.discovered == 2 && cb.results == 2);
+
+    // Same address, another set that does not match
+    fragment(12, 3, advData, sizeof(advData), false);
+    fragment(12, 3, nameData, sizeof(nameData), true);
+    CHECK(scan->getResults().getCount() == 2);
+    CHECK(scan->m_heldDevices.empty());
+    checkConsistent(scan);
+
+    scan->clearFilters();
+    scan->setScanCallbacks(nullptr);
+    scan->clearResults();
+}
+#endif
+
+static void bench(NimBLEScan* scan) {
+    const int events = 2000000;
+    auto      start  = std::chrono::steady_clock::now();
+    for (int i = 0; i < events; i++) {
+        feed(rand() % 250);
+    }
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf(TEST_NAME ": %.2fM advertising events/s, 250 known devices\n", events / sec / 1e6);
+    scan->clearResults();
+}
+
+int main() {
+    NimBLEScan* scan = NimBLEDevice::getScan();
+    scan->setActiveScan(false);
+    srand(1);
+
+    testAddErase(scan);
+    testEviction(scan);
+    testCallbacksOnly(scan);
+    testScanResponseFilter(scan);
+#if CONFIG_BT_NIMBLE_EXT_ADV
+    testChainedFilter(scan);
+#endif
+    bench(scan);
+
+    return hostTestResult(TEST_NAME);
+}
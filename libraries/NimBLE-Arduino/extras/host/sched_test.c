@@ -0,0 +1,293 @@
+/*
+ * Host test of the controller scheduler queue and its skip list index.
+ *
+ * Runs ble_ll_sched.c with a simulated clock: NUM_CONNS connections with
+ * 7.5-100 ms intervals, one advertising and one periodic advertising set.
+ * Each item is scheduled again from its callback, a connection skips events
+ * that collide with items it cannot preempt. Preempted connections are
+ * scheduled again after the current event. One connection is removed and
+ * added again every 997 events. The index and the queue order are checked
+ * regularly, and the time of each ble_ll_sched_insert() call is recorded.
+ *
+ * The schedule hash covers the executed items and their start times, it is
+ * the same with and without the index (bin/sched and bin/sched_index).
+ *
+ * The insert time percentiles include reading the clock. With 32 connections
+ * the plain walk has the shorter tail, from 64 connections on the index has.
+ *
+ * Includes ble_ll_sched.c to reach its static queue. Build with
+ * MYNEWT_VAL_BLE_LL_SCHED_INDEX_LEVELS and NUM_CONNS set to try other index
+ * sizes and loads.
+ */
+
+#include "nimble/nimble/controller/src/ble_ll_sched.c"
+#include "host_test.h"
+
+#include <stddef.h>
+#include <time.h>
+
+#ifndef NUM_CONNS
+#define NUM_CONNS       32
+#endif
+#define NUM_ITEMS       (NUM_CONNS + 2)
+#define NUM_EVENTS      1000000
+#define HIST_NS         4096
+
+struct sim_item {
+    struct ble_ll_sched_item sch;
+    int id;
+    uint32_t itvl;
+    uint32_t len;
+    uint32_t anchor;
+    uint32_t lru;
+};
+
+static struct sim_item items[NUM_ITEMS];
+static uint32_t sim_now;
+static hal_timer_cb sim_timer_cb;
+static uint32_t seed = 7;
+static uint32_t lru_cnt;
+static uint64_t hash = 1469598103934665603ull;
+static unsigned long missed;
+static unsigned long inserts;
+static unsigned long ins_hist[HIST_NS];
+static struct sim_item *preempted[NUM_ITEMS];
+static int num_preempted;
+
+static uint32_t
+rnd(void)
+{
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+}
+
+uint32_t os_cputime_get32(void) { return sim_now; }
+uint32_t os_cputime_ticks_to_usecs(uint32_t t) { return (uint64_t)t * 1000000 / 32768; }
+uint32_t os_cputime_usecs_to_ticks(uint32_t u) { return (uint64_t)u * 32768 / 1000000; }
+int os_cputime_timer_start(struct hal_timer *t, uint32_t c) { return 0; }
+void os_cputime_timer_stop(struct hal_timer *t) {}
+uint32_t uxGetCriticalNestingDepth(void) { return 1; }
+void vPortEnterCritical(void) {}
+void vPortExitCritical(void) {}
+uint8_t ble_ll_state_get(void) { return BLE_LL_STATE_STANDBY; }
+void ble_ll_state_set(uint8_t s) {}
+void ble_phy_disable(void) {}
+void ble_ll_scan_halt(void) {}
+void ble_ll_conn_event_halt(void) {}
+uint32_t ble_ll_conn_get_ce_end_time(void) { return 0; }
+void ble_ll_adv_event_rmvd_from_sched(struct ble_ll_adv_sm *advsm) {}
+
+uint32_t
+ble_ll_rand(void)
+{
+    return rnd();
+}
+
+void
+os_cputime_timer_init(struct hal_timer *t, hal_timer_cb cb, void *arg)
+{
+    sim_timer_cb = cb;
+}
+
+/* A connection was preempted, its conn_ev_end event is posted */
+void
+ble_ll_event_add(struct ble_npl_event *ev)
+{
+    preempted[num_preempted++] = (struct sim_item *)
+        ((uint8_t *)ev - offsetof(struct ble_ll_conn_sm, conn_ev_end));
+}
+
+int
+ble_ll_conn_is_lru(struct ble_ll_conn_sm *s1, struct ble_ll_conn_sm *s2)
+{
+    return ((struct sim_item *)s1)->lru < ((struct sim_item *)s2)->lru;
+}
+
+/* Connections preempt the connection which was served longest ago */
+static int
+sim_preempt(struct ble_ll_sched_item *sch, struct ble_ll_sched_item *item)
+{
+    if (item->sched_type != BLE_LL_SCHED_TYPE_CONN) {
+        return 0;
+    }
+    return ble_ll_conn_is_lru(sch->cb_arg, item->cb_arg);
+}
+
+static uint64_t
+now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static int
+timed_insert(struct sim_item *it, uint32_t max_delay, ble_ll_sched_preempt_cb_t cb)
+{
+    uint64_t start;
+    uint64_t dt;
+    int rc;
+
+    start = now_ns();
+    rc = ble_ll_sched_insert(&it->sch, max_delay, cb);
+    dt = now_ns() - start;
+
+    ins_hist[dt < HIST_NS ? dt : HIST_NS - 1]++;
+    inserts++;
+
+    return rc;
+}
+
+/* Schedules the next event of the item, trying the following anchors */
+static void
+sched_next(struct sim_item *it)
+{
+    for (;;) {
+        it->anchor += it->itvl;
+        if (LL_TMR_LT(it->anchor, sim_now)) {
+            continue;
+        }
+        it->sch.start_time = it->anchor;
+        it->sch.end_time = it->anchor + it->len;
+        if (it->sch.sched_type == BLE_LL_SCHED_TYPE_CONN) {
+            if (timed_insert(it, 0, sim_preempt) == 0) {
+                return;
+            }
+            missed++;
+        } else if (timed_insert(it, it->itvl / 4, preempt_none) == 0) {
+            return;
+        }
+    }
+}
+
+static int
+sim_cb(struct ble_ll_sched_item *sch)
+{
+    struct sim_item *it = sch->cb_arg;
+
+    CHECK(sch->start_time == sim_now);
+
+    hash = (hash ^ (uint64_t)it->id) * 1099511628211ull;
+    hash = (hash ^ sch->start_time) * 1099511628211ull;
+    it->lru = ++lru_cnt;
+    sched_next(it);
+
+    return BLE_LL_SCHED_STATE_DONE;
+}
+
+/* The queue is sorted without overlaps, the index levels are its sublists */
+static void
+check_queue(void)
+{
+    struct ble_ll_sched_item *prev;
+    struct ble_ll_sched_item *entry;
+#if BLE_LL_SCHED_INDEX_LEVELS
+    struct ble_ll_sched_item *next;
+    int level;
+
+    for (level = 0; level < BLE_LL_SCHED_INDEX_LEVELS; level++) {
+        next = g_ble_ll_sched_index[level];
+        TAILQ_FOREACH(entry, &g_ble_ll_sched_q, link) {
+            if (entry->index_levels > level) {
+                CHECK(next == entry);
+                next = entry->index_next[level];
+            }
+        }
+        CHECK(next == NULL);
+    }
+#endif
+
+    prev = NULL;
+    TAILQ_FOREACH(entry, &g_ble_ll_sched_q, link) {
+        CHECK(entry->enqueued);
+        CHECK(!prev || LL_TMR_LEQ(prev->end_time, entry->start_time));
+        prev = entry;
+    }
+}
+
+static unsigned long
+percentile(double p)
+{
+    unsigned long acc;
+    int i;
+
+    acc = 0;
+    for (i = 0; i < HIST_NS - 1; i++) {
+        acc += ins_hist[i];
+        if (acc >= p * inserts) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+int
+main(void)
+{
+    struct sim_item *it;
+    uint32_t next_time;
+    uint64_t start;
+    double secs;
+    int n;
+    int i;
+
+    ble_ll_sched_init();
+    for (i = 0; i < NUM_ITEMS; i++) {
+        it = &items[i];
+        it->id = i;
+        it->sch.cb_arg = it;
+        it->sch.sched_cb = sim_cb;
+        if (i < NUM_CONNS) {
+            /* 7.5 ms .. 100 ms in 1.25 ms units, about 1 ms events */
+            it->sch.sched_type = BLE_LL_SCHED_TYPE_CONN;
+            it->itvl = os_cputime_usecs_to_ticks((6 + rnd() % 75) * 1250);
+            it->len = 10 + rnd() % 20;
+        } else {
+            it->sch.sched_type = i == NUM_CONNS ? BLE_LL_SCHED_TYPE_ADV :
+                                                  BLE_LL_SCHED_TYPE_PERIODIC;
+            it->itvl = os_cputime_usecs_to_ticks(i == NUM_CONNS ? 20000 : 30000);
+            it->len = 120;
+        }
+        it->anchor = rnd() % it->itvl;
+        sched_next(it);
+    }
+    check_queue();
+
+    start = now_ns();
+    for (n = 0; n < NUM_EVENTS; n++) {
+        if (!ble_ll_sched_next_time(&next_time)) {
+            break;
+        }
+        CHECK(LL_TMR_GEQ(next_time, sim_now));
+        sim_now = next_time;
+        sim_timer_cb(NULL);
+
+        if ((n % 997) == 0) {
+            it = &items[n % NUM_CONNS];
+            ble_ll_sched_rmv_elem(&it->sch);
+            sched_next(it);
+        }
+        while (num_preempted > 0) {
+            it = preempted[--num_preempted];
+            if (!it->sch.enqueued) {
+                sched_next(it);
+            }
+        }
+        if ((n & 1023) == 0) {
+            check_queue();
+        }
+    }
+    secs = (now_ns() - start) / 1e9;
+    check_queue();
+    CHECK(n == NUM_EVENTS);
+
+    printf("sched: %d conns, index levels %d, %d events, %lu missed, hash %016llx\n",
+           NUM_CONNS, BLE_LL_SCHED_INDEX_LEVELS, n, missed, (unsigned long long)hash);
+    printf("sched: %.2fM events/s, insert ns p50 %lu p90 %lu p99 %lu p99.9 %lu\n",
+           n / secs / 1e6, percentile(.5), percentile(.9), percentile(.99),
+           percentile(.999));
+
+    return hostTestResult("sched");
+}
@@ -0,0 +1,441 @@
+/*
+ * Host test of the tinycrypt SHA-256, HMAC and HMAC-PRNG code.
+ *
+ * Checks the FIPS 180-2 and RFC 4231 known answers, then random messages
+ * hashed in random update splits and random keys of 1 to 200 bytes against a
+ * plain SHA-256 and HMAC built here. An HMAC context reused after
+ * tc_hmac_final() hashes with the schedule of the all-zero key block, as it
+ * did before the key schedule became hash states. A fixed HMAC-PRNG sequence
+ * must give the output of the sources before that change. Then measures
+ * SHA-256 throughput, 32-byte HMACs per second and HMAC-PRNG seedings.
+ */
+
+#include "nimble/ext/tinycrypt/include/tinycrypt/constants.h"
+#include "nimble/ext/tinycrypt/include/tinycrypt/hmac.h"
+#include "nimble/ext/tinycrypt/include/tinycrypt/hmac_prng.h"
+#include "nimble/ext/tinycrypt/include/tinycrypt/sha256.h"
+#include "host_test.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_MSG         600
+#define MAX_KEY         200
+
+/* Keeps the benchmarked output */
+volatile uint8_t bench_sink;
+
+static const uint32_t ref_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static uint32_t
+ref_rotr(uint32_t x, int n)
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+/* One block, straight from FIPS 180-4 section 6.2.2 */
+static void
+ref_block(uint32_t h[8], const uint8_t *p)
+{
+    uint32_t w[64];
+    uint32_t v[8];
+    uint32_t t1;
+    uint32_t t2;
+    int i;
+
+    for (i = 0; i < 16; i++) {
+        w[i] = (uint32_t)p[4 * i] << 24 | (uint32_t)p[4 * i + 1] << 16 |
+               (uint32_t)p[4 * i + 2] << 8 | p[4 * i + 3];
+    }
+    for (i = 16; i < 64; i++) {
+        w[i] = (ref_rotr(w[i - 2], 17) ^ ref_rotr(w[i - 2], 19) ^ (w[i - 2] >> 10)) +
+               w[i - 7] +
+               (ref_rotr(w[i - 15], 7) ^ ref_rotr(w[i - 15], 18) ^ (w[i - 15] >> 3)) +
+               w[i - 16];
+    }
+    memcpy(v, h, sizeof(v));
+    for (i = 0; i < 64; i++) {
+        t1 = v[7] + (ref_rotr(v[4], 6) ^ ref_rotr(v[4], 11) ^ ref_rotr(v[4], 25)) +
+             ((v[4] & v[5]) ^ (~v[4] & v[6])) + ref_k[i] + w[i];
+        t2 = (ref_rotr(v[0], 2) ^ ref_rotr(v[0], 13) ^ ref_rotr(v[0], 22)) +
+             ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+        memmove(v + 1, v, 7 * sizeof(v[0]));
+        v[4] += t1;
+        v[0] = t1 + t2;
+    }
+    for (i = 0; i < 8; i++) {
+        h[i] += v[i];
+    }
+}
+
+/* SHA-256 of a block, if any, followed by a message */
+static void
+ref_sha256(uint8_t *digest, const uint8_t *first, const uint8_t *msg, int len)
+{
+    uint32_t h[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+    uint8_t last[2 * TC_SHA256_BLOCK_SIZE];
+    uint64_t bits;
+    int tail;
+    int n;
+    int i;
+
+    bits = (uint64_t)len * 8;
+    if (first) {
+        ref_block(h, first);
+        bits += TC_SHA256_BLOCK_SIZE * 8;
+    }
+    for (; len >= TC_SHA256_BLOCK_SIZE; len -= TC_SHA256_BLOCK_SIZE) {
+        ref_block(h, msg);
+        msg += TC_SHA256_BLOCK_SIZE;
+    }
+
+    memset(last, 0, sizeof(last));
+    memcpy(last, msg, len);
+    last[len] = 0x80;
+    n = len < TC_SHA256_BLOCK_SIZE - 8 ? 1 : 2;
+    tail = n * TC_SHA256_BLOCK_SIZE;
+    for (i = 0; i < 8; i++) {
+        last[tail - 1 - i] = bits >> (8 * i);
+    }
+    for (i = 0; i < n; i++) {
+        ref_block(h, last + i * TC_SHA256_BLOCK_SIZE);
+    }
+
+    for (i = 0; i < 32; i++) {
+        digest[i] = h[i / 4] >> (24 - 8 * (i % 4));
+    }
+}
+
+/* RFC 2104 */
+static void
+ref_hmac(uint8_t *tag, const uint8_t *key, int key_len, const uint8_t *msg,
+         int len)
+{
+    uint8_t block[TC_SHA256_BLOCK_SIZE];
+    uint8_t hkey[TC_SHA256_DIGEST_SIZE];
+    uint8_t inner[TC_SHA256_DIGEST_SIZE];
+    int i;
+
+    if (key_len > TC_SHA256_BLOCK_SIZE) {
+        ref_sha256(hkey, NULL, key, key_len);
+        key = hkey;
+        key_len = sizeof(hkey);
+    }
+
+    for (i = 0; i < TC_SHA256_BLOCK_SIZE; i++) {
+        block[i] = (i < key_len ? key[i] : 0) ^ 0x36;
+    }
+    ref_sha256(inner, block, msg, len);
+    for (i = 0; i < TC_SHA256_BLOCK_SIZE; i++) {
+        block[i] = (i < key_len ? key[i] : 0) ^ 0x5c;
+    }
+    ref_sha256(tag, block, inner, sizeof(inner));
+}
+
+static void
+rand_bytes(uint8_t *buf, int len)
+{
+    while (len--) {
+        *buf++ = rand();
+    }
+}
+
+static void
+sha256(uint8_t *digest, const void *msg, int len)
+{
+    struct tc_sha256_state_struct s;
+
+    CHECK(tc_sha256_init(&s) == TC_CRYPTO_SUCCESS);
+    CHECK(tc_sha256_update(&s, msg, len) == TC_CRYPTO_SUCCESS);
+    CHECK(tc_sha256_final(digest, &s) == TC_CRYPTO_SUCCESS);
+}
+
+static void
+hmac(uint8_t *tag, const void *key, int key_len, const void *msg, int len)
+{
+    struct tc_hmac_state_struct h;
+
+    CHECK(tc_hmac_set_key(&h, key, key_len) == TC_CRYPTO_SUCCESS);
+    CHECK(tc_hmac_init(&h) == TC_CRYPTO_SUCCESS);
+    CHECK(tc_hmac_update(&h, msg, len) == TC_CRYPTO_SUCCESS);
+    CHECK(tc_hmac_final(tag, TC_SHA256_DIGEST_SIZE, &h) == TC_CRYPTO_SUCCESS);
+}
+
+static void
+test_known_answers(void)
+{
+    static const uint8_t abc[32] = {
+        0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea,
+        0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+        0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+        0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad
+    };
+    static const uint8_t two_blocks[32] = {
+        0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8,
+        0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+        0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67,
+        0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1
+    };
+    static const uint8_t million_a[32] = {
+        0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92,
+        0x81, 0xa1, 0xc7, 0xe2, 0x84, 0xd7, 0x3e, 0x67,
+        0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e,
+        0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0
+    };
+    static const uint8_t rfc4231_1[32] = {
+        0xb0, 0x34, 0x4c, 0x61, 0xd8, 0xdb, 0x38, 0x53,
+        0x5c, 0xa8, 0xaf, 0xce, 0xaf, 0x0b, 0xf1, 0x2b,
+        0x88, 0x1d, 0xc2, 0x00, 0xc9, 0x83, 0x3d, 0xa7,
+        0x26, 0xe9, 0x37, 0x6c, 0x2e, 0x32, 0xcf, 0xf7
+    };
+    static const uint8_t rfc4231_2[32] = {
+        0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e,
+        0x6a, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75, 0xc7,
+        0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27, 0x39, 0x83,
+        0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43
+    };
+    static const uint8_t rfc4231_6[32] = {
+        0x60, 0xe4, 0x31, 0x59, 0x1e, 0xe0, 0xb6, 0x7f,
+        0x0d, 0x8a, 0x26, 0xaa, 0xcb, 0xf5, 0xb7, 0x7f,
+        0x8e, 0x0b, 0xc6, 0x21, 0x37, 0x28, 0xc5, 0x14,
+        0x05, 0x46, 0x04, 0x0f, 0x0e, 0xe3, 0x7f, 0x54
+    };
+    static const char two_blocks_msg[] =
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    static const char rfc4231_6_msg[] =
+        "Test Using Larger Than Block-Size Key - Hash Key First";
+    struct tc_sha256_state_struct s;
+    uint8_t key[131];
+    uint8_t buf[1000];
+    uint8_t out[32];
+    int i;
+
+    sha256(out, "abc", 3);
+    CHECK(memcmp(out, abc, 32) == 0);
+    sha256(out, two_blocks_msg, strlen(two_blocks_msg));
+    CHECK(memcmp(out, two_blocks, 32) == 0);
+
+    memset(buf, 'a', sizeof(buf));
+    CHECK(tc_sha256_init(&s) == TC_CRYPTO_SUCCESS);
+    for (i = 0; i < 1000; i++) {
+        CHECK(tc_sha256_update(&s, buf, sizeof(buf)) == TC_CRYPTO_SUCCESS);
+    }
+    CHECK(tc_sha256_final(out, &s) == TC_CRYPTO_SUCCESS);
+    CHECK(memcmp(out, million_a, 32) == 0);
+
+    memset(key, 0x0b, 20);
+    hmac(out, key, 20, "Hi There", 8);
+    CHECK(memcmp(out, rfc4231_1, 32) == 0);
+    hmac(out, "Jefe", 4, "what do ya want for nothing?", 28);
+    CHECK(memcmp(out, rfc4231_2, 32) == 0);
+    memset(key, 0xaa, sizeof(key));
+    hmac(out, key, sizeof(key), rfc4231_6_msg, strlen(rfc4231_6_msg));
+    CHECK(memcmp(out, rfc4231_6, 32) == 0);
+
+    /* The reference itself */
+    ref_sha256(out, NULL, buf, 0);
+    sha256(buf + 100, "", 0);
+    CHECK(memcmp(out, buf + 100, 32) == 0);
+    ref_hmac(out, key, sizeof(key), (const uint8_t *)rfc4231_6_msg,
+             strlen(rfc4231_6_msg));
+    CHECK(memcmp(out, rfc4231_6, 32) == 0);
+
+    /* Bad arguments */
+    CHECK(tc_sha256_update(&s, NULL, 1) == TC_CRYPTO_FAIL);
+    CHECK(tc_hmac_set_key((TCHmacState_t)buf, key, 0) == TC_CRYPTO_FAIL);
+    CHECK(tc_hmac_final(out, 16, (TCHmacState_t)buf) == TC_CRYPTO_FAIL);
+}
+
+static void
+test_random(void)
+{
+    static const uint8_t zero_block[TC_SHA256_BLOCK_SIZE];
+    struct tc_sha256_state_struct s;
+    struct tc_hmac_state_struct h;
+    uint8_t msg[MAX_MSG];
+    uint8_t key[MAX_KEY];
+    uint8_t inner[32];
+    uint8_t ref[32];
+    uint8_t out[32];
+    int key_len;
+    int len;
+    int pos;
+    int n;
+    int it;
+
+    for (it = 0; it < 20000; it++) {
+        len = rand() % MAX_MSG;
+        rand_bytes(msg, len);
+
+        /* Updates of random length, some empty */
+        CHECK(tc_sha256_init(&s) == TC_CRYPTO_SUCCESS);
+        for (pos = 0; pos < len; pos += n) {
+            n = rand() % (it % 2 ? 8 : 200);
+            if (n > len - pos) {
+                n = len - pos;
+            }
+            CHECK(tc_sha256_update(&s, msg + pos, n) == TC_CRYPTO_SUCCESS);
+        }
+        CHECK(tc_sha256_final(out, &s) == TC_CRYPTO_SUCCESS);
+        ref_sha256(ref, NULL, msg, len);
+        CHECK(memcmp(out, ref, 32) == 0);
+
+        /* Keys shorter than, as long as and longer than a block */
+        key_len = 1 + it % MAX_KEY;
+        rand_bytes(key, key_len);
+        CHECK(tc_hmac_set_key(&h, key, key_len) == TC_CRYPTO_SUCCESS);
+        CHECK(tc_hmac_init(&h) == TC_CRYPTO_SUCCESS);
+        for (pos = 0; pos < len; pos += n) {
+            n = rand() % 100;
+            if (n > len - pos) {
+                n = len - pos;
+            }
+            CHECK(tc_hmac_update(&h, msg + pos, n) == TC_CRYPTO_SUCCESS);
+        }
+        CHECK(tc_hmac_final(out, sizeof(out), &h) == TC_CRYPTO_SUCCESS);
+        ref_hmac(ref, key, key_len, msg, len);
+        CHECK(memcmp(out, ref, 32) == 0);
+
+        /* Erased context, both pads are the zero block */
+        if (it % 10 == 0) {
+            CHECK(tc_hmac_init(&h) == TC_CRYPTO_SUCCESS);
+            CHECK(tc_hmac_update(&h, msg, len) == TC_CRYPTO_SUCCESS);
+            CHECK(tc_hmac_final(out, sizeof(out), &h) == TC_CRYPTO_SUCCESS);
+            ref_sha256(inner, zero_block, msg, len);
+            ref_sha256(ref, zero_block, inner, sizeof(inner));
+            CHECK(memcmp(out, ref, 32) == 0);
+        }
+    }
+}
+
+/*
+ * SHA-256 of the output of init, reseed with and without additional input
+ * and generate with a few lengths, from the sources before the HMAC key
+ * schedule became hash states.
+ */
+static void
+test_prng(void)
+{
+    static const uint8_t expect[32] = {
+        0xc7, 0x61, 0x4e, 0x8c, 0x23, 0x37, 0xb5, 0xc9,
+        0x10, 0xfc, 0xd0, 0xb6, 0x21, 0xa9, 0x3b, 0xdc,
+        0x5c, 0xd3, 0x0b, 0x1f, 0x3f, 0x64, 0x8b, 0xbb,
+        0x68, 0xf8, 0x84, 0xc9, 0x7d, 0xda, 0x57, 0x98
+    };
+    struct tc_hmac_prng_struct prng;
+    struct tc_sha256_state_struct s;
+    uint8_t pers[40];
+    uint8_t seed[48];
+    uint8_t add[20];
+    uint8_t out[100];
+    uint8_t digest[32];
+    int it;
+    int i;
+
+    for (i = 0; i < (int)sizeof(seed); i++) {
+        seed[i] = i * 7 + 1;
+    }
+    for (i = 0; i < (int)sizeof(pers); i++) {
+        pers[i] = 0xa0 ^ i;
+    }
+    for (i = 0; i < (int)sizeof(add); i++) {
+        add[i] = 0x55 + i;
+    }
+
+    tc_sha256_init(&s);
+    for (it = 0; it < 16; it++) {
+        CHECK(tc_hmac_prng_init(&prng, pers, it * 2 + 1) == TC_CRYPTO_SUCCESS);
+        CHECK(tc_hmac_prng_generate(out, 32, &prng) == TC_HMAC_PRNG_RESEED_REQ);
+        CHECK(tc_hmac_prng_reseed(&prng, seed, 32 + it, it % 2 ? add : NULL,
+                                  it + 1) == TC_CRYPTO_SUCCESS);
+        for (i = 1; i <= 3; i++) {
+            CHECK(tc_hmac_prng_generate(out, 31 * i + it, &prng) ==
+                  TC_CRYPTO_SUCCESS);
+            tc_sha256_update(&s, out, 31 * i + it);
+        }
+    }
+    tc_sha256_final(digest, &s);
+    CHECK(memcmp(digest, expect, 32) == 0);
+}
+
+static double
+now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+bench(void)
+{
+    static uint8_t buf[1 << 16];
+    struct tc_sha256_state_struct s;
+    struct tc_hmac_state_struct h;
+    struct tc_hmac_prng_struct prng;
+    uint8_t key[16] = { 0 };
+    uint8_t seed[32] = { 0 };
+    uint8_t out[32];
+    double start;
+    int i;
+
+    start = now_sec();
+    tc_sha256_init(&s);
+    for (i = 0; i < 500; i++) {
+        tc_sha256_update(&s, buf, sizeof(buf));
+    }
+    tc_sha256_final(out, &s);
+    printf("sha256: SHA-256 %.0f MB/s\n",
+           500.0 * sizeof(buf) / (now_sec() - start) / 1e6);
+
+    tc_hmac_set_key(&h, key, sizeof(key));
+    start = now_sec();
+    for (i = 0; i < 500000; i++) {
+        tc_hmac_init(&h);
+        tc_hmac_update(&h, out, sizeof(out));
+        tc_hmac_final(out, sizeof(out), &h);
+    }
+    printf("sha256: HMAC %.2fM 32-byte messages/s\n", 0.5 / (now_sec() - start));
+
+    start = now_sec();
+    for (i = 0; i < 100000; i++) {
+        tc_hmac_prng_init(&prng, key, sizeof(key));
+        tc_hmac_prng_reseed(&prng, seed, sizeof(seed), NULL, 0);
+        tc_hmac_prng_generate(out, sizeof(out), &prng);
+        tc_hmac_prng_generate(seed, sizeof(seed), &prng);
+    }
+    printf("sha256: HMAC-PRNG %.0fk init, reseed and 2x32 bytes/s\n",
+           100.0 / (now_sec() - start));
+
+    bench_sink = out[0] ^ seed[0];
+}
+
+int
+main(void)
+{
+    srand(1);
+
+    test_known_answers();
+    test_random();
+    test_prng();
+    bench();
+
+    return hostTestResult("sha256");
+}
@@ -0,0 +1,246 @@
+/*
+ * Host test of the trace ring with concurrent writers and a reader.
+ *
+ * NUM_THREADS threads put records in bursts of random length while the main
+ * thread reads the ring with os_trace_ring_read(). All threads yield between
+ * bursts and reads, so they interleave also on a single core. A timer signal
+ * in the reader puts bursts too, like an interrupt with tracepoints, so that
+ * records are overwritten while the reader copies them. Each record carries its writer,
+ * a per writer sequence number and a check value over both, so the reader
+ * finds torn records, records out of order and records read twice. All
+ * records are either read or reported as overwritten. Then the quiet ring
+ * is dumped with os_trace_ring_dump() and checked the same way.
+ *
+ * The ring is small so that the writers lap the reader all the time. Includes
+ * os_trace_ring.c to build it with its own size, set
+ * MYNEWT_VAL_OS_TRACE_RING_SIZE to try other sizes.
+ */
+
+#include "nimble/porting/nimble/src/os_trace_ring.c"
+#include "host_test.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
+
+/* Threads and the interrupt */
+#define NUM_WRITERS     4
+#define NUM_THREADS     (NUM_WRITERS - 1)
+#define NUM_RECS        1500000
+#define READ_MAX        64
+#define ID_WRITER       0x10
+
+static int writers_left = NUM_WRITERS;
+static __thread uint32_t thread_puts;
+
+/* Called between reserving and writing a record, the writer threads stall
+ * there now and then so that the reader meets reserved records.
+ */
+uint32_t
+os_cputime_get32(void)
+{
+    if (thread_puts != 0 && (++thread_puts % 61) == 0) {
+        sched_yield();
+    }
+
+    return 0;
+}
+
+static uint32_t
+check_val(uint8_t id, uint32_t seq)
+{
+    return (seq * 2654435761u) ^ ((uint32_t)id << 24) ^ 0x5a5a5a5au;
+}
+
+/* Bursts of up to 2 rings, then the other threads run */
+static void *
+writer(void *arg)
+{
+    uint8_t id = ID_WRITER + (uintptr_t)arg;
+    uint32_t burst;
+    uint32_t seed;
+    uint32_t seq;
+
+    thread_puts = 1;
+    seed = id;
+    burst = 0;
+    for (seq = 1; seq <= NUM_RECS; seq++) {
+        os_trace_ring_put(id, seq, seq, check_val(id, seq));
+        if (burst-- == 0) {
+            sched_yield();
+            seed = seed * 1103515245u + 12345u;
+            burst = (seed >> 8) % (2 * OS_TRACE_RING_SIZE);
+        }
+    }
+    __atomic_fetch_sub(&writers_left, 1, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/* Like an interrupt handler with tracepoints, it runs in the middle of
+ * os_trace_ring_read() and laps the reader.
+ */
+static void
+irq_writer(int sig)
+{
+    static const struct itimerval stop;
+    static uint32_t seed = 1;
+    static uint32_t seq;
+    uint8_t id = ID_WRITER + NUM_THREADS;
+    uint32_t burst;
+
+    seed = seed * 1103515245u + 12345u;
+    burst = (seed >> 8) % (2 * OS_TRACE_RING_SIZE);
+    while (burst-- > 0 && seq < NUM_RECS) {
+        seq++;
+        os_trace_ring_put(id, seq, seq, check_val(id, seq));
+    }
+    if (seq == NUM_RECS) {
+        setitimer(ITIMER_REAL, &stop, NULL);
+        seq++;
+        __atomic_fetch_sub(&writers_left, 1, __ATOMIC_RELEASE);
+    }
+}
+
+/* Last sequence number seen of each writer */
+static uint32_t last_seq[NUM_WRITERS];
+
+static void
+check_rec(const struct os_trace_ring_rec *rec)
+{
+    int w = rec->id - ID_WRITER;
+
+    CHECK(w >= 0 && w < NUM_WRITERS);
+    if (w < 0 || w >= NUM_WRITERS) {
+        return;
+    }
+    CHECK(rec->arg0 == (uint16_t)rec->arg1);
+    CHECK(rec->arg2 == check_val(rec->id, rec->arg1));
+    CHECK(rec->arg1 > last_seq[w]);
+    last_seq[w] = rec->arg1;
+}
+
+static unsigned long dump_recs;
+static unsigned long dump_lost;
+
+static void
+dump_out(const void *buf, size_t len, void *arg)
+{
+    const struct os_trace_ring_hdr *hdr;
+    const struct os_trace_ring_rec *rec;
+    size_t i;
+
+    if (dump_recs == 0 && len == sizeof(*hdr)) {
+        hdr = buf;
+        CHECK(hdr->magic == OS_TRACE_RING_MAGIC);
+        CHECK(hdr->num_recs == 0);
+        CHECK(hdr->head == NUM_WRITERS * NUM_RECS);
+        dump_recs++;
+        return;
+    }
+
+    CHECK(len % sizeof(*rec) == 0);
+    rec = buf;
+    for (i = 0; i < len / sizeof(*rec); i++) {
+        if (rec[i].id == OS_TRACE_RING_ID_LOST) {
+            dump_lost++;
+        } else {
+            check_rec(&rec[i]);
+        }
+        dump_recs++;
+    }
+}
+
+static double
+now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int
+main(void)
+{
+    static const struct itimerval tick = { { 0, 50 }, { 0, 50 } };
+    struct os_trace_ring_rec recs[READ_MAX];
+    pthread_t threads[NUM_THREADS];
+    sigset_t alrm;
+    unsigned long reads;
+    unsigned long lost;
+    unsigned long got;
+    uint32_t prev;
+    uint32_t pos;
+    double start;
+    double secs;
+    int done;
+    int cnt;
+    int i;
+
+    /* Only the reader takes the timer signal */
+    sigemptyset(&alrm);
+    sigaddset(&alrm, SIGALRM);
+    pthread_sigmask(SIG_BLOCK, &alrm, NULL);
+    start = now_sec();
+    for (i = 0; i < NUM_THREADS; i++) {
+        CHECK(pthread_create(&threads[i], NULL, writer, (void *)(uintptr_t)i) == 0);
+    }
+    signal(SIGALRM, irq_writer);
+    pthread_sigmask(SIG_UNBLOCK, &alrm, NULL);
+    setitimer(ITIMER_REAL, &tick, NULL);
+
+    pos = 0;
+    got = 0;
+    lost = 0;
+    reads = 0;
+    secs = 0;
+    for (;;) {
+        done = __atomic_load_n(&writers_left, __ATOMIC_ACQUIRE) == 0;
+        if (done && secs == 0) {
+            secs = now_sec() - start;
+        }
+
+        prev = pos;
+        cnt = os_trace_ring_read(&pos, recs, READ_MAX);
+        reads++;
+        CHECK(cnt >= 0 && cnt <= READ_MAX);
+        CHECK((int32_t)(pos - prev) >= cnt);
+        lost += pos - prev - cnt;
+        got += cnt;
+        for (i = 0; i < cnt; i++) {
+            check_rec(&recs[i]);
+        }
+
+        /* Nothing left after the last writer finished */
+        if (done && pos == prev) {
+            break;
+        }
+        if (cnt < READ_MAX) {
+            sched_yield();
+        }
+    }
+    for (i = 0; i < NUM_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    CHECK(pos == NUM_WRITERS * NUM_RECS);
+    CHECK(got + lost == NUM_WRITERS * NUM_RECS);
+    CHECK(got > 0);
+
+    printf("trace_ring: %d threads and an interrupt, %d records, ring of %d, %.1fM records/s\n",
+           NUM_THREADS, NUM_WRITERS * NUM_RECS, OS_TRACE_RING_SIZE,
+           NUM_WRITERS * NUM_RECS / secs / 1e6);
+    printf("trace_ring: %lu reads, %lu records read, %lu overwritten before reading\n",
+           reads, got, lost);
+
+    /* The last records are dumped complete and in order */
+    memset(last_seq, 0, sizeof(last_seq));
+    CHECK(os_trace_ring_dump(dump_out, NULL) == OS_TRACE_RING_SIZE);
+    CHECK(dump_recs == 1 + OS_TRACE_RING_SIZE);
+    CHECK(dump_lost == 0);
+
+    return hostTestResult("trace_ring");
+}
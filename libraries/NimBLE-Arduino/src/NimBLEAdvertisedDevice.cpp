@@ -30,35 +30,46 @@ static const char* LOG_TAG = "NimBLEAdvertisedDevice";
  * @brief Constructor
  * @param [in] event The advertisement event data.
  */
-NimBLEAdvertisedDevice::NimBLEAdvertisedDevice(const ble_gap_event* event, uint8_t eventType)
+NimBLEAdvertisedDevice::NimBLEAdvertisedDevice(const ble_gap_event* event, uint8_t eventType) {
+    reset(event, eventType);
+} // NimBLEAdvertisedDevice
+
+/**
+ * @brief Re-initialize this device from a new advertisement.
+ * @param [in] event The advertisement event data.
+ * @details Used by NimBLEScan to reuse a pooled device, the payload keeps its allocated capacity.
+ */
+void NimBLEAdvertisedDevice::reset(const ble_gap_event* event, uint8_t eventType) {
 # if CONFIG_BT_NIMBLE_EXT_ADV
-    : m_address{event->ext_disc.addr},
-      m_advType{eventType},
-      m_rssi{event->ext_disc.rssi},
-      m_callbackSent{0},
-      m_advLength{event->ext_disc.length_data},
-      m_isLegacyAdv{!!(event->ext_disc.props & BLE_HCI_ADV_LEGACY_MASK)},
-      m_dataStatus{event->ext_disc.data_status},
-      m_sid{event->ext_disc.sid},
-      m_primPhy{event->ext_disc.prim_phy},
-      m_secPhy{event->ext_disc.sec_phy},
-      m_periodicItvl{event->ext_disc.periodic_adv_itvl},
-      m_payload(event->ext_disc.data, event->ext_disc.data + event->ext_disc.length_data) {
+    const auto& disc = event->ext_disc;
+    m_isLegacyAdv    = disc.props & BLE_HCI_ADV_LEGACY_MASK;
+    m_dataStatus     = disc.data_status;
+    m_sid            = disc.sid;
+    m_primPhy        = disc.prim_phy;
+    m_secPhy         = disc.sec_phy;
+    m_periodicItvl   = disc.periodic_adv_itvl;
 # else
-    : m_address{event->disc.addr},
-      m_advType{eventType},
-      m_rssi{event->disc.rssi},
-      m_callbackSent{0},
-      m_advLength{event->disc.length_data},
-      m_payload(event->disc.data, event->disc.data + event->disc.length_data) {
+    const auto& disc = event->disc;
 # endif
-} // NimBLEAdvertisedDevice
+
+    m_address      = NimBLEAddress{disc.addr};
+    m_advType      = eventType;
+    m_rssi         = disc.rssi;
+    m_callbackSent = 0;
+    m_advLength    = disc.length_data;
+    m_payload.assign(disc.data, disc.data + disc.length_data);
+    m_advIndexValid = false;
+    m_lruPrev       = nullptr;
+    m_lruNext       = nullptr;
+} // reset
 
 /**
  * @brief Update the advertisement data.
  * @param [in] event The advertisement event data.
  */
 void NimBLEAdvertisedDevice::update(const ble_gap_event* event, uint8_t eventType) {
+    m_advIndexValid = false; // payload changes
+
 # if CONFIG_BT_NIMBLE_EXT_ADV
     const auto& disc = event->ext_disc;
     if (m_dataStatus == BLE_GAP_EXT_ADV_DATA_STATUS_INCOMPLETE) {
@@ -641,7 +652,116 @@ uint8_t NimBLEAdvertisedDevice::getDataStatus() const {
 } // getDataStatus
 # endif
 
+/**
+ * @brief Get the number of items in an advertisement field, as counted by findAdvField.
+ * @param [in] field The advertisement field.
+ */
+static uint8_t advFieldCount(const ble_hs_adv_field* field) {
+    switch (field->type) {
+        case BLE_HS_ADV_TYPE_INCOMP_UUIDS16:
+        case BLE_HS_ADV_TYPE_COMP_UUIDS16:
+            return field->length / 2;
+
+        case BLE_HS_ADV_TYPE_INCOMP_UUIDS32:
+        case BLE_HS_ADV_TYPE_COMP_UUIDS32:
+            return field->length / 4;
+
+        case BLE_HS_ADV_TYPE_INCOMP_UUIDS128:
+        case BLE_HS_ADV_TYPE_COMP_UUIDS128:
+            return field->length / 16;
+
+        case BLE_HS_ADV_TYPE_PUBLIC_TGT_ADDR:
+        case BLE_HS_ADV_TYPE_RANDOM_TGT_ADDR:
+            return field->length / 6;
+
+        default:
+            return 1;
+    }
+} // advFieldCount
+
+/**
+ * @brief Index the AD types in the payload with a single pass over the fields.
+ * @details The walk stops where findAdvField would so both give the same results.
+ */
+void NimBLEAdvertisedDevice::buildAdvIndex() const {
+    size_t length   = m_payload.size();
+    size_t data     = 0;
+    m_advIndexCount = 0;
+    m_advIndexFull  = false;
+
+    while (length > 2) {
+        const ble_hs_adv_field* field = reinterpret_cast<const ble_hs_adv_field*>(&m_payload[data]);
+        if (field->length >= length) {
+            break;
+        }
+
+        AdvIndexEntry* entry = nullptr;
+        for (uint8_t i = 0; i < m_advIndexCount; i++) {
+            if (m_advIndex[i].type == field->type) {
+                entry = &m_advIndex[i];
+                break;
+            }
+        }
+
+        if (entry == nullptr) {
+            if (m_advIndexCount < ADV_INDEX_SIZE) {
+                entry         = &m_advIndex[m_advIndexCount++];
+                entry->type   = field->type;
+                entry->fields = 0;
+                entry->count  = 0;
+                entry->offset = data;
+            } else {
+                m_advIndexFull = true;
+            }
+        }
+
+        if (entry != nullptr) {
+            entry->fields++;
+            entry->count += advFieldCount(field);
+        }
+
+        length -= 1 + field->length;
+        data   += 1 + field->length;
+    }
+
+    m_advIndexValid = true;
+} // buildAdvIndex
+
 uint8_t NimBLEAdvertisedDevice::findAdvField(uint8_t type, uint8_t index, size_t* data_loc) const {
+    if (!m_advIndexValid) {
+        buildAdvIndex();
+    }
+
+    if (!m_advIndexFull) {
+        const AdvIndexEntry* entry  = nullptr;
+        const AdvIndexEntry* incomp = nullptr;
+        for (uint8_t i = 0; i < m_advIndexCount; i++) {
+            if (m_advIndex[i].type == type) {
+                entry = &m_advIndex[i];
+            } else if (type == BLE_HS_ADV_TYPE_COMP_NAME && m_advIndex[i].type == BLE_HS_ADV_TYPE_INCOMP_NAME) {
+                incomp = &m_advIndex[i];
+            }
+        }
+
+        const uint8_t fields = (entry ? entry->fields : 0) + (incomp ? incomp->fields : 0);
+        if (data_loc == nullptr || fields == 0) {
+            return (entry ? entry->count : 0) + (incomp ? incomp->count : 0);
+        }
+
+        // The common case, only one field to look in. Otherwise walk the payload to find the indexed item.
+        if (fields == 1) {
+            if (entry == nullptr) {
+                *data_loc = incomp->offset; // the incomplete name is used if there is no complete name
+                return incomp->count;
+            }
+
+            if (entry->count > index) {
+                *data_loc = entry->offset;
+            }
+            return entry->count;
+        }
+    }
+
     size_t  length = m_payload.size();
     size_t  data   = 0;
     uint8_t count  = 0;
@@ -154,8 +154,10 @@ class NimBLEAdvertisedDevice {
     friend class NimBLEScan;
 
     NimBLEAdvertisedDevice(const ble_gap_event* event, uint8_t eventType);
+    void    reset(const ble_gap_event* event, uint8_t eventType);
     void    update(const ble_gap_event* event, uint8_t eventType);
     uint8_t findAdvField(uint8_t type, uint8_t index = 0, size_t* data_loc = nullptr) const;
+    void    buildAdvIndex() const;
     size_t  findServiceData(uint8_t index, uint8_t* bytes) const;
 
     NimBLEAddress m_address{};
@@ -174,6 +176,23 @@ class NimBLEAdvertisedDevice {
 # endif
 
     std::vector<uint8_t> m_payload;
+
+    // One entry per AD type in the payload, built on the first lookup after the payload changes.
+    static const uint8_t ADV_INDEX_SIZE = 8;
+    struct AdvIndexEntry {
+        uint8_t  type;
+        uint8_t  fields; // number of fields of this type
+        uint8_t  count;  // number of items (UUIDs, addresses...) in those fields, as returned by findAdvField
+        uint16_t offset; // first field of this type
+    };
+    mutable AdvIndexEntry m_advIndex[ADV_INDEX_SIZE];
+    mutable uint8_t       m_advIndexCount{0};
+    mutable bool          m_advIndexValid{false};
+    mutable bool          m_advIndexFull{false}; // more types than entries, lookups walk the payload
+
+    // Least recently seen list, maintained by NimBLEScan.
+    NimBLEAdvertisedDevice* m_lruPrev{nullptr};
+    NimBLEAdvertisedDevice* m_lruNext{nullptr};
 };
 
 #endif /* CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_ROLE_OBSERVER */
@@ -20,8 +20,10 @@
 
 # if defined(CONFIG_NIMBLE_CPP_IDF)
 #  include "nimble/nimble_npl.h"
+#  include "os/os_mbuf.h"
 # else
 #  include "nimble/nimble/include/nimble/nimble_npl.h"
+#  include "nimble/porting/nimble/include/os/os_mbuf.h"
 # endif
 
 # include "NimBLELog.h"
@@ -110,15 +112,11 @@ bool NimBLEAttValue::setValue(const uint8_t* value, uint16_t len) {
     return memcmp(m_attr_value, value, len) == 0 && m_attr_len == len;
 }
 
-// Append the new data, allocate as necessary.
-NimBLEAttValue& NimBLEAttValue::append(const uint8_t* value, uint16_t len) {
-    if (len == 0) {
-        return *this;
-    }
-
+// Make room for len more bytes, returns the buffer or nullptr if the value would be too long.
+uint8_t* NimBLEAttValue::reserve(uint16_t len) {
     if ((m_attr_len + len) > m_attr_max_len) {
         NIMBLE_LOGE(LOG_TAG, "val > max, len=%u, max=%u", len, m_attr_max_len);
-        return *this;
+        return nullptr;
     }
 
     uint8_t* res     = m_attr_value;
@@ -130,6 +128,19 @@ NimBLEAttValue& NimBLEAttValue::append(const uint8_t* value, uint16_t len) {
     NIMBLE_CPP_DEBUG_ASSERT(res);
     if (res == nullptr) {
         NIMBLE_LOGE(LOG_TAG, "Failed to realloc append");
+    }
+
+    return res;
+}
+
+// Append the new data, allocate as necessary.
+NimBLEAttValue& NimBLEAttValue::append(const uint8_t* value, uint16_t len) {
+    if (len == 0) {
+        return *this;
+    }
+
+    uint8_t* res = reserve(len);
+    if (res == nullptr) {
         return *this;
     }
 
@@ -139,6 +150,7 @@ NimBLEAttValue& NimBLEAttValue::append(const uint8_t* value, uint16_t len) {
     time_t t = 0;
 # endif
 
+    uint16_t new_len = m_attr_len + len;
     ble_npl_hw_enter_critical();
     memcpy(res + m_attr_len, value, len);
     m_attr_value             = res;
@@ -150,6 +162,55 @@ NimBLEAttValue& NimBLEAttValue::append(const uint8_t* value, uint16_t len) {
     return *this;
 }
 
+bool NimBLEAttValue::setValueFromMbuf(const os_mbuf* om) {
+    uint16_t len = OS_MBUF_PKTLEN(om);
+    m_attr_len      = 0;
+    m_attr_value[0] = '\0';
+    appendFromMbuf(om);
+    return m_attr_len == len;
+}
+
+// Append the data of each mbuf in the chain, a few segments at a time.
+NimBLEAttValue& NimBLEAttValue::appendFromMbuf(const os_mbuf* om) {
+    uint16_t len = OS_MBUF_PKTLEN(om);
+    if (len == 0) {
+        return *this;
+    }
+
+    uint8_t* res = reserve(len);
+    if (res == nullptr) {
+        return *this;
+    }
+
+# if CONFIG_NIMBLE_CPP_ATT_VALUE_TIMESTAMP_ENABLED
+    time_t t = time(nullptr);
+# else
+    time_t t = 0;
+# endif
+
+    os_mbuf_iovec iov[4];
+    uint16_t      off = 0;
+    ble_npl_hw_enter_critical();
+    while (off < len) {
+        int cnt = os_mbuf_to_iovec(om, off, len - off, iov, 4);
+        if (cnt <= 0) {
+            break;
+        }
+
+        for (int i = 0; i < cnt && i < 4; i++) {
+            memcpy(res + m_attr_len + off, iov[i].iov_base, iov[i].iov_len);
+            off += iov[i].iov_len;
+        }
+    }
+    m_attr_value             = res;
+    m_attr_len              += off;
+    m_attr_value[m_attr_len] = '\0';
+    setTimeStamp(t);
+    ble_npl_hw_exit_critical(0);
+
+    return *this;
+}
+
 uint8_t NimBLEAttValue::operator[](int pos) const {
     NIMBLE_CPP_DEBUG_ASSERT(pos < m_attr_len);
     if (pos >= m_attr_len) {
@@ -47,6 +47,8 @@
 #  error CONFIG_NIMBLE_CPP_ATT_VALUE_INIT_LENGTH cannot be less than 1; Range = 1 : 512
 # endif
 
+struct os_mbuf;
+
 /* Used to determine if the type passed to a template has a data() and size() method. */
 template <typename T, typename = void, typename = void>
 struct Has_data_size : std::false_type {};
@@ -86,6 +88,7 @@ class NimBLEAttValue {
     time_t m_timestamp{};
 # endif
     void deepCopy(const NimBLEAttValue& source);
+    uint8_t* reserve(uint16_t len);
 
   public:
     /**
@@ -235,6 +238,21 @@ class NimBLEAttValue {
      */
     NimBLEAttValue& append(const uint8_t* value, uint16_t len);
 
+    /**
+     * @brief Set the value from an mbuf chain received by the stack.
+     * @param[in] om A packet header mbuf chain containing the value.
+     * @returns True if successful.
+     * @details Each mbuf of the chain is copied straight into the value, without flattening the chain first.
+     */
+    bool setValueFromMbuf(const os_mbuf* om);
+
+    /**
+     * @brief Append the data of an mbuf chain received by the stack.
+     * @param[in] om A packet header mbuf chain containing the data to append.
+     * @returns A reference to the appended NimBLEAttValue.
+     */
+    NimBLEAttValue& appendFromMbuf(const os_mbuf* om);
+
     /*********************** Template Functions ************************/
 
 # if __cplusplus < 201703L
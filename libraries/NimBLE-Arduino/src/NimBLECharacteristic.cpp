@@ -325,8 +325,8 @@ void NimBLECharacteristic::readEvent(NimBLEConnInfo& connInfo) {
     m_pCallbacks->onRead(this, connInfo);
 } // readEvent
 
-void NimBLECharacteristic::writeEvent(const uint8_t* val, uint16_t len, NimBLEConnInfo& connInfo) {
-    setValue(val, len);
+void NimBLECharacteristic::writeEvent(const os_mbuf* om, NimBLEConnInfo& connInfo) {
+    m_value.setValueFromMbuf(om);
     m_pCallbacks->onWrite(this, connInfo);
 } // writeEvent
 
@@ -275,7 +275,7 @@ class NimBLECharacteristic : public NimBLELocalValueAttribute {
 
     void setService(NimBLEService* pService);
     void readEvent(NimBLEConnInfo& connInfo) override;
-    void writeEvent(const uint8_t* val, uint16_t len, NimBLEConnInfo& connInfo) override;
+    void writeEvent(const os_mbuf* om, NimBLEConnInfo& connInfo) override;
     bool sendValue(const uint8_t* value,
                    size_t         length,
                    bool           is_notification = true,
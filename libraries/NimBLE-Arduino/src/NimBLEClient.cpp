@@ -20,16 +20,21 @@
 
 # include "NimBLERemoteService.h"
 # include "NimBLERemoteCharacteristic.h"
+# include "NimBLERemoteDescriptor.h"
+# include "NimBLEGattCacheStore.h"
 # include "NimBLEDevice.h"
 # include "NimBLELog.h"
 
 # if defined(CONFIG_NIMBLE_CPP_IDF)
 #  include "nimble/nimble_port.h"
+#  include "os/endian.h"
 # else
 #  include "nimble/porting/nimble/include/nimble/nimble_port.h"
+#  include "nimble/porting/nimble/include/os/endian.h"
 # endif
 
 # include <climits>
+# include <cstring>
 
 static const char*           LOG_TAG = "NimBLEClient";
 static NimBLEClientCallbacks defaultCallbacks;
@@ -68,6 +73,9 @@ NimBLEClient::NimBLEClient(const NimBLEAddress& peerAddress)
       m_terminateFailCount{0},
       m_asyncSecureAttempt{0},
       m_config{},
+      m_cacheChecked{false},
+      m_dbHashValid{false},
+      m_dbHash{},
 # if CONFIG_BT_NIMBLE_EXT_ADV
       m_phyMask{BLE_GAP_LE_PHY_1M_MASK | BLE_GAP_LE_PHY_2M_MASK | BLE_GAP_LE_PHY_CODED_MASK},
 # endif
@@ -105,6 +113,7 @@ void NimBLEClient::deleteServices() {
     }
 
     std::vector<NimBLERemoteService*>().swap(m_svcVec);
+    m_cacheChecked = false;
 } // deleteServices
 
 /**
@@ -645,6 +654,19 @@ NimBLERemoteService* NimBLEClient::getService(const NimBLEUUID& uuid) {
         }
     }
 
+    // The cache holds the whole database, if it was restored a service that is not in it doesn't exist.
+    if (m_svcVec.empty() && loadAttributeCache()) {
+        for (auto& it : m_svcVec) {
+            if (it->getUUID() == uuid) {
+                NIMBLE_LOGD(LOG_TAG, "<< getService: found the service in the attribute cache");
+                return it;
+            }
+        }
+
+        NIMBLE_LOGD(LOG_TAG, "<< getService: not found");
+        return nullptr;
+    }
+
     size_t prevSize = m_svcVec.size();
     if (retrieveServices(&uuid)) {
         if (m_svcVec.size() > prevSize) {
@@ -691,7 +713,9 @@ NimBLERemoteService* NimBLEClient::getService(const NimBLEUUID& uuid) {
 const std::vector<NimBLERemoteService*>& NimBLEClient::getServices(bool refresh) {
     if (refresh) {
         deleteServices();
-        if (!retrieveServices()) {
+        if (loadAttributeCache()) {
+            NIMBLE_LOGI(LOG_TAG, "Found %d services in the attribute cache", m_svcVec.size());
+        } else if (!retrieveServices()) {
             NIMBLE_LOGE(LOG_TAG, "Error: Failed to get services");
         } else {
             NIMBLE_LOGI(LOG_TAG, "Found %d services", m_svcVec.size());
@@ -704,9 +728,15 @@ const std::vector<NimBLERemoteService*>& NimBLEClient::getServices(bool refresh)
 /**
  * @brief Retrieves the full database of attributes that the peripheral has available.
  * @return True if successful.
+ * @details If a store is set with NimBLEDevice::setGattCacheStore and the Database Hash of the peer is unchanged
+ * the attributes are created from the stored copy, otherwise they are discovered and the store is updated.
  */
 bool NimBLEClient::discoverAttributes() {
     deleteServices();
+    if (loadAttributeCache()) {
+        return true;
+    }
+
     if (!retrieveServices()) {
         return false;
     }
@@ -723,6 +753,7 @@ bool NimBLEClient::discoverAttributes() {
         }
     }
 
+    storeAttributeCache();
     return true;
 } // discoverAttributes
 
@@ -802,6 +833,267 @@ int NimBLEClient::serviceDiscoveredCB(uint16_t                     connHandle,
     return error->status;
 } // serviceDiscoveredCB
 
+/**
+ * Attribute cache layout, all fields little endian:
+ *  header      magic(2) | version | database hash(16) | service count(2)
+ *  service     start handle(2) | end handle(2) | uuid | characteristic count(2)
+ *  chr         value handle(2) | properties | uuid | descriptor count(2)
+ *  descriptor  handle(2) | uuid
+ *  uuid        size in bytes | value
+ */
+static constexpr uint16_t ATT_CACHE_MAGIC      = 0x4347;
+static constexpr uint8_t  ATT_CACHE_VERSION    = 1;
+static constexpr uint16_t DATABASE_HASH_UUID16 = 0x2b2a; // Database Hash characteristic of the GATT service
+
+static void cachePut16(std::vector<uint8_t>& buf, uint16_t val) {
+    buf.push_back(val & 0xff);
+    buf.push_back(val >> 8);
+} // cachePut16
+
+static void cachePutUuid(std::vector<uint8_t>& buf, const NimBLEUUID& uuid) {
+    const ble_uuid_t* base = uuid.getBase();
+    uint8_t           val[16];
+    uint8_t           len = 0;
+    switch (base->type) {
+        case BLE_UUID_TYPE_16:
+            put_le16(val, BLE_UUID16(base)->value);
+            len = 2;
+            break;
+        case BLE_UUID_TYPE_32:
+            put_le32(val, BLE_UUID32(base)->value);
+            len = 4;
+            break;
+        case BLE_UUID_TYPE_128:
+            memcpy(val, BLE_UUID128(base)->value, 16);
+            len = 16;
+            break;
+        default:
+            break;
+    }
+
+    buf.push_back(len);
+    buf.insert(buf.end(), val, val + len);
+} // cachePutUuid
+
+/**
+ * @brief Reads the attribute cache, any read past the end sets the error flag and returns zeros.
+ */
+struct NimBLEAttCacheReader {
+    const uint8_t* pos;
+    const uint8_t* end;
+    bool           error;
+
+    bool check(size_t len) {
+        error = error || static_cast<size_t>(end - pos) < len;
+        return !error;
+    }
+
+    uint8_t get8() { return check(1) ? *pos++ : 0; }
+
+    uint16_t get16() {
+        if (!check(2)) {
+            return 0;
+        }
+
+        pos += 2;
+        return get_le16(pos - 2);
+    }
+
+    void getUuid(ble_uuid_any_t* uuid) {
+        uint8_t len = get8();
+        if (!check(len) || ble_uuid_init_from_buf(uuid, pos, len) != 0) {
+            error = true;
+            return;
+        }
+
+        pos += len;
+    }
+};
+
+/**
+ * @brief Read the Database Hash characteristic of the peer.
+ * @return True if the hash was read, false if the peer does not have one.
+ */
+bool NimBLEClient::readDatabaseHash() {
+    NimBLEAttValue     value{};
+    NimBLETaskData     taskData(this, 0, &value);
+    const ble_uuid16_t uuid = BLE_UUID16_INIT(DATABASE_HASH_UUID16);
+
+    int rc = ble_gattc_read_by_uuid(m_connHandle, 1, 0xffff, &uuid.u, NimBLEClient::databaseHashCB, &taskData);
+    if (rc != 0) {
+        NIMBLE_LOGE(LOG_TAG, "ble_gattc_read_by_uuid: rc=%d %s", rc, NimBLEUtils::returnCodeToString(rc));
+        return false;
+    }
+
+    NimBLEUtils::taskWait(taskData, BLE_NPL_TIME_FOREVER);
+    rc = taskData.m_flags;
+    if ((rc != 0 && rc != BLE_HS_EDONE) || value.size() != sizeof(m_dbHash)) {
+        NIMBLE_LOGD(LOG_TAG, "Database hash not available, rc=%d %s", rc, NimBLEUtils::returnCodeToString(rc));
+        return false;
+    }
+
+    memcpy(m_dbHash, value.data(), sizeof(m_dbHash));
+    return true;
+} // readDatabaseHash
+
+/**
+ * @brief Callback for the Database Hash read, keeps the first value found.
+ */
+int NimBLEClient::databaseHashCB(uint16_t conn_handle, const ble_gatt_error* error, ble_gatt_attr* attr, void* arg) {
+    auto       pTaskData = static_cast<NimBLETaskData*>(arg);
+    const auto pClient   = static_cast<NimBLEClient*>(pTaskData->m_pInstance);
+
+    if (error->status == BLE_HS_ENOTCONN) {
+        NimBLEUtils::taskRelease(*pTaskData, error->status);
+        return error->status;
+    }
+
+    if (pClient->getConnHandle() != conn_handle) {
+        return 0;
+    }
+
+    if (error->status == 0 && attr != nullptr) {
+        auto value = static_cast<NimBLEAttValue*>(pTaskData->m_pBuf);
+        if (value->size() == 0) {
+            value->setValueFromMbuf(attr->om);
+        }
+        return 0;
+    }
+
+    NimBLEUtils::taskRelease(*pTaskData, error->status);
+    return error->status;
+} // databaseHashCB
+
+/**
+ * @brief Create the remote attributes from the stored attribute cache of the peer.
+ * @return True if the Database Hash of the peer matched the cache and the attributes were restored.
+ * @details This is tried once after the services were deleted, it also reads the Database Hash used to store
+ * the attributes found by the discovery.
+ */
+bool NimBLEClient::loadAttributeCache() {
+    NimBLEGattCacheStore* pStore = NimBLEDevice::getGattCacheStore();
+    if (pStore == nullptr || m_cacheChecked || !isConnected()) {
+        return false;
+    }
+
+    m_cacheChecked = true;
+    m_dbHashValid  = readDatabaseHash();
+    if (!m_dbHashValid) {
+        return false;
+    }
+
+    std::vector<uint8_t> data;
+    if (!pStore->load(getConnInfo().getIdAddress(), data)) {
+        return false;
+    }
+
+    if (!restoreAttributes(data)) {
+        NIMBLE_LOGI(LOG_TAG, "Attribute cache outdated, discovering");
+        return false;
+    }
+
+    NIMBLE_LOGI(LOG_TAG, "Restored %d services from the attribute cache", m_svcVec.size());
+    return true;
+} // loadAttributeCache
+
+/**
+ * @brief Store the discovered attributes with the Database Hash of the peer.
+ */
+void NimBLEClient::storeAttributeCache() const {
+    NimBLEGattCacheStore* pStore = NimBLEDevice::getGattCacheStore();
+    if (pStore == nullptr || !m_dbHashValid) {
+        return;
+    }
+
+    std::vector<uint8_t> data;
+    cachePut16(data, ATT_CACHE_MAGIC);
+    data.push_back(ATT_CACHE_VERSION);
+    data.insert(data.end(), m_dbHash, m_dbHash + sizeof(m_dbHash));
+    cachePut16(data, m_svcVec.size());
+    for (const auto svc : m_svcVec) {
+        cachePut16(data, svc->getStartHandle());
+        cachePut16(data, svc->getEndHandle());
+        cachePutUuid(data, svc->getUUID());
+        cachePut16(data, svc->m_vChars.size());
+        for (const auto chr : svc->m_vChars) {
+            cachePut16(data, chr->getHandle());
+            data.push_back(chr->m_properties);
+            cachePutUuid(data, chr->getUUID());
+            cachePut16(data, chr->m_vDescriptors.size());
+            for (const auto dsc : chr->m_vDescriptors) {
+                cachePut16(data, dsc->getHandle());
+                cachePutUuid(data, dsc->getUUID());
+            }
+        }
+    }
+
+    if (!pStore->store(getConnInfo().getIdAddress(), data)) {
+        NIMBLE_LOGE(LOG_TAG, "Failed to store the attribute cache");
+    }
+} // storeAttributeCache
+
+/**
+ * @brief Create the services, characteristics and descriptors from a stored attribute cache.
+ * @param [in] data The stored attribute cache.
+ * @return True if the cache is valid and was made with the current Database Hash.
+ */
+bool NimBLEClient::restoreAttributes(const std::vector<uint8_t>& data) {
+    NimBLEAttCacheReader reader{data.data(), data.data() + data.size(), false};
+    if (reader.get16() != ATT_CACHE_MAGIC || reader.get8() != ATT_CACHE_VERSION || !reader.check(sizeof(m_dbHash)) ||
+        memcmp(reader.pos, m_dbHash, sizeof(m_dbHash)) != 0) {
+        return false;
+    }
+
+    reader.pos      += sizeof(m_dbHash);
+    uint16_t numSvcs = reader.get16();
+    for (uint16_t i = 0; i < numSvcs && !reader.error; i++) {
+        ble_gatt_svc svc{};
+        svc.start_handle = reader.get16();
+        svc.end_handle   = reader.get16();
+        reader.getUuid(&svc.uuid);
+        if (reader.error) {
+            break;
+        }
+
+        auto pSvc = new NimBLERemoteService(this, &svc);
+        m_svcVec.push_back(pSvc);
+
+        uint16_t numChrs = reader.get16();
+        for (uint16_t j = 0; j < numChrs && !reader.error; j++) {
+            ble_gatt_chr chr{};
+            chr.val_handle = reader.get16();
+            chr.def_handle = chr.val_handle - 1;
+            chr.properties = reader.get8();
+            reader.getUuid(&chr.uuid);
+            if (reader.error) {
+                break;
+            }
+
+            auto pChr = new NimBLERemoteCharacteristic(pSvc, &chr);
+            pSvc->m_vChars.push_back(pChr);
+
+            uint16_t numDscs = reader.get16();
+            for (uint16_t k = 0; k < numDscs && !reader.error; k++) {
+                ble_gatt_dsc dsc{};
+                dsc.handle = reader.get16();
+                reader.getUuid(&dsc.uuid);
+                if (!reader.error) {
+                    pChr->m_vDescriptors.push_back(new NimBLERemoteDescriptor(pChr, &dsc));
+                }
+            }
+        }
+    }
+
+    if (reader.error || reader.pos != reader.end) {
+        NIMBLE_LOGE(LOG_TAG, "Attribute cache corrupted");
+        deleteServices();
+        m_cacheChecked = true;
+        return false;
+    }
+
+    return true;
+} // restoreAttributes
+
 /**
  * @brief Get the value of a specific characteristic associated with a specific service.
  * @param [in] serviceUUID The service that owns the characteristic.
@@ -1069,10 +1361,20 @@ int NimBLEClient::handleGapEvent(struct ble_gap_event* event, void* arg) {
                         NIMBLE_LOGD(LOG_TAG, "Got Notification for characteristic %s", chr->toString().c_str());
 
                         uint32_t data_len = OS_MBUF_PKTLEN(event->notify_rx.om);
-                        chr->m_value.setValue(event->notify_rx.om->om_data, data_len);
+                        chr->m_value.setValueFromMbuf(event->notify_rx.om);
 
                         if (chr->m_notifyCallback != nullptr) {
-                            chr->m_notifyCallback(chr, event->notify_rx.om->om_data, data_len, !event->notify_rx.indication);
+                            // Hand a single buffer notification to the callback as is, a chained one from the value copy.
+                            os_mbuf_iovec  iov;
+                            const uint8_t* data = chr->m_value.data();
+                            if (os_mbuf_to_iovec(event->notify_rx.om, 0, data_len, &iov, 1) == 1) {
+                                data = iov.iov_base;
+                            } else if (chr->m_value.size() != data_len) {
+                                NIMBLE_LOGE(LOG_TAG, "Notification too long for the value, len=%" PRIu32, data_len);
+                                break;
+                            }
+
+                            chr->m_notifyCallback(chr, const_cast<uint8_t*>(data), data_len, !event->notify_rx.indication);
                         }
                         break;
                     }
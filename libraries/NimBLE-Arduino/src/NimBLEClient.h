@@ -119,7 +119,12 @@ class NimBLEClient {
     NimBLEClient& operator=(const NimBLEClient&) = delete;
 
     bool       retrieveServices(const NimBLEUUID* uuidFilter = nullptr);
+    bool       readDatabaseHash();
+    bool       loadAttributeCache();
+    void       storeAttributeCache() const;
+    bool       restoreAttributes(const std::vector<uint8_t>& data);
     static int handleGapEvent(struct ble_gap_event* event, void* arg);
+    static int databaseHashCB(uint16_t conn_handle, const ble_gatt_error* error, ble_gatt_attr* attr, void* arg);
     static int exchangeMTUCb(uint16_t conn_handle, const ble_gatt_error* error, uint16_t mtu, void* arg);
     static int serviceDiscoveredCB(uint16_t                     connHandle,
                                    const struct ble_gatt_error* error,
@@ -136,6 +141,9 @@ class NimBLEClient {
     uint8_t                           m_terminateFailCount;
     mutable uint8_t                   m_asyncSecureAttempt;
     Config                            m_config;
+    bool                              m_cacheChecked; // the attribute cache was tried since the services were deleted
+    bool                              m_dbHashValid;
+    uint8_t                           m_dbHash[16];
 
 # if CONFIG_BT_NIMBLE_EXT_ADV
     uint8_t m_phyMask;
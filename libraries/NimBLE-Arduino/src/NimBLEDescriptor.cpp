@@ -124,8 +124,8 @@ void NimBLEDescriptor::readEvent(NimBLEConnInfo& connInfo) {
     m_pCallbacks->onRead(this, connInfo);
 } // readEvent
 
-void NimBLEDescriptor::writeEvent(const uint8_t* val, uint16_t len, NimBLEConnInfo& connInfo) {
-    setValue(val, len);
+void NimBLEDescriptor::writeEvent(const os_mbuf* om, NimBLEConnInfo& connInfo) {
+    m_value.setValueFromMbuf(om);
     m_pCallbacks->onWrite(this, connInfo);
 } // writeEvent
 
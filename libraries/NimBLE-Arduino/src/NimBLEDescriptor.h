@@ -50,7 +50,7 @@ class NimBLEDescriptor : public NimBLELocalValueAttribute {
 
     void setCharacteristic(NimBLECharacteristic* pChar);
     void readEvent(NimBLEConnInfo& connInfo) override;
-    void writeEvent(const uint8_t* val, uint16_t len, NimBLEConnInfo& connInfo) override;
+    void writeEvent(const os_mbuf* om, NimBLEConnInfo& connInfo) override;
 
     NimBLEDescriptorCallbacks* m_pCallbacks{nullptr};
     NimBLECharacteristic*      m_pCharacteristic{nullptr};
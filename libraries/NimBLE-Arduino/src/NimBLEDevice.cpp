@@ -89,6 +89,7 @@ NimBLEAdvertising* NimBLEDevice::m_bleAdvertising = nullptr;
 
 # if CONFIG_BT_NIMBLE_ROLE_CENTRAL
 std::array<NimBLEClient*, NIMBLE_MAX_CONNECTIONS> NimBLEDevice::m_pClients{};
+NimBLEGattCacheStore*                             NimBLEDevice::m_pGattCacheStore = nullptr;
 # endif
 
 bool                       NimBLEDevice::m_initialized{false};
@@ -462,6 +463,25 @@ std::vector<NimBLEClient*> NimBLEDevice::getConnectedClients() {
     return clients;
 } // getConnectedClients
 
+/**
+ * @brief Set the storage of the attribute databases discovered by the clients.
+ * @param [in] pStore A pointer to the store, nullptr to disable the cache (default).
+ * @details With a store set, NimBLEClient::discoverAttributes saves the database of the peer with its Database Hash
+ * and the next connection to the peer creates the remote attributes from the saved copy if the hash is unchanged.
+ * The store must remain valid while it is set.
+ */
+void NimBLEDevice::setGattCacheStore(NimBLEGattCacheStore* pStore) {
+    m_pGattCacheStore = pStore;
+} // setGattCacheStore
+
+/**
+ * @brief Get the storage of the attribute databases discovered by the clients.
+ * @return A pointer to the store or nullptr if none is set.
+ */
+NimBLEGattCacheStore* NimBLEDevice::getGattCacheStore() {
+    return m_pGattCacheStore;
+} // getGattCacheStore
+
 # endif // CONFIG_BT_NIMBLE_ROLE_CENTRAL
 
 /* -------------------------------------------------------------------------- */
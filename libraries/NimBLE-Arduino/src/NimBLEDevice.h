@@ -43,6 +43,7 @@
 # if CONFIG_BT_NIMBLE_ROLE_CENTRAL
 #  include <array>
 class NimBLEClient;
+class NimBLEGattCacheStore;
 # endif
 
 # if CONFIG_BT_NIMBLE_ROLE_OBSERVER
@@ -205,6 +206,8 @@ class NimBLEDevice {
     static NimBLEClient*              getDisconnectedClient();
     static size_t                     getCreatedClientCount();
     static std::vector<NimBLEClient*> getConnectedClients();
+    static void                       setGattCacheStore(NimBLEGattCacheStore* pStore);
+    static NimBLEGattCacheStore*      getGattCacheStore();
 # endif
 
 # if CONFIG_BT_NIMBLE_ROLE_CENTRAL || CONFIG_BT_NIMBLE_ROLE_PERIPHERAL
@@ -246,6 +249,7 @@ class NimBLEDevice {
 
 # if CONFIG_BT_NIMBLE_ROLE_CENTRAL
     static std::array<NimBLEClient*, NIMBLE_MAX_CONNECTIONS> m_pClients;
+    static NimBLEGattCacheStore*                             m_pGattCacheStore;
 # endif
 
 # ifdef ESP_PLATFORM
@@ -283,6 +287,7 @@ class NimBLEDevice {
 #  include "NimBLERemoteService.h"
 #  include "NimBLERemoteCharacteristic.h"
 #  include "NimBLERemoteDescriptor.h"
+#  include "NimBLEGattCacheStore.h"
 # endif
 
 # if CONFIG_BT_NIMBLE_ROLE_OBSERVER
@@ -293,10 +298,12 @@ class NimBLEDevice {
 #  include "NimBLEServer.h"
 #  include "NimBLEService.h"
 #  include "NimBLECharacteristic.h"
+#  include "NimBLENotifyStream.h"
 #  include "NimBLEDescriptor.h"
 #  if CONFIG_BT_NIMBLE_L2CAP_COC_MAX_NUM
 #   include "NimBLEL2CAPServer.h"
 #   include "NimBLEL2CAPChannel.h"
+#   include "NimBLEL2CAPBulkTransfer.h"
 #  endif
 # endif
 
@@ -0,0 +1,193 @@
+/*
+ * Copyright 2020-2025 Ryan Powell <ryan@nable-embedded.io> and
+ * esp-nimble-cpp, NimBLE-Arduino contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NimBLEGattCacheStore.h"
+#if CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_ROLE_CENTRAL
+
+# include "NimBLELog.h"
+
+# if defined(ESP_PLATFORM)
+#  include "nvs.h"
+# endif
+
+# include <cstdio>
+
+static const char* LOG_TAG = "NimBLEGattCacheStore";
+
+/**
+ * @brief Get the key of a peer, "gc" followed by the address and its type in hex.
+ * @param [in] peer The address of the peer.
+ * @return The key, 15 characters to fit the NVS key length.
+ */
+std::string NimBLEGattCacheStore::getKey(const NimBLEAddress& peer) {
+    const uint8_t* val = peer.getVal();
+    char           key[16];
+    snprintf(key,
+             sizeof(key),
+             "gc%02x%02x%02x%02x%02x%02x%01x",
+             val[5],
+             val[4],
+             val[3],
+             val[2],
+             val[1],
+             val[0],
+             peer.getType() & 0x0f);
+    return std::string(key);
+} // getKey
+
+# if defined(ESP_PLATFORM)
+/**
+ * @brief Construct an NVS store.
+ * @param [in] nvsNamespace The NVS namespace of the entries, must remain valid while the store is used.
+ */
+NimBLEGattCacheNvsStore::NimBLEGattCacheNvsStore(const char* nvsNamespace) : m_namespace{nvsNamespace} {}
+
+/**
+ * @brief Read the stored database of a peer from NVS.
+ */
+bool NimBLEGattCacheNvsStore::load(const NimBLEAddress& peer, std::vector<uint8_t>& data) {
+    nvs_handle_t handle;
+    if (nvs_open(m_namespace, NVS_READONLY, &handle) != ESP_OK) {
+        return false; // the namespace doesn't exist before the first store
+    }
+
+    std::string key = getKey(peer);
+    size_t      len = 0;
+    esp_err_t   err = nvs_get_blob(handle, key.c_str(), nullptr, &len);
+    if (err == ESP_OK) {
+        data.resize(len);
+        err = nvs_get_blob(handle, key.c_str(), data.data(), &len);
+    }
+
+    nvs_close(handle);
+    return err == ESP_OK;
+} // load
+
+/**
+ * @brief Write the database of a peer to NVS.
+ */
+bool NimBLEGattCacheNvsStore::store(const NimBLEAddress& peer, const std::vector<uint8_t>& data) {
+    nvs_handle_t handle;
+    esp_err_t    err = nvs_open(m_namespace, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        NIMBLE_LOGE(LOG_TAG, "nvs_open failed, err=%d", err);
+        return false;
+    }
+
+    err = nvs_set_blob(handle, getKey(peer).c_str(), data.data(), data.size());
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+
+    nvs_close(handle);
+    if (err != ESP_OK) {
+        NIMBLE_LOGE(LOG_TAG, "Failed to store the attribute cache, err=%d", err);
+    }
+
+    return err == ESP_OK;
+} // store
+
+/**
+ * @brief Remove the database of a peer from NVS.
+ */
+bool NimBLEGattCacheNvsStore::erase(const NimBLEAddress& peer) {
+    nvs_handle_t handle;
+    if (nvs_open(m_namespace, NVS_READWRITE, &handle) != ESP_OK) {
+        return true;
+    }
+
+    esp_err_t err = nvs_erase_key(handle, getKey(peer).c_str());
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+
+    nvs_close(handle);
+    return err == ESP_OK || err == ESP_ERR_NVS_NOT_FOUND;
+} // erase
+# endif // ESP_PLATFORM
+
+/**
+ * @brief Construct a file store.
+ * @param [in] directory The existing directory to keep the files in, e.g. "/spiffs".
+ */
+NimBLEGattCacheFileStore::NimBLEGattCacheFileStore(const std::string& directory) : m_directory{directory} {}
+
+/**
+ * @brief Get the path of the file of a peer.
+ */
+std::string NimBLEGattCacheFileStore::getPath(const NimBLEAddress& peer) const {
+    return m_directory + "/" + getKey(peer);
+} // getPath
+
+/**
+ * @brief Read the stored database of a peer from its file.
+ */
+bool NimBLEGattCacheFileStore::load(const NimBLEAddress& peer, std::vector<uint8_t>& data) {
+    FILE* file = fopen(getPath(peer).c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    bool ok  = fseek(file, 0, SEEK_END) == 0;
+    long len = ok ? ftell(file) : -1;
+    ok       = len >= 0 && fseek(file, 0, SEEK_SET) == 0;
+    if (ok) {
+        data.resize(len);
+        ok = fread(data.data(), 1, len, file) == static_cast<size_t>(len);
+    }
+
+    fclose(file);
+    return ok;
+} // load
+
+/**
+ * @brief Write the database of a peer to its file.
+ */
+bool NimBLEGattCacheFileStore::store(const NimBLEAddress& peer, const std::vector<uint8_t>& data) {
+    std::string path = getPath(peer);
+    FILE*       file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        NIMBLE_LOGE(LOG_TAG, "Failed to open %s", path.c_str());
+        return false;
+    }
+
+    bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok      = fclose(file) == 0 && ok;
+    if (!ok) {
+        // Don't leave a truncated file to be loaded on the next connection.
+        remove(path.c_str());
+        NIMBLE_LOGE(LOG_TAG, "Failed to write %s", path.c_str());
+    }
+
+    return ok;
+} // store
+
+/**
+ * @brief Remove the file of a peer.
+ */
+bool NimBLEGattCacheFileStore::erase(const NimBLEAddress& peer) {
+    std::string path = getPath(peer);
+    FILE*       file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return true;
+    }
+
+    fclose(file);
+    return remove(path.c_str()) == 0;
+} // erase
+
+#endif // CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_ROLE_CENTRAL
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2020-2025 Ryan Powell <ryan@nable-embedded.io> and
+ * esp-nimble-cpp, NimBLE-Arduino contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NIMBLE_CPP_GATT_CACHE_STORE_H_
+#define NIMBLE_CPP_GATT_CACHE_STORE_H_
+
+#include "nimconfig.h"
+#if CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_ROLE_CENTRAL
+
+# include "NimBLEAddress.h"
+
+# include <cstdint>
+# include <string>
+# include <vector>
+
+/**
+ * @brief Storage for the attribute databases discovered by NimBLEClient.
+ * @details When a store is set with NimBLEDevice::setGattCacheStore the client saves the services, characteristics
+ * and descriptors found by NimBLEClient::discoverAttributes together with the Database Hash of the peer.
+ * On the next connection the client reads the Database Hash and, if it is unchanged, creates the remote
+ * attributes from the stored copy instead of discovering them again.\n
+ * Derive from this class to keep the databases in any key-value storage, one entry per peer.
+ */
+class NimBLEGattCacheStore {
+  public:
+    virtual ~NimBLEGattCacheStore() = default;
+
+    /**
+     * @brief Read the stored database of a peer.
+     * @param [in] peer The identity address of the peer.
+     * @param [out] data The stored data.
+     * @return True if an entry was found.
+     */
+    virtual bool load(const NimBLEAddress& peer, std::vector<uint8_t>& data) = 0;
+
+    /**
+     * @brief Store the database of a peer, replacing a previous entry.
+     * @param [in] peer The identity address of the peer.
+     * @param [in] data The data to store.
+     * @return True on success.
+     */
+    virtual bool store(const NimBLEAddress& peer, const std::vector<uint8_t>& data) = 0;
+
+    /**
+     * @brief Remove the stored database of a peer.
+     * @param [in] peer The identity address of the peer.
+     * @return True if nothing is stored for the peer afterwards.
+     */
+    virtual bool erase(const NimBLEAddress& peer) = 0;
+
+  protected:
+    static std::string getKey(const NimBLEAddress& peer);
+};
+
+# if defined(ESP_PLATFORM)
+/**
+ * @brief Keeps the attribute databases in an NVS namespace, the NVS partition is initialized by NimBLEDevice::init.
+ */
+class NimBLEGattCacheNvsStore : public NimBLEGattCacheStore {
+  public:
+    NimBLEGattCacheNvsStore(const char* nvsNamespace = "nimble_gattc");
+
+    bool load(const NimBLEAddress& peer, std::vector<uint8_t>& data) override;
+    bool store(const NimBLEAddress& peer, const std::vector<uint8_t>& data) override;
+    bool erase(const NimBLEAddress& peer) override;
+
+  private:
+    const char* m_namespace;
+};
+# endif
+
+/**
+ * @brief Keeps the attribute databases as one file per peer in a directory, e.g. on a mounted filesystem.
+ */
+class NimBLEGattCacheFileStore : public NimBLEGattCacheStore {
+  public:
+    NimBLEGattCacheFileStore(const std::string& directory);
+
+    bool load(const NimBLEAddress& peer, std::vector<uint8_t>& data) override;
+    bool store(const NimBLEAddress& peer, const std::vector<uint8_t>& data) override;
+    bool erase(const NimBLEAddress& peer) override;
+
+  private:
+    std::string getPath(const NimBLEAddress& peer) const;
+
+    std::string m_directory;
+};
+
+#endif // CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_ROLE_CENTRAL
+#endif // NIMBLE_CPP_GATT_CACHE_STORE_H_
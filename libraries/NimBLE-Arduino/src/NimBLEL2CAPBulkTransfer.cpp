@@ -0,0 +1,432 @@
+/*
+ * Copyright 2020-2025 Ryan Powell <ryan@nable-embedded.io> and
+ * esp-nimble-cpp, NimBLE-Arduino contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NimBLEL2CAPBulkTransfer.h"
+#if CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_L2CAP_COC_MAX_NUM
+
+# include "NimBLEDevice.h"
+# include "NimBLELog.h"
+
+# if defined(CONFIG_NIMBLE_CPP_IDF)
+#  include "os/endian.h"
+# else
+#  include "nimble/porting/nimble/include/os/endian.h"
+# endif
+
+# include <algorithm>
+
+/**
+ * Frame layout, all fields little endian, one frame per SDU:
+ *  BEGIN  type | id(4) | size(4)
+ *  BLOCK  type | id(4) | offset(4) | crc32(4) | payload
+ *  ACK    type | id(4) | offset(4) | window(2)   all bytes before offset are stored
+ *  RESUME type | id(4) | offset(4) | window(2)   as ACK, and the sender must continue from offset
+ */
+enum : uint8_t {
+    BULK_FRAME_BEGIN  = 0x01,
+    BULK_FRAME_BLOCK  = 0x02,
+    BULK_FRAME_ACK    = 0x03,
+    BULK_FRAME_RESUME = 0x04,
+};
+
+static constexpr size_t BULK_BEGIN_LEN = 9;
+static constexpr size_t BULK_BLOCK_HDR = 13;
+static constexpr size_t BULK_ACK_LEN   = 11;
+
+/**
+ * @brief CRC-32 (IEEE 802.3) with a 16 entry table.
+ */
+static uint32_t bulkCrc32(const uint8_t* data, size_t length) {
+    static const uint32_t table[16] = {0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4,
+                                       0x4db26158, 0x5005713c, 0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+                                       0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c};
+    uint32_t              crc      = 0xffffffff;
+    while (length--) {
+        crc ^= *data++;
+        crc  = (crc >> 4) ^ table[crc & 0x0f];
+        crc  = (crc >> 4) ^ table[crc & 0x0f];
+    }
+    return ~crc;
+} // bulkCrc32
+
+/**
+ * @brief Forwards the channel events to the transfer, owned and deleted by the channel.
+ */
+class NimBLEL2CAPBulkTransfer::ChannelCallbacks : public NimBLEL2CAPChannelCallbacks {
+  public:
+    explicit ChannelCallbacks(NimBLEL2CAPBulkTransfer* pTransfer) : m_pTransfer(pTransfer) {}
+
+    void onConnect(NimBLEL2CAPChannel* channel, uint16_t negotiatedMTU) override {
+        m_pTransfer->handleConnect(channel, negotiatedMTU);
+    }
+
+    void onRead(NimBLEL2CAPChannel* channel, std::vector<uint8_t>& data) override {
+        m_pTransfer->handleFrame(data.data(), data.size());
+    }
+
+    void onDisconnect(NimBLEL2CAPChannel* channel) override { m_pTransfer->handleDisconnect(); }
+
+  private:
+    NimBLEL2CAPBulkTransfer* m_pTransfer;
+};
+
+NimBLEL2CAPBulkTransfer::NimBLEL2CAPBulkTransfer(uint16_t psm, NimBLEL2CAPBulkTransferCallbacks* callbacks, uint16_t mtu)
+    : m_psm(psm), m_mtu(std::max<uint16_t>(mtu, BULK_BLOCK_HDR + 1)), m_pCallbacks(callbacks) {
+    assert(callbacks); // fail here, if no callbacks are given
+    ble_npl_sem_init(&m_txSem, 0);
+}
+
+NimBLEL2CAPBulkTransfer::~NimBLEL2CAPBulkTransfer() {
+    ble_npl_sem_deinit(&m_txSem);
+}
+
+# if CONFIG_BT_NIMBLE_ROLE_PERIPHERAL
+bool NimBLEL2CAPBulkTransfer::listen() {
+    if (m_pChannel != nullptr) {
+        NIMBLE_LOGW(LOG_TAG, "L2CAP bulk 0x%04X already has a channel", m_psm);
+        return false;
+    }
+
+    m_pChannel = NimBLEDevice::createL2CAPServer()->createService(m_psm, m_mtu, new ChannelCallbacks(this));
+    return m_pChannel != nullptr;
+}
+# endif // CONFIG_BT_NIMBLE_ROLE_PERIPHERAL
+
+# if CONFIG_BT_NIMBLE_ROLE_CENTRAL
+bool NimBLEL2CAPBulkTransfer::connect(NimBLEClient* client, uint32_t timeoutMs) {
+    if (m_connected) {
+        return true;
+    }
+
+    // The channel of the previous connection is closed, nothing refers to it anymore.
+    if (m_ownsChannel && m_pChannel != nullptr) {
+        delete m_pChannel;
+    }
+
+    startWaiting();
+    m_pChannel    = NimBLEL2CAPChannel::connect(client, m_psm, m_mtu, new ChannelCallbacks(this));
+    m_ownsChannel = m_pChannel != nullptr;
+    if (m_ownsChannel && !m_connected) {
+        waitSender(timeoutMs);
+    }
+    m_txWaiting = false;
+
+    if (!m_connected) {
+        NIMBLE_LOGE(LOG_TAG, "L2CAP bulk 0x%04X connect failed", m_psm);
+    }
+    return m_connected;
+}
+# endif // CONFIG_BT_NIMBLE_ROLE_CENTRAL
+
+bool NimBLEL2CAPBulkTransfer::send(uint32_t id, const uint8_t* data, uint32_t size) {
+    m_pTxData = data;
+    return sendTransfer(id, size);
+}
+
+bool NimBLEL2CAPBulkTransfer::send(uint32_t id, uint32_t size) {
+    m_pTxData = nullptr;
+    return sendTransfer(id, size);
+}
+
+void NimBLEL2CAPBulkTransfer::setWindow(uint8_t blocks) {
+    m_window = blocks ? blocks : 1;
+}
+
+// private
+bool NimBLEL2CAPBulkTransfer::sendTransfer(uint32_t id, uint32_t size) {
+    if (!m_connected) {
+        NIMBLE_LOGW(LOG_TAG, "L2CAP bulk 0x%04X not connected", m_psm);
+        return false;
+    }
+
+    m_txId         = id;
+    m_txSize       = size;
+    m_txAcked      = 0;
+    m_txResumeSet  = false;
+    m_txPeerWindow = 0;
+    m_txStats      = NimBLEL2CAPBulkStats{};
+    startWaiting();
+
+    ble_npl_time_t start     = ble_npl_time_get();
+    uint32_t       sent      = 0;
+    uint32_t       highest   = 0;
+    uint8_t        timeouts  = 0;
+    bool           started   = false;
+    bool           needBegin = true;
+    bool           success   = false;
+
+    while (m_connected) {
+        if (needBegin) {
+            if (!writeBegin()) {
+                break;
+            }
+            needBegin = false;
+        }
+
+        // A resume request also answers BEGIN with the offset the receiver already has.
+        if (m_txResumeSet.exchange(false)) {
+            sent    = m_txResume;
+            started = true;
+        }
+
+        if (started) {
+            uint32_t acked = m_txAcked;
+            if (acked >= size) {
+                success = true;
+                break;
+            }
+
+            sent = std::max(sent, acked);
+            while (sent < size && sent - acked < static_cast<uint32_t>(m_txPeerWindow) * m_blockSize && !m_txResumeSet) {
+                uint16_t length = std::min<uint32_t>(m_blockSize, size - sent);
+                if (!writeBlock(sent, length)) {
+                    goto Done;
+                }
+
+                if (sent < highest) {
+                    m_txStats.retransmits++;
+                }
+                m_txStats.blocks++;
+                sent    += length;
+                highest  = std::max(highest, sent);
+                acked    = m_txAcked;
+            }
+        }
+
+        if (waitSender(AckTimeoutMs)) {
+            timeouts = 0;
+        } else {
+            // Ask where the receiver is, this recovers a lost acknowledgement or resume request.
+            m_txStats.timeouts++;
+            if (++timeouts >= MaxTimeouts) {
+                NIMBLE_LOGE(LOG_TAG, "L2CAP bulk 0x%04X transfer %" PRIu32 " timed out", m_psm, id);
+                break;
+            }
+            needBegin = true;
+        }
+    }
+
+Done:
+    m_txWaiting         = false;
+    m_txStats.bytes     = std::min<uint32_t>(m_txAcked, size);
+    m_txStats.elapsedMs = ble_npl_time_ticks_to_ms32(ble_npl_time_get() - start);
+    NIMBLE_LOGI(LOG_TAG,
+                "L2CAP bulk 0x%04X sent %" PRIu32 "/%" PRIu32 " bytes, %" PRIu32 " B/s",
+                m_psm,
+                m_txStats.bytes,
+                size,
+                m_txStats.getBytesPerSecond());
+    return success;
+}
+
+bool NimBLEL2CAPBulkTransfer::writeBegin() {
+    m_txFrame.resize(BULK_BEGIN_LEN);
+    m_txFrame[0] = BULK_FRAME_BEGIN;
+    put_le32(&m_txFrame[1], m_txId);
+    put_le32(&m_txFrame[5], m_txSize);
+    return m_pChannel->write(m_txFrame);
+}
+
+bool NimBLEL2CAPBulkTransfer::writeBlock(uint32_t offset, uint16_t length) {
+    m_txFrame.resize(BULK_BLOCK_HDR + length);
+    uint8_t* payload = &m_txFrame[BULK_BLOCK_HDR];
+    if (m_pTxData != nullptr) {
+        memcpy(payload, m_pTxData + offset, length);
+    } else if (m_pCallbacks->onReadData(this, m_txId, offset, payload, length) != length) {
+        NIMBLE_LOGE(LOG_TAG, "L2CAP bulk 0x%04X could not read %u bytes at %" PRIu32, m_psm, length, offset);
+        return false;
+    }
+
+    m_txFrame[0] = BULK_FRAME_BLOCK;
+    put_le32(&m_txFrame[1], m_txId);
+    put_le32(&m_txFrame[5], offset);
+    put_le32(&m_txFrame[9], bulkCrc32(payload, length));
+    return m_pChannel->write(m_txFrame);
+}
+
+// Called from the host task, must not block.
+void NimBLEL2CAPBulkTransfer::sendAck(bool resume) {
+    uint8_t frame[BULK_ACK_LEN];
+    frame[0] = resume ? BULK_FRAME_RESUME : BULK_FRAME_ACK;
+    put_le32(&frame[1], m_rxId);
+    put_le32(&frame[5], m_rxOffset);
+    put_le16(&frame[9], m_window);
+
+    if (m_pChannel->trySend(frame, sizeof(frame)) != 0) {
+        // Retried with the next block, the sender times out and asks if there is none.
+        m_rxAckPending = true;
+        return;
+    }
+
+    m_rxAckPending = false;
+    m_rxUnacked    = 0;
+    if (resume) {
+        m_rxResumeSent = m_rxOffset;
+    }
+}
+
+void NimBLEL2CAPBulkTransfer::handleConnect(NimBLEL2CAPChannel* channel, uint16_t mtu) {
+    m_pChannel     = channel;
+    m_blockSize    = mtu > BULK_BLOCK_HDR ? mtu - BULK_BLOCK_HDR : 0;
+    m_rxAckPending = false;
+    m_connected    = m_blockSize > 0;
+    NIMBLE_LOGI(LOG_TAG, "L2CAP bulk 0x%04X connected, block size %u", m_psm, m_blockSize);
+    m_pCallbacks->onConnect(this, mtu);
+    releaseSender();
+}
+
+void NimBLEL2CAPBulkTransfer::handleDisconnect() {
+    m_connected = false;
+    m_pCallbacks->onDisconnect(this);
+    releaseSender();
+}
+
+void NimBLEL2CAPBulkTransfer::handleFrame(const uint8_t* data, size_t length) {
+    if (length == 0) {
+        return;
+    }
+
+    switch (data[0]) {
+        case BULK_FRAME_BEGIN:
+            handleBegin(data, length);
+            break;
+        case BULK_FRAME_BLOCK:
+            handleBlock(data, length);
+            break;
+        case BULK_FRAME_ACK:
+            handleAck(data, length, false);
+            break;
+        case BULK_FRAME_RESUME:
+            handleAck(data, length, true);
+            break;
+        default:
+            NIMBLE_LOGW(LOG_TAG, "L2CAP bulk 0x%04X unknown frame type %u", m_psm, data[0]);
+            break;
+    }
+}
+
+void NimBLEL2CAPBulkTransfer::handleBegin(const uint8_t* data, size_t length) {
+    if (length < BULK_BEGIN_LEN) {
+        return;
+    }
+
+    uint32_t id   = get_le32(&data[1]);
+    uint32_t size = get_le32(&data[5]);
+    if (!m_rxActive || id != m_rxId || size != m_rxSize) {
+        m_rxId       = id;
+        m_rxSize     = size;
+        m_rxOffset   = 0;
+        m_rxActive   = true;
+        m_rxComplete = false;
+        m_rxStart    = ble_npl_time_get();
+        m_rxStats    = NimBLEL2CAPBulkStats{};
+    }
+
+    if (!m_rxComplete) {
+        m_rxOffset = std::min(m_pCallbacks->onBegin(this, id, size, m_rxOffset), size);
+    }
+
+    m_rxResumeSent = UINT32_MAX;
+    sendAck(true);
+
+    if (!m_rxComplete && m_rxOffset == m_rxSize) {
+        m_rxComplete = true;
+        m_pCallbacks->onComplete(this, m_rxId, m_rxStats);
+    }
+}
+
+void NimBLEL2CAPBulkTransfer::handleBlock(const uint8_t* data, size_t length) {
+    if (length < BULK_BLOCK_HDR || !m_rxActive || m_rxComplete || get_le32(&data[1]) != m_rxId) {
+        return;
+    }
+
+    uint32_t       offset     = get_le32(&data[5]);
+    uint32_t       crc        = get_le32(&data[9]);
+    const uint8_t* payload    = data + BULK_BLOCK_HDR;
+    size_t         payloadLen = length - BULK_BLOCK_HDR;
+
+    // Blocks before the offset are repeats after a resume, blocks after it follow a block that was rejected.
+    if (offset != m_rxOffset) {
+        if (offset > m_rxOffset && m_rxResumeSent != m_rxOffset) {
+            sendAck(true);
+        }
+        return;
+    }
+
+    if (payloadLen > m_rxSize - offset || bulkCrc32(payload, payloadLen) != crc) {
+        m_rxStats.crcErrors++;
+        NIMBLE_LOGW(LOG_TAG, "L2CAP bulk 0x%04X block at %" PRIu32 " rejected", m_psm, offset);
+        if (m_rxResumeSent != m_rxOffset) {
+            sendAck(true);
+        }
+        return;
+    }
+
+    m_pCallbacks->onData(this, m_rxId, offset, payload, payloadLen);
+    m_rxOffset          += payloadLen;
+    m_rxResumeSent       = UINT32_MAX;
+    m_rxStats.bytes     += payloadLen;
+    m_rxStats.blocks++;
+    m_rxStats.elapsedMs  = ble_npl_time_ticks_to_ms32(ble_npl_time_get() - m_rxStart);
+    m_rxUnacked++;
+
+    if (m_rxOffset == m_rxSize) {
+        sendAck(false);
+        m_rxComplete = true;
+        m_pCallbacks->onComplete(this, m_rxId, m_rxStats);
+    } else if (m_rxAckPending || m_rxUnacked >= std::max(1, m_window / 2)) {
+        sendAck(false);
+    }
+}
+
+void NimBLEL2CAPBulkTransfer::handleAck(const uint8_t* data, size_t length, bool resume) {
+    if (length < BULK_ACK_LEN || !m_txWaiting || get_le32(&data[1]) != m_txId) {
+        return;
+    }
+
+    uint32_t offset = get_le32(&data[5]);
+    m_txPeerWindow  = get_le16(&data[9]);
+    m_txAcked       = offset;
+    if (resume) {
+        m_txResume    = offset;
+        m_txResumeSet = true;
+    }
+    releaseSender();
+}
+
+// Drops the releases left over from the previous wait, every frame that arrives releases the sender.
+void NimBLEL2CAPBulkTransfer::startWaiting() {
+    while (ble_npl_sem_pend(&m_txSem, 0) == BLE_NPL_OK) {
+    }
+    m_txWaiting = true;
+}
+
+// The channel blocks its writes with a task notification until it is unstalled, the sender must not
+// wait on the same notification or each could consume the wakeup of the other.
+bool NimBLEL2CAPBulkTransfer::waitSender(uint32_t timeoutMs) {
+    ble_npl_time_t ticks;
+    ble_npl_time_ms_to_ticks(timeoutMs, &ticks);
+    return ble_npl_sem_pend(&m_txSem, ticks) == BLE_NPL_OK;
+}
+
+void NimBLEL2CAPBulkTransfer::releaseSender() {
+    if (m_txWaiting) {
+        ble_npl_sem_release(&m_txSem);
+    }
+}
+
+#endif // CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_L2CAP_COC_MAX_NUM
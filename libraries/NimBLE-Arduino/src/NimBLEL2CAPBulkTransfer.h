@@ -0,0 +1,191 @@
+/*
+ * Copyright 2020-2025 Ryan Powell <ryan@nable-embedded.io> and
+ * esp-nimble-cpp, NimBLE-Arduino contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NIMBLE_CPP_L2CAPBULKTRANSFER_H_
+#define NIMBLE_CPP_L2CAPBULKTRANSFER_H_
+
+#include "nimconfig.h"
+#if CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_L2CAP_COC_MAX_NUM
+
+# include "NimBLEL2CAPChannel.h"
+
+# if defined(CONFIG_NIMBLE_CPP_IDF)
+#  include "nimble/nimble_npl.h"
+# else
+#  include "nimble/nimble/include/nimble/nimble_npl.h"
+# endif
+
+# include <atomic>
+# include <vector>
+
+class NimBLEClient;
+class NimBLEL2CAPBulkTransferCallbacks;
+
+/**
+ * @brief Statistics of one bulk transfer.
+ */
+struct NimBLEL2CAPBulkStats {
+    uint32_t bytes;       // payload bytes delivered or acknowledged
+    uint32_t blocks;      // blocks sent or received
+    uint32_t retransmits; // blocks sent again after a resume request
+    uint32_t crcErrors;   // received blocks that failed the CRC check
+    uint32_t timeouts;    // acknowledgements that did not arrive in time
+    uint32_t elapsedMs;   // time from the start of the transfer to the last block
+
+    /// @return The transfer rate in bytes per second.
+    uint32_t getBytesPerSecond() const { return elapsedMs ? static_cast<uint32_t>(uint64_t(bytes) * 1000 / elapsedMs) : 0; }
+};
+
+/**
+ * @brief Reliable bulk transfers over an L2CAP connection oriented channel.
+ *
+ * Data is split into blocks of one SDU, each with its offset and CRC32. The receiver acknowledges the blocks
+ * it has stored and grants the sender a window of blocks in flight, a CRC error or a gap makes it ask the
+ * sender to resume from the first missing byte. The receive offset is kept when the link drops, so sending
+ * the same transfer id again after reconnecting continues where the previous attempt stopped.
+ *
+ * The same instance can send and receive, on either the server (listen()) or the client (connect()) side.
+ */
+class NimBLEL2CAPBulkTransfer {
+  public:
+    /// @brief Create a bulk transfer endpoint.
+    /// @param[in] psm The PSM of the channel.
+    /// @param[in] callbacks The callbacks, called from the NimBLE host task.
+    /// @param[in] mtu The local SDU size, a block is this minus the block header.
+    /// NOTE: The instance must not be deleted while its channel exists.
+    NimBLEL2CAPBulkTransfer(uint16_t psm, NimBLEL2CAPBulkTransferCallbacks* callbacks, uint16_t mtu = 2048);
+    ~NimBLEL2CAPBulkTransfer();
+
+# if CONFIG_BT_NIMBLE_ROLE_PERIPHERAL
+    /// @brief Register the PSM with the L2CAP server so peers can connect.
+    /// @return True on success.
+    bool listen();
+# endif
+
+# if CONFIG_BT_NIMBLE_ROLE_CENTRAL
+    /// @brief Open the channel to a connected peer, call again after a disconnect to resume.
+    /// @return True if the channel was opened.
+    bool connect(NimBLEClient* client, uint32_t timeoutMs = 5000);
+# endif
+
+    /// @brief Send a buffer, blocks until the peer has acknowledged all of it.
+    /// @param[in] id Identifies the transfer, sending the same id and size again resumes it.
+    /// @return True if the peer received the whole buffer, false on disconnect or timeout.
+    bool send(uint32_t id, const uint8_t* data, uint32_t size);
+
+    /// @brief Send a transfer whose data is read through NimBLEL2CAPBulkTransferCallbacks::onReadData.
+    bool send(uint32_t id, uint32_t size);
+
+    /// @brief Set how many unacknowledged blocks the peer may send to us.
+    void setWindow(uint8_t blocks);
+
+    /// @return True, if the channel is connected.
+    bool isConnected() const { return m_connected; }
+
+    /// @return The statistics of the last transfer sent.
+    const NimBLEL2CAPBulkStats& getTxStats() const { return m_txStats; }
+
+    /// @return The statistics of the current or last transfer received.
+    const NimBLEL2CAPBulkStats& getRxStats() const { return m_rxStats; }
+
+    static constexpr uint8_t  DefaultWindow = 8;
+    static constexpr uint32_t AckTimeoutMs  = 1000;
+    static constexpr uint8_t  MaxTimeouts   = 5;
+
+  private:
+    class ChannelCallbacks;
+    friend class ChannelCallbacks;
+    static constexpr const char* LOG_TAG = "NimBLEL2CAPBulkTransfer";
+
+    bool sendTransfer(uint32_t id, uint32_t size);
+    bool writeBegin();
+    bool writeBlock(uint32_t offset, uint16_t length);
+    void sendAck(bool resume);
+    void handleConnect(NimBLEL2CAPChannel* channel, uint16_t mtu);
+    void handleDisconnect();
+    void handleFrame(const uint8_t* data, size_t length);
+    void handleBegin(const uint8_t* data, size_t length);
+    void handleBlock(const uint8_t* data, size_t length);
+    void handleAck(const uint8_t* data, size_t length, bool resume);
+    void startWaiting();
+    bool waitSender(uint32_t timeoutMs);
+    void releaseSender();
+
+    const uint16_t                    m_psm;
+    const uint16_t                    m_mtu;
+    NimBLEL2CAPBulkTransferCallbacks* m_pCallbacks;
+    NimBLEL2CAPChannel*               m_pChannel{nullptr};
+    std::atomic<bool>                 m_connected{false};
+    uint16_t                          m_blockSize{0}; // payload bytes per block with the negotiated MTU
+    uint8_t                           m_window{DefaultWindow};
+    bool                              m_ownsChannel{false}; // opened by connect(), replaced on the next connect()
+
+    // Sender, driven from the task calling send()
+    const uint8_t*               m_pTxData{nullptr};
+    uint32_t                     m_txId{0};
+    uint32_t                     m_txSize{0};
+    std::atomic<uint32_t>        m_txAcked{0};
+    std::atomic<uint32_t>        m_txResume{0};
+    std::atomic<bool>            m_txResumeSet{false};
+    std::atomic<uint16_t>        m_txPeerWindow{0};
+    std::atomic<bool>            m_txWaiting{false}; // in send() or connect(), the host task may release m_txSem
+    ble_npl_sem                  m_txSem{};          // not a task notification, the channel waits on those while stalled
+    std::vector<uint8_t>         m_txFrame{};
+    NimBLEL2CAPBulkStats         m_txStats{};
+
+    // Receiver, driven from the host task
+    uint32_t             m_rxId{0};
+    uint32_t             m_rxSize{0};
+    uint32_t             m_rxOffset{0};
+    uint32_t             m_rxResumeSent{UINT32_MAX}; // offset of the last resume request, one per gap
+    uint8_t              m_rxUnacked{0};
+    bool                 m_rxActive{false};
+    bool                 m_rxComplete{false};
+    bool                 m_rxAckPending{false};
+    ble_npl_time_t       m_rxStart{0};
+    NimBLEL2CAPBulkStats m_rxStats{};
+};
+
+/**
+ * @brief Callbacks for the bulk transfer.
+ */
+class NimBLEL2CAPBulkTransferCallbacks {
+  public:
+    virtual ~NimBLEL2CAPBulkTransferCallbacks() = default;
+
+    /// Called when the channel is connected, negotiatedMTU includes the block header.
+    virtual void onConnect(NimBLEL2CAPBulkTransfer* transfer, uint16_t negotiatedMTU) {};
+    /// Called when the channel is disconnected, an unfinished transfer can be resumed after reconnecting.
+    virtual void onDisconnect(NimBLEL2CAPBulkTransfer* transfer) {};
+    /// Called when the peer starts or resumes a transfer.
+    /// Return the offset to continue from, e.g. 0 to restart or what was already stored before a reboot.
+    /// Default implementation returns offset, the bytes received so far.
+    virtual uint32_t onBegin(NimBLEL2CAPBulkTransfer* transfer, uint32_t id, uint32_t size, uint32_t offset) {
+        return offset;
+    }
+    /// Called for each block that passed the CRC check, in order.
+    virtual void onData(NimBLEL2CAPBulkTransfer* transfer, uint32_t id, uint32_t offset, const uint8_t* data, size_t length) {};
+    /// Called when all bytes of a received transfer have been stored.
+    virtual void onComplete(NimBLEL2CAPBulkTransfer* transfer, uint32_t id, const NimBLEL2CAPBulkStats& stats) {};
+    /// Called from send(id, size) to read the data of a block, return the number of bytes copied.
+    virtual size_t onReadData(NimBLEL2CAPBulkTransfer* transfer, uint32_t id, uint32_t offset, uint8_t* buf, size_t length) {
+        return 0;
+    }
+};
+
+#endif // CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_L2CAP_COC_MAX_NUM
+#endif // NIMBLE_CPP_L2CAPBULKTRANSFER_H_
@@ -90,9 +90,16 @@ int NimBLEL2CAPChannel::writeFragment(std::vector<uint8_t>::const_iterator begin
         NIMBLE_LOGD(LOG_TAG, "L2CAP Channel waiting for unstall...");
         NimBLETaskData taskData;
         m_pTaskData = &taskData;
-        NimBLEUtils::taskWait(taskData, BLE_NPL_TIME_FOREVER);
+        // The unstall event clears the flag, it may have arrived before the task data was set.
+        if (stalled) {
+            NimBLEUtils::taskWait(taskData, BLE_NPL_TIME_FOREVER);
+        }
         m_pTaskData = nullptr;
         stalled     = false;
+        if (!channel) {
+            // Released by the disconnect, not by the unstall event.
+            return -BLE_HS_ENOTCONN;
+        }
         NIMBLE_LOGD(LOG_TAG, "L2CAP Channel unstalled!");
     }
 
@@ -197,6 +204,37 @@ bool NimBLEL2CAPChannel::write(const std::vector<uint8_t>& bytes) {
     return true;
 }
 
+int NimBLEL2CAPChannel::trySend(const uint8_t* data, size_t length) {
+    if (!this->channel) {
+        return BLE_HS_ENOTCONN;
+    }
+
+    if (stalled) {
+        return BLE_HS_EBUSY;
+    }
+
+    auto txd = os_mbuf_get_pkthdr(&_coc_mbuf_pool, 0);
+    if (!txd) {
+        return BLE_HS_ENOMEM;
+    }
+
+    auto rc = os_mbuf_append(txd, data, length);
+    if (rc == 0) {
+        rc = ble_l2cap_send(channel, txd);
+        if (rc == BLE_HS_ESTALLED) {
+            // Queued, it is sent when the peer returns credits.
+            stalled = true;
+            return 0;
+        }
+    }
+
+    // Only consumed on success.
+    if (rc != 0) {
+        os_mbuf_free_chain(txd);
+    }
+    return rc;
+}
+
 // private
 int NimBLEL2CAPChannel::handleConnectionEvent(struct ble_l2cap_event* event) {
     channel = event->connect.chan;
@@ -260,6 +298,7 @@ int NimBLEL2CAPChannel::handleDataReceivedEvent(struct ble_l2cap_event* event) {
 }
 
 int NimBLEL2CAPChannel::handleTxUnstalledEvent(struct ble_l2cap_event* event) {
+    stalled = false;
     if (m_pTaskData != nullptr) {
         NimBLEUtils::taskRelease(*m_pTaskData, event->tx_unstalled.status);
     }
@@ -271,6 +310,11 @@ int NimBLEL2CAPChannel::handleTxUnstalledEvent(struct ble_l2cap_event* event) {
 int NimBLEL2CAPChannel::handleDisconnectionEvent(struct ble_l2cap_event* event) {
     NIMBLE_LOGI(LOG_TAG, "L2CAP COC 0x%04X disconnected.", psm);
     channel = NULL;
+    // No unstall event follows, a write waiting for it would never return.
+    stalled = false;
+    if (m_pTaskData != nullptr) {
+        NimBLEUtils::taskRelease(*m_pTaskData, BLE_HS_ENOTCONN);
+    }
     callbacks->onDisconnect(this);
     return 0;
 }
@@ -56,6 +56,13 @@ class NimBLEL2CAPChannel {
     /// NOTE: This function will block until the data has been sent or an error occurred.
     bool write(const std::vector<uint8_t>& bytes);
 
+    /// @brief Write up to one MTU of data to the channel without waiting.
+    ///
+    /// Unlike write(), this never blocks and can be called from the callbacks.
+    /// @return 0 when the data was queued for sending.
+    /// @return BLE_HS_EBUSY, if the channel is waiting for credits, or another NimBLE error code.
+    int trySend(const uint8_t* data, size_t length);
+
     /// @return True, if the channel is connected. False, otherwise.
     bool isConnected() const { return !!channel; }
 
@@ -71,6 +78,7 @@ class NimBLEL2CAPChannel {
 
   private:
     friend class NimBLEL2CAPServer;
+    friend class NimBLEL2CAPBulkTransfer;
     static constexpr const char* LOG_TAG = "NimBLEL2CAPChannel";
 
     const uint16_t               psm; // PSM of the channel
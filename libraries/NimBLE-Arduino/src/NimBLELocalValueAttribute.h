@@ -117,12 +117,11 @@ class NimBLELocalValueAttribute : public NimBLELocalAttribute, public NimBLEValu
 
     /**
      * @brief Callback function to support a write request.
-     * @param [in] val The value to write.
-     * @param [in] len The length of the value.
+     * @param [in] om The mbuf chain containing the value to write.
      * @param [in] connInfo A reference to a NimBLEConnInfo instance containing the peer info.
      * @details This function is called by NimBLEServer when a write request is received.
      */
-    virtual void writeEvent(const uint8_t* val, uint16_t len, NimBLEConnInfo& connInfo) = 0;
+    virtual void writeEvent(const os_mbuf* om, NimBLEConnInfo& connInfo) = 0;
 
     /**
      * @brief Get a pointer to value of the attribute.
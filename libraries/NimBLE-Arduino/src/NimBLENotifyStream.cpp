@@ -0,0 +1,250 @@
+/*
+ * Copyright 2020-2025 Ryan Powell <ryan@nable-embedded.io> and
+ * esp-nimble-cpp, NimBLE-Arduino contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NimBLENotifyStream.h"
+#if CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_ROLE_PERIPHERAL
+
+# include "NimBLECharacteristic.h"
+# include "NimBLEUtils.h"
+# include "NimBLELog.h"
+
+# if defined(CONFIG_NIMBLE_CPP_IDF)
+#  include "host/ble_hs.h"
+# else
+#  include "nimble/nimble/host/include/host/ble_hs.h"
+# endif
+
+# include <algorithm>
+# include <cstring>
+
+static const char* LOG_TAG = "NimBLENotifyStream";
+
+/**
+ * @brief Construct a notification stream.
+ * @param [in] pCharacteristic The characteristic to send the notifications from.
+ * @param [in] connHandle The connection handle of the peer to stream to.
+ * @param [in] packetsPerEvent The maximum number of notifications to send in one connection interval.
+ */
+NimBLENotifyStream::NimBLENotifyStream(NimBLECharacteristic* pCharacteristic, uint16_t connHandle, uint8_t packetsPerEvent)
+    : m_pCharacteristic{pCharacteristic},
+      m_connHandle{connHandle},
+      m_packetsPerEvent{packetsPerEvent ? packetsPerEvent : static_cast<uint8_t>(1)},
+      m_credits{m_packetsPerEvent},
+      m_lastRefill{ble_npl_time_get()},
+      m_statsStart{m_lastRefill} {}
+
+/**
+ * @brief Add a sample to the stream.
+ * @param [in] sample A pointer to the sample data.
+ * @param [in] length The length of the sample, must not be larger than the notification payload size.
+ * @return True if the sample was accepted, false if the stream is stalled or the peer is not connected.
+ * @details The sample is buffered and sent once the next sample would not fit in the notification. When a
+ * stalled stream rejects a sample the caller can retry it later or drop it.
+ */
+bool NimBLENotifyStream::write(const uint8_t* sample, size_t length) {
+    if (sample == nullptr || length == 0) {
+        return false;
+    }
+
+    // A failed send keeps the samples buffered only when the stream is stalled, after an error the buffer is empty.
+    if (m_length + length > m_payloadSize && !sendBuffered() && m_length != 0) {
+        m_stats.dropped++;
+        return false;
+    }
+
+    if (m_length == 0 && !refreshLink()) {
+        m_stats.dropped++;
+        return false;
+    }
+
+    if (length > m_payloadSize) {
+        NIMBLE_LOGE(LOG_TAG, "Sample length %u exceeds payload size %u", static_cast<unsigned>(length), m_payloadSize);
+        m_stats.dropped++;
+        return false;
+    }
+
+    memcpy(m_buf.data() + m_length, sample, length);
+    m_length += length;
+    m_stats.samples++;
+
+    // Send as soon as another sample of the same size would not fit, if this fails the samples stay buffered.
+    if (static_cast<size_t>(m_payloadSize - m_length) < length) {
+        sendBuffered();
+    }
+
+    return true;
+} // write
+
+/**
+ * @brief Send the buffered samples without waiting for the notification to fill.
+ * @return True if nothing remains buffered.
+ */
+bool NimBLENotifyStream::flush() {
+    return sendBuffered();
+} // flush
+
+/**
+ * @brief Discard the buffered samples.
+ */
+void NimBLENotifyStream::clear() {
+    m_length = 0;
+} // clear
+
+/**
+ * @brief Get the connection handle of the peer this stream sends to.
+ * @return The connection handle.
+ */
+uint16_t NimBLENotifyStream::getConnHandle() const {
+    return m_connHandle;
+} // getConnHandle
+
+/**
+ * @brief Get the payload size of the notifications, this is updated from the ATT MTU when the buffer is empty.
+ * @return The payload size, 0 before the first sample is written.
+ */
+uint16_t NimBLENotifyStream::getPayloadSize() const {
+    return m_payloadSize;
+} // getPayloadSize
+
+/**
+ * @brief Get the number of bytes waiting to be sent.
+ * @return The buffered length.
+ */
+size_t NimBLENotifyStream::getBufferedLength() const {
+    return m_length;
+} // getBufferedLength
+
+/**
+ * @brief Set the maximum number of notifications to send in one connection interval.
+ * @param [in] packetsPerEvent The number of notifications, minimum 1.
+ */
+void NimBLENotifyStream::setPacketsPerEvent(uint8_t packetsPerEvent) {
+    m_packetsPerEvent = packetsPerEvent ? packetsPerEvent : 1;
+    if (m_credits > m_packetsPerEvent) {
+        m_credits = m_packetsPerEvent;
+    }
+} // setPacketsPerEvent
+
+/**
+ * @brief Get the throughput counters.
+ * @return A reference to the counters, bytes * 1000 / elapsedMs gives the throughput in bytes per second.
+ */
+const NimBLENotifyStreamStats& NimBLENotifyStream::getStats() {
+    m_stats.elapsedMs = ble_npl_time_ticks_to_ms32(ble_npl_time_get() - m_statsStart);
+    return m_stats;
+} // getStats
+
+/**
+ * @brief Reset the throughput counters and restart the elapsed time.
+ */
+void NimBLENotifyStream::resetStats() {
+    m_stats      = NimBLENotifyStreamStats{};
+    m_statsStart = ble_npl_time_get();
+} // resetStats
+
+/**
+ * @brief Read the connection interval and the payload size of the connection.
+ * @return False if the peer is not connected.
+ */
+bool NimBLENotifyStream::refreshLink() {
+    ble_gap_conn_desc desc;
+    if (ble_gap_conn_find(m_connHandle, &desc) != 0) {
+        return false;
+    }
+
+    uint16_t mtu = ble_att_mtu(m_connHandle);
+    if (mtu < BLE_ATT_MTU_DFLT) {
+        return false;
+    }
+
+    m_connItvl    = desc.conn_itvl;
+    m_payloadSize = std::min<uint16_t>(mtu - 3, BLE_ATT_ATTR_MAX_LEN);
+    if (m_buf.size() < m_payloadSize) {
+        m_buf.resize(m_payloadSize);
+    }
+
+    return true;
+} // refreshLink
+
+/**
+ * @brief Restore the credits once a connection interval has passed since they were last refilled.
+ */
+void NimBLENotifyStream::refillCredits() {
+    ble_npl_time_t now = ble_npl_time_get();
+    if (m_credits >= m_packetsPerEvent) {
+        m_lastRefill = now;
+        return;
+    }
+
+    uint32_t itvl      = m_connItvl ? m_connItvl : BLE_HCI_CONN_ITVL_MIN;
+    uint32_t elapsed   = ble_npl_time_ticks_to_ms32(now - m_lastRefill) * 4 / 5; // 1.25ms units
+    uint32_t intervals = elapsed / itvl;
+    if (intervals == 0) {
+        return;
+    }
+
+    // Credits don't accumulate past one connection event, an idle stream must not send a burst the link can't carry.
+    m_credits     = m_packetsPerEvent;
+    m_lastRefill += ble_npl_time_ms_to_ticks32(intervals * itvl * 5 / 4);
+} // refillCredits
+
+/**
+ * @brief Send the buffered samples in one notification.
+ * @return True if nothing remains buffered.
+ * @details NimBLE reports the BLE_GAP_EVENT_NOTIFY_TX status of a notification from within
+ * ble_gattc_notify_custom, so its return code is used as the transmit status.
+ */
+bool NimBLENotifyStream::sendBuffered() {
+    if (m_length == 0) {
+        return true;
+    }
+
+    refillCredits();
+    if (m_credits == 0) {
+        m_stats.stalls++;
+        return false;
+    }
+
+    int      rc = BLE_HS_ENOMEM;
+    os_mbuf* om = ble_hs_mbuf_from_flat(m_buf.data(), m_length);
+    if (om != nullptr) {
+        rc = ble_gattc_notify_custom(m_connHandle, m_pCharacteristic->getHandle(), om);
+    }
+
+    if (rc == 0) {
+        m_credits--;
+        m_stats.notifications++;
+        m_stats.bytes += m_length;
+        m_length       = 0;
+        return true;
+    }
+
+    if (rc == BLE_HS_ENOMEM) {
+        // Out of host buffers, hold the samples and wait for the controller to drain a connection event.
+        m_credits    = 0;
+        m_lastRefill = ble_npl_time_get();
+        m_stats.stalls++;
+        return false;
+    }
+
+    NIMBLE_LOGE(LOG_TAG, "Notification failed, rc=%d %s", rc, NimBLEUtils::returnCodeToString(rc));
+    m_stats.errors++;
+    m_length = 0;
+    return false;
+} // sendBuffered
+
+#endif // CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_ROLE_PERIPHERAL
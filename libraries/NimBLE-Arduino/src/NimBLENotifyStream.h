@@ -0,0 +1,125 @@
+/*
+ * Copyright 2020-2025 Ryan Powell <ryan@nable-embedded.io> and
+ * esp-nimble-cpp, NimBLE-Arduino contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NIMBLE_CPP_NOTIFY_STREAM_H_
+#define NIMBLE_CPP_NOTIFY_STREAM_H_
+
+#include "nimconfig.h"
+#if CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_ROLE_PERIPHERAL
+
+# if defined(CONFIG_NIMBLE_CPP_IDF)
+#  include "nimble/nimble_npl.h"
+# else
+#  include "nimble/nimble/include/nimble/nimble_npl.h"
+# endif
+
+# include "NimBLEAttValue.h"
+
+# include <cstddef>
+# include <cstdint>
+# include <type_traits>
+# include <vector>
+
+class NimBLECharacteristic;
+
+/**
+ * @brief Throughput counters of a notification stream.
+ */
+struct NimBLENotifyStreamStats {
+    uint32_t samples;       // samples accepted by write()
+    uint32_t dropped;       // samples rejected because the stream was stalled or the link was down
+    uint32_t notifications; // notifications sent
+    uint32_t bytes;         // payload bytes sent
+    uint32_t stalls;        // sends deferred for lack of credits or host buffers
+    uint32_t errors;        // sends that failed for any other reason, the buffered samples are discarded
+    uint32_t elapsedMs;     // time since the counters were reset
+};
+
+/**
+ * @brief Streams samples from a characteristic to one connected peer.
+ *
+ * Samples are packed into notifications as large as the negotiated MTU allows, a sample is never split
+ * across two notifications. The number of notifications sent in each connection interval is limited to the
+ * configured packets per event, when the host runs out of buffers the stream stops until the next interval
+ * and keeps the pending samples instead of failing every call.
+ */
+class NimBLENotifyStream {
+  public:
+    NimBLENotifyStream(NimBLECharacteristic* pCharacteristic,
+                       uint16_t              connHandle,
+                       uint8_t               packetsPerEvent = CONFIG_NIMBLE_CPP_NOTIFY_STREAM_PACKETS_PER_EVENT);
+
+    bool                           write(const uint8_t* sample, size_t length);
+    bool                           flush();
+    void                           clear();
+    uint16_t                       getConnHandle() const;
+    uint16_t                       getPayloadSize() const;
+    size_t                         getBufferedLength() const;
+    void                           setPacketsPerEvent(uint8_t packetsPerEvent);
+    const NimBLENotifyStreamStats& getStats();
+    void                           resetStats();
+
+    /**
+     * @brief Template to write any sample type that has a data() and size() method.
+     * @param [in] s The sample to write.
+     * @return True if the sample was accepted.
+     */
+    template <typename T>
+# ifdef _DOXYGEN_
+    bool
+# else
+    typename std::enable_if<Has_data_size<T>::value, bool>::type
+# endif
+    write(const T& s) {
+        return write(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+    }
+
+    /**
+     * @brief Template to write a sample of a trivially copyable type.
+     * @param [in] s The sample to write.
+     * @return True if the sample was accepted.
+     */
+    template <typename T>
+# ifdef _DOXYGEN_
+    bool
+# else
+    typename std::enable_if<!Has_data_size<T>::value && std::is_trivially_copyable<T>::value, bool>::type
+# endif
+    write(const T& s) {
+        return write(reinterpret_cast<const uint8_t*>(&s), sizeof(T));
+    }
+
+  private:
+    bool refreshLink();
+    void refillCredits();
+    bool sendBuffered();
+
+    NimBLECharacteristic*   m_pCharacteristic;
+    uint16_t                m_connHandle;
+    uint16_t                m_connItvl{0};    // connection interval in 1.25ms units
+    uint16_t                m_payloadSize{0}; // ATT MTU - 3
+    uint16_t                m_length{0};      // bytes buffered
+    uint8_t                 m_packetsPerEvent;
+    uint8_t                 m_credits;
+    ble_npl_time_t          m_lastRefill;
+    ble_npl_time_t          m_statsStart;
+    std::vector<uint8_t>    m_buf{};
+    NimBLENotifyStreamStats m_stats{};
+};
+
+#endif // CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_ROLE_PERIPHERAL
+#endif // NIMBLE_CPP_NOTIFY_STREAM_H_
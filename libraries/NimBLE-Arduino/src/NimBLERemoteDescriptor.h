@@ -36,6 +36,7 @@ class NimBLERemoteDescriptor : public NimBLERemoteValueAttribute {
     NimBLEClient*               getClient() const override;
 
   private:
+    friend class NimBLEClient;
     friend class NimBLERemoteCharacteristic;
 
     NimBLERemoteDescriptor(const NimBLERemoteCharacteristic* pRemoteCharacteristic, const ble_gatt_dsc* dsc);
@@ -23,10 +23,37 @@
 
 # include <string>
 # include <climits>
+# include <algorithm>
 
 static const char*         LOG_TAG = "NimBLEScan";
 static NimBLEScanCallbacks defaultScanCallbacks;
 
+/**
+ * @brief Get the advertising set ID of a device, 0 if extended advertising is not enabled.
+ */
+static inline uint8_t deviceSid(const NimBLEAdvertisedDevice* dev) {
+# if CONFIG_BT_NIMBLE_EXT_ADV
+    return dev->getSetId();
+# else
+    (void)dev;
+    return 0;
+# endif
+}
+
+/**
+ * @brief Hash an address and advertising set ID for the device index (FNV-1a).
+ */
+static inline size_t indexHash(const NimBLEAddress& address, uint8_t sid) {
+    const uint8_t* val  = address.getVal();
+    uint32_t       hash = 2166136261UL;
+    for (int i = 0; i < BLE_DEV_ADDR_LEN; i++) {
+        hash = (hash ^ val[i]) * 16777619UL;
+    }
+    hash = (hash ^ address.getType()) * 16777619UL;
+    hash = (hash ^ sid) * 16777619UL;
+    return hash;
+}
+
 /**
  * @brief Scan constructor.
  */
@@ -35,7 +62,12 @@ NimBLEScan::NimBLEScan()
       // default interval + window, no whitelist scan filter,not limited scan, no scan response, filter_duplicates
       m_scanParams{0, 0, BLE_HCI_SCAN_FILT_NO_WL, 0, 1, 1},
       m_pTaskData{nullptr},
-      m_maxResults{0xFF} {}
+      m_maxResults{0xFF},
+      m_evictOldest{false},
+      m_lruHead{nullptr},
+      m_lruTail{nullptr} {
+    m_devicePool.reserve(CONFIG_NIMBLE_CPP_SCAN_DEVICE_POOL_SIZE);
+}
 
 /**
  * @brief Scan destructor, release any allocated resources.
@@ -44,6 +76,14 @@ NimBLEScan::~NimBLEScan() {
     for (const auto& dev : m_scanResults.m_deviceVec) {
         delete dev;
     }
+
+    for (const auto& dev : m_devicePool) {
+        delete dev;
+    }
+
+    for (const auto& dev : m_heldDevices) {
+        delete dev;
+    }
 }
 
 /**
@@ -64,13 +104,15 @@ int NimBLEScan::handleGapEvent(ble_gap_event* event, void* arg) {
             }
 
 # if CONFIG_BT_NIMBLE_EXT_ADV
-            const auto& disc        = event->ext_disc;
-            const bool  isLegacyAdv = disc.props & BLE_HCI_ADV_LEGACY_MASK;
-            const auto  event_type  = isLegacyAdv ? disc.legacy_event_type : disc.props;
+            const auto&   disc        = event->ext_disc;
+            const bool    isLegacyAdv = disc.props & BLE_HCI_ADV_LEGACY_MASK;
+            const auto    event_type  = isLegacyAdv ? disc.legacy_event_type : disc.props;
+            const uint8_t sid         = disc.sid; // Same address but different set ID is a different advertised device.
 # else
-            const auto& disc        = event->disc;
-            const bool  isLegacyAdv = true;
-            const auto  event_type  = disc.event_type;
+            const auto&   disc        = event->disc;
+            const bool    isLegacyAdv = true;
+            const auto    event_type  = disc.event_type;
+            const uint8_t sid         = 0;
 # endif
             NimBLEAddress advertisedAddress(disc.addr);
 
@@ -82,38 +124,67 @@ int NimBLEScan::handleGapEvent(ble_gap_event* event, void* arg) {
                 return 0;
             }
 # endif
-            NimBLEAdvertisedDevice* advertisedDevice = nullptr;
+            // If we've seen this device before get a pointer to it from the index
+            NimBLEAdvertisedDevice* advertisedDevice = pScan->findDevice(advertisedAddress, sid);
 
-            // If we've seen this device before get a pointer to it from the vector
-            for (const auto& dev : pScan->m_scanResults.m_deviceVec) {
+            // If we haven't seen this device before; create a new instance and insert it in the vector.
+            // Otherwise just update the relevant parameters of the already known device.
+            if (advertisedDevice == nullptr) {
+                // A scannable device may only match the filters with its scan response and an extended advertisement
+                // with a later fragment, their data is held until then and the filters check the combined data.
+                NimBLEAdvertisedDevice* heldDevice = pScan->takeHeldDevice(advertisedAddress, sid);
+                bool                    matched;
+                if (heldDevice != nullptr) {
+                    heldDevice->update(event, event_type);
+                    matched = pScan->matchesFilters(heldDevice->getPayload().data(), heldDevice->getPayload().size());
+                } else {
+                    matched = pScan->matchesFilters(disc.data, disc.length_data);
+                }
+
+                // Reject devices that don't match the filters before anything is stored for them.
+                if (!matched) {
 # if CONFIG_BT_NIMBLE_EXT_ADV
-                // Same address but different set ID should create a new advertised device.
-                if (dev->getAddress() == advertisedAddress && dev->getSetId() == disc.sid)
+                    bool moreData = disc.data_status == BLE_GAP_EXT_ADV_DATA_STATUS_INCOMPLETE;
 # else
-                if (dev->getAddress() == advertisedAddress)
+                    bool moreData = false;
 # endif
-                {
-                    advertisedDevice = dev;
-                    break;
+                    moreData |= !pScan->m_scanParams.passive && isLegacyAdv &&
+                                (event_type == BLE_HCI_ADV_RPT_EVTYPE_ADV_IND || event_type == BLE_HCI_ADV_RPT_EVTYPE_SCAN_IND);
+                    if (moreData) {
+                        pScan->holdDevice(heldDevice != nullptr ? heldDevice : pScan->allocDevice(event, event_type));
+                    } else if (heldDevice != nullptr) {
+                        pScan->releaseDevice(heldDevice);
+                    }
+                    return 0;
                 }
-            }
 
-            // If we haven't seen this device before; create a new instance and insert it in the vector.
-            // Otherwise just update the relevant parameters of the already known device.
-            if (advertisedDevice == nullptr) {
-                // Check if we have reach the scan results limit, ignore this one if so.
+                // Check if we have reach the scan results limit, ignore this one or evict the oldest if so.
                 // We still need to store each device when maxResults is 0 to be able to append the scan results
                 if (pScan->m_maxResults > 0 && pScan->m_maxResults < 0xFF &&
                     (pScan->m_scanResults.m_deviceVec.size() >= pScan->m_maxResults)) {
-                    return 0;
+                    if (!pScan->m_evictOldest || pScan->m_lruHead == nullptr) {
+                        if (heldDevice != nullptr) {
+                            pScan->releaseDevice(heldDevice);
+                        }
+                        return 0;
+                    }
+
+                    NIMBLE_LOGD(LOG_TAG, "Scan results full, evicting: %s", pScan->m_lruHead->getAddress().toString().c_str());
+                    pScan->erase(pScan->m_lruHead);
                 }
 
-                if (isLegacyAdv && event_type == BLE_HCI_ADV_RPT_EVTYPE_SCAN_RSP) {
-                    NIMBLE_LOGI(LOG_TAG, "Scan response without advertisement: %s", advertisedAddress.toString().c_str());
+                if (heldDevice != nullptr) {
+                    advertisedDevice = heldDevice;
+                } else {
+                    if (isLegacyAdv && event_type == BLE_HCI_ADV_RPT_EVTYPE_SCAN_RSP) {
+                        NIMBLE_LOGI(LOG_TAG, "Scan response without advertisement: %s", advertisedAddress.toString().c_str());
+                    }
+
+                    advertisedDevice = pScan->allocDevice(event, event_type);
                 }
 
-                advertisedDevice = new NimBLEAdvertisedDevice(event, event_type);
                 pScan->m_scanResults.m_deviceVec.push_back(advertisedDevice);
+                pScan->indexInsert(advertisedDevice);
                 NIMBLE_LOGI(LOG_TAG, "New advertiser: %s", advertisedAddress.toString().c_str());
             } else {
                 advertisedDevice->update(event, event_type);
@@ -126,6 +197,8 @@ int NimBLEScan::handleGapEvent(ble_gap_event* event, void* arg) {
                 }
             }
 
+            pScan->lruTouch(advertisedDevice);
+
 # if CONFIG_BT_NIMBLE_EXT_ADV
             if (advertisedDevice->getDataStatus() == BLE_GAP_EXT_ADV_DATA_STATUS_INCOMPLETE) {
                 NIMBLE_LOGD(LOG_TAG, "EXT ADV data incomplete, waiting for more");
@@ -236,11 +309,114 @@ void NimBLEScan::setFilterPolicy(uint8_t filter) {
  * @brief Sets the max number of results to store.
  * @param [in] maxResults The number of results to limit storage to\n
  * 0 == none (callbacks only) 0xFF == unlimited, any other value is the limit.
+ * @param [in] evictOldest If true, when the limit is reached the least recently seen device is erased
+ * to make room for a new one, otherwise new devices are ignored, default: false.
+ * @note With evictOldest set, pointers to devices previously obtained from the results may be invalidated
+ * while scanning.
  */
-void NimBLEScan::setMaxResults(uint8_t maxResults) {
-    m_maxResults = maxResults;
+void NimBLEScan::setMaxResults(uint8_t maxResults, bool evictOldest) {
+    m_maxResults  = maxResults;
+    m_evictOldest = evictOldest;
 } // setMaxResults
 
+/**
+ * @brief Only store and report devices that advertise this service UUID.
+ * @param [in] uuid The service UUID to look for.
+ * @details When any filters are set, a device that is not already in the results is ignored unless its advertisement
+ * has one of the service UUIDs or manufacturer IDs set. This is checked on the raw data before a
+ * NimBLEAdvertisedDevice is created. When the advertisement does not match, the data of a scannable device (active
+ * scan) is held until its scan response and that of an extended advertisement until its last fragment, the filters
+ * then check the combined data. Up to CONFIG_NIMBLE_CPP_SCAN_HELD_DEVICES devices are held at a time.
+ * @note Filters should be set before starting a scan.
+ */
+void NimBLEScan::addServiceUUIDFilter(const NimBLEUUID& uuid) {
+    m_uuidFilters.push_back(uuid);
+} // addServiceUUIDFilter
+
+/**
+ * @brief Only store and report devices that advertise manufacturer data with this company ID.
+ * @param [in] companyId The company identifier, the first 2 bytes of the manufacturer data.
+ * @details See addServiceUUIDFilter.
+ */
+void NimBLEScan::addManufacturerIdFilter(uint16_t companyId) {
+    m_mfgFilters.push_back(companyId);
+} // addManufacturerIdFilter
+
+/**
+ * @brief Remove all service UUID and manufacturer ID filters, all devices will be reported.
+ */
+void NimBLEScan::clearFilters() {
+    m_uuidFilters.clear();
+    m_mfgFilters.clear();
+} // clearFilters
+
+/**
+ * @brief Check raw advertisement data against the filters.
+ * @param [in] data The advertisement data.
+ * @param [in] length The length of the advertisement data.
+ * @return True if there are no filters or the data has a service UUID or manufacturer ID that was set.
+ */
+bool NimBLEScan::matchesFilters(const uint8_t* data, uint16_t length) const {
+    if (m_uuidFilters.empty() && m_mfgFilters.empty()) {
+        return true;
+    }
+
+    while (length > 2) {
+        const ble_hs_adv_field* field = reinterpret_cast<const ble_hs_adv_field*>(data);
+        if (field->length >= length) {
+            break;
+        }
+
+        uint8_t uuidBytes = 0;
+        switch (field->type) {
+            case BLE_HS_ADV_TYPE_INCOMP_UUIDS16:
+            case BLE_HS_ADV_TYPE_COMP_UUIDS16:
+                uuidBytes = 2;
+                break;
+
+            case BLE_HS_ADV_TYPE_INCOMP_UUIDS32:
+            case BLE_HS_ADV_TYPE_COMP_UUIDS32:
+                uuidBytes = 4;
+                break;
+
+            case BLE_HS_ADV_TYPE_INCOMP_UUIDS128:
+            case BLE_HS_ADV_TYPE_COMP_UUIDS128:
+                uuidBytes = 16;
+                break;
+
+            case BLE_HS_ADV_TYPE_MFG_DATA:
+                if (field->length >= 3) {
+                    const uint16_t companyId = field->value[0] | (field->value[1] << 8);
+                    for (const auto& id : m_mfgFilters) {
+                        if (id == companyId) {
+                            return true;
+                        }
+                    }
+                }
+                break;
+
+            default:
+                break;
+        }
+
+        if (uuidBytes > 0 && !m_uuidFilters.empty()) {
+            for (uint8_t i = 0; i + uuidBytes < field->length; i += uuidBytes) {
+                const NimBLEUUID uuid(field->value + i, uuidBytes);
+                for (const auto& filter : m_uuidFilters) {
+                    if (filter == uuid) {
+                        return true;
+                    }
+                }
+            }
+        }
+
+        length -= 1 + field->length;
+        data   += 1 + field->length;
+    }
+
+    return false;
+} // matchesFilters
+
 /**
  * @brief Set the call backs to be invoked.
  * @param [in] pScanCallbacks Call backs to be invoked.
@@ -414,8 +590,7 @@ void NimBLEScan::erase(const NimBLEAddress& address) {
     NIMBLE_LOGD(LOG_TAG, "erase device: %s", address.toString().c_str());
     for (auto it = m_scanResults.m_deviceVec.begin(); it != m_scanResults.m_deviceVec.end(); ++it) {
         if ((*it)->getAddress() == address) {
-            delete *it;
-            m_scanResults.m_deviceVec.erase(it);
+            removeDevice(it);
             break;
         }
     }
@@ -427,15 +602,225 @@ void NimBLEScan::erase(const NimBLEAddress& address) {
  */
 void NimBLEScan::erase(const NimBLEAdvertisedDevice* device) {
     NIMBLE_LOGD(LOG_TAG, "erase device: %s", device->getAddress().toString().c_str());
-    for (auto it = m_scanResults.m_deviceVec.begin(); it != m_scanResults.m_deviceVec.end(); ++it) {
-        if ((*it) == device) {
-            delete *it;
-            m_scanResults.m_deviceVec.erase(it);
-            break;
-        }
+    auto it = std::find(m_scanResults.m_deviceVec.begin(), m_scanResults.m_deviceVec.end(), device);
+    if (it != m_scanResults.m_deviceVec.end()) {
+        removeDevice(it);
     }
 }
 
+/**
+ * @brief Remove a device from the results, the index and the least recently seen list and release it.
+ * @param [in] it The position of the device in the results vector.
+ */
+void NimBLEScan::removeDevice(std::vector<NimBLEAdvertisedDevice*>::iterator it) {
+    NimBLEAdvertisedDevice* dev = *it;
+    m_scanResults.m_deviceVec.erase(it);
+    indexRemove(dev);
+    lruRemove(dev);
+    releaseDevice(dev);
+} // removeDevice
+
+/**
+ * @brief Find a stored device by address and advertising set ID.
+ * @param [in] address The address of the device.
+ * @param [in] sid The advertising set ID of the device, 0 if extended advertising is not used.
+ * @return A pointer to the device or nullptr if not found.
+ */
+NimBLEAdvertisedDevice* NimBLEScan::findDevice(const NimBLEAddress& address, uint8_t sid) const {
+    if (m_index.empty()) {
+        return nullptr;
+    }
+
+    // The index is never more than half full so there is always an empty slot to end the probe.
+    const size_t mask = m_index.size() - 1;
+    for (size_t i = indexHash(address, sid) & mask;; i = (i + 1) & mask) {
+        NimBLEAdvertisedDevice* dev = m_index[i];
+        if (dev == nullptr) {
+            return nullptr;
+        }
+
+        if (deviceSid(dev) == sid && dev->getAddress() == address) {
+            return dev;
+        }
+    }
+} // findDevice
+
+/**
+ * @brief Add a device that has been pushed to the results vector to the index.
+ * @param [in] device The device to add.
+ */
+void NimBLEScan::indexInsert(NimBLEAdvertisedDevice* device) {
+    if (m_scanResults.m_deviceVec.size() * 2 > m_index.size()) {
+        indexRebuild(); // includes the new device
+        return;
+    }
+
+    const size_t mask = m_index.size() - 1;
+    size_t       i    = indexHash(device->getAddress(), deviceSid(device)) & mask;
+    while (m_index[i] != nullptr) {
+        i = (i + 1) & mask;
+    }
+    m_index[i] = device;
+} // indexInsert
+
+/**
+ * @brief Remove a device from the index.
+ * @param [in] device The device to remove.
+ * @details The entries following it in the probe sequence are shifted back so no tombstones are needed.
+ */
+void NimBLEScan::indexRemove(const NimBLEAdvertisedDevice* device) {
+    if (m_index.empty()) {
+        return;
+    }
+
+    const size_t mask = m_index.size() - 1;
+    size_t       i    = indexHash(device->getAddress(), deviceSid(device)) & mask;
+    while (m_index[i] != device) {
+        if (m_index[i] == nullptr) {
+            return; // not indexed
+        }
+        i = (i + 1) & mask;
+    }
+
+    for (size_t j = (i + 1) & mask; m_index[j] != nullptr; j = (j + 1) & mask) {
+        const size_t home = indexHash(m_index[j]->getAddress(), deviceSid(m_index[j])) & mask;
+        // Move the entry into the hole unless its home slot is cyclically between the hole and its position.
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            m_index[i] = m_index[j];
+            i          = j;
+        }
+    }
+
+    m_index[i] = nullptr;
+} // indexRemove
+
+/**
+ * @brief Resize the index to at least twice the number of results and re-insert all of them.
+ */
+void NimBLEScan::indexRebuild() {
+    size_t size = 16;
+    while (size < m_scanResults.m_deviceVec.size() * 2) {
+        size <<= 1;
+    }
+
+    m_index.assign(size, nullptr);
+    const size_t mask = size - 1;
+    for (const auto& dev : m_scanResults.m_deviceVec) {
+        size_t i = indexHash(dev->getAddress(), deviceSid(dev)) & mask;
+        while (m_index[i] != nullptr) {
+            i = (i + 1) & mask;
+        }
+        m_index[i] = dev;
+    }
+} // indexRebuild
+
+/**
+ * @brief Move a device to the most recently seen end of the list.
+ * @param [in] device The device that was just seen.
+ */
+void NimBLEScan::lruTouch(NimBLEAdvertisedDevice* device) {
+    if (m_lruTail == device) {
+        return;
+    }
+
+    lruRemove(device);
+    device->m_lruPrev = m_lruTail;
+    if (m_lruTail != nullptr) {
+        m_lruTail->m_lruNext = device;
+    } else {
+        m_lruHead = device;
+    }
+    m_lruTail = device;
+} // lruTouch
+
+/**
+ * @brief Unlink a device from the least recently seen list.
+ * @param [in] device The device to unlink.
+ */
+void NimBLEScan::lruRemove(NimBLEAdvertisedDevice* device) {
+    if (device->m_lruPrev != nullptr) {
+        device->m_lruPrev->m_lruNext = device->m_lruNext;
+    } else if (m_lruHead == device) {
+        m_lruHead = device->m_lruNext;
+    }
+
+    if (device->m_lruNext != nullptr) {
+        device->m_lruNext->m_lruPrev = device->m_lruPrev;
+    } else if (m_lruTail == device) {
+        m_lruTail = device->m_lruPrev;
+    }
+
+    device->m_lruPrev = nullptr;
+    device->m_lruNext = nullptr;
+} // lruRemove
+
+/**
+ * @brief Get a device for a new advertiser, from the pool if available.
+ * @param [in] event The advertisement event data.
+ * @param [in] eventType The advertisement event type.
+ * @return A pointer to the initialized device.
+ */
+NimBLEAdvertisedDevice* NimBLEScan::allocDevice(const ble_gap_event* event, uint8_t eventType) {
+    if (m_devicePool.empty()) {
+        return new NimBLEAdvertisedDevice(event, eventType);
+    }
+
+    NimBLEAdvertisedDevice* dev = m_devicePool.back();
+    m_devicePool.pop_back();
+    dev->reset(event, eventType);
+    return dev;
+} // allocDevice
+
+/**
+ * @brief Return a device that has been removed from the results to the pool, or delete it if the pool is full.
+ * @param [in] device The device to release.
+ */
+void NimBLEScan::releaseDevice(NimBLEAdvertisedDevice* device) {
+    if (m_devicePool.size() < CONFIG_NIMBLE_CPP_SCAN_DEVICE_POOL_SIZE) {
+        m_devicePool.push_back(device);
+        return;
+    }
+
+    delete device;
+} // releaseDevice
+
+/**
+ * @brief Hold a device that does not match the filters until the rest of its data is received.
+ * @param [in] device The device to hold, not in the results.
+ * @details When the list is full the device held the longest is released.
+ */
+void NimBLEScan::holdDevice(NimBLEAdvertisedDevice* device) {
+    if (m_heldDevices.size() >= CONFIG_NIMBLE_CPP_SCAN_HELD_DEVICES) {
+        if (m_heldDevices.empty()) {
+            releaseDevice(device);
+            return;
+        }
+
+        releaseDevice(m_heldDevices.front());
+        m_heldDevices.erase(m_heldDevices.begin());
+    }
+
+    m_heldDevices.push_back(device);
+} // holdDevice
+
+/**
+ * @brief Remove a device from the held devices.
+ * @param [in] address The address of the device.
+ * @param [in] sid The advertising set ID of the device, 0 if extended advertising is not used.
+ * @return A pointer to the device or nullptr if it is not held.
+ */
+NimBLEAdvertisedDevice* NimBLEScan::takeHeldDevice(const NimBLEAddress& address, uint8_t sid) {
+    for (auto it = m_heldDevices.begin(); it != m_heldDevices.end(); ++it) {
+        if (deviceSid(*it) == sid && (*it)->getAddress() == address) {
+            NimBLEAdvertisedDevice* dev = *it;
+            m_heldDevices.erase(it);
+            return dev;
+        }
+    }
+
+    return nullptr;
+} // takeHeldDevice
+
 /**
  * @brief If the host reset and re-synced this is called.
  * If the application was scanning indefinitely with a callback, restart it.
@@ -483,14 +868,32 @@ NimBLEScanResults NimBLEScan::getResults() {
  * @brief Clear the stored results of the scan.
  */
 void NimBLEScan::clearResults() {
-    if (m_scanResults.m_deviceVec.size()) {
+    if (m_scanResults.m_deviceVec.size() || m_heldDevices.size()) {
         std::vector<NimBLEAdvertisedDevice*> vSwap{};
+        std::vector<NimBLEAdvertisedDevice*> iSwap{};
+        std::vector<NimBLEAdvertisedDevice*> hSwap{};
         ble_npl_hw_enter_critical();
         vSwap.swap(m_scanResults.m_deviceVec);
+        iSwap.swap(m_index);
+        hSwap.swap(m_heldDevices);
+        m_lruHead = nullptr;
+        m_lruTail = nullptr;
+        // Refill the pool while the scan can't take from it, the capacity is reserved so this does not allocate.
+        while (!vSwap.empty() && m_devicePool.size() < CONFIG_NIMBLE_CPP_SCAN_DEVICE_POOL_SIZE) {
+            m_devicePool.push_back(vSwap.back());
+            vSwap.pop_back();
+        }
+        while (!hSwap.empty() && m_devicePool.size() < CONFIG_NIMBLE_CPP_SCAN_DEVICE_POOL_SIZE) {
+            m_devicePool.push_back(hSwap.back());
+            hSwap.pop_back();
+        }
         ble_npl_hw_exit_critical(0);
         for (const auto& dev : vSwap) {
             delete dev;
         }
+        for (const auto& dev : hSwap) {
+            delete dev;
+        }
     }
 } // clearResults
 
@@ -22,6 +22,7 @@
 #if CONFIG_BT_ENABLED && CONFIG_BT_NIMBLE_ROLE_OBSERVER
 
 # include "NimBLEAdvertisedDevice.h"
+# include "NimBLEUUID.h"
 # include "NimBLEUtils.h"
 
 # if defined(CONFIG_NIMBLE_CPP_IDF)
@@ -79,9 +80,12 @@ class NimBLEScan {
     void              clearResults();
     NimBLEScanResults getResults();
     NimBLEScanResults getResults(uint32_t duration, bool is_continue = false);
-    void              setMaxResults(uint8_t maxResults);
+    void              setMaxResults(uint8_t maxResults, bool evictOldest = false);
     void              erase(const NimBLEAddress& address);
     void              erase(const NimBLEAdvertisedDevice* device);
+    void              addServiceUUIDFilter(const NimBLEUUID& uuid);
+    void              addManufacturerIdFilter(uint16_t companyId);
+    void              clearFilters();
 
 # if CONFIG_BT_NIMBLE_EXT_ADV
     enum Phy { SCAN_1M = 0x01, SCAN_CODED = 0x02, SCAN_ALL = 0x03 };
@@ -97,11 +101,36 @@ class NimBLEScan {
     static int handleGapEvent(ble_gap_event* event, void* arg);
     void       onHostSync();
 
+    bool                    matchesFilters(const uint8_t* data, uint16_t length) const;
+    NimBLEAdvertisedDevice* findDevice(const NimBLEAddress& address, uint8_t sid) const;
+    NimBLEAdvertisedDevice* allocDevice(const ble_gap_event* event, uint8_t eventType);
+    void                    releaseDevice(NimBLEAdvertisedDevice* device);
+    void                    holdDevice(NimBLEAdvertisedDevice* device);
+    NimBLEAdvertisedDevice* takeHeldDevice(const NimBLEAddress& address, uint8_t sid);
+    void                    removeDevice(std::vector<NimBLEAdvertisedDevice*>::iterator it);
+    void                    indexInsert(NimBLEAdvertisedDevice* device);
+    void                    indexRemove(const NimBLEAdvertisedDevice* device);
+    void                    indexRebuild();
+    void                    lruTouch(NimBLEAdvertisedDevice* device);
+    void                    lruRemove(NimBLEAdvertisedDevice* device);
+
     NimBLEScanCallbacks* m_pScanCallbacks;
     ble_gap_disc_params  m_scanParams;
     NimBLEScanResults    m_scanResults;
     NimBLETaskData*      m_pTaskData;
     uint8_t              m_maxResults;
+    bool                 m_evictOldest;
+
+    // Open addressing (linear probe) index of m_scanResults by address and set ID, size is a power of 2.
+    std::vector<NimBLEAdvertisedDevice*> m_index;
+    // Released devices kept for reuse, capacity is reserved so returning a device never allocates.
+    std::vector<NimBLEAdvertisedDevice*> m_devicePool;
+    // New devices that did not match the filters yet, waiting for their scan response or next fragment.
+    std::vector<NimBLEAdvertisedDevice*> m_heldDevices;
+    NimBLEAdvertisedDevice*              m_lruHead; // least recently seen
+    NimBLEAdvertisedDevice*              m_lruTail; // most recently seen
+    std::vector<NimBLEUUID>              m_uuidFilters;
+    std::vector<uint16_t>                m_mfgFilters;
 
 # if CONFIG_BT_NIMBLE_EXT_ADV
     uint8_t  m_phy{SCAN_ALL};
@@ -653,27 +653,11 @@ int NimBLEServer::handleGattEvent(uint16_t connHandle, uint16_t attrHandle, ble_
 
         case BLE_GATT_ACCESS_OP_WRITE_DSC:
         case BLE_GATT_ACCESS_OP_WRITE_CHR: {
-            uint16_t maxLen = val.max_size();
-            uint16_t len    = ctxt->om->om_len;
-            if (len > maxLen) {
+            if (OS_MBUF_PKTLEN(ctxt->om) > val.max_size()) {
                 return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
             }
 
-            uint8_t buf[maxLen];
-            memcpy(buf, ctxt->om->om_data, len);
-
-            os_mbuf* next;
-            next = SLIST_NEXT(ctxt->om, om_next);
-            while (next != NULL) {
-                if ((len + next->om_len) > maxLen) {
-                    return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
-                }
-                memcpy(&buf[len], next->om_data, next->om_len);
-                len  += next->om_len;
-                next  = SLIST_NEXT(next, om_next);
-            }
-
-            pAtt->writeEvent(buf, len, peerInfo);
+            pAtt->writeEvent(ctxt->om, peerInfo);
             return 0;
         }
 
@@ -54,6 +54,10 @@
 #define MYNEWT_VAL_OS_CPUTIME_TIMER_NUM (5)
 #endif
 
+#ifndef MYNEWT_VAL_OS_TRACE_RING_SIZE
+#define MYNEWT_VAL_OS_TRACE_RING_SIZE (0)
+#endif
+
 #ifndef MYNEWT_VAL_TIMER_5
 #define MYNEWT_VAL_TIMER_5 1
 #endif
@@ -458,6 +462,14 @@
 #define MYNEWT_VAL_BLE_LL_RESOLV_LIST_SIZE (4)
 #endif
 
+#ifndef MYNEWT_VAL_BLE_LL_RESOLV_RPA_CACHE_SIZE
+#define MYNEWT_VAL_BLE_LL_RESOLV_RPA_CACHE_SIZE (16)
+#endif
+
+#ifndef MYNEWT_VAL_BLE_LL_SCHED_INDEX_LEVELS
+#define MYNEWT_VAL_BLE_LL_SCHED_INDEX_LEVELS ((MYNEWT_VAL_BLE_MAX_CONNECTIONS) > 32 ? 2 : 0)
+#endif
+
 #ifndef MYNEWT_VAL_BLE_LL_RNG_BUFSIZE
 #define MYNEWT_VAL_BLE_LL_RNG_BUFSIZE (32)
 #endif
@@ -1095,6 +1107,10 @@
 #define MYNEWT_VAL_BLE_MESH_CRPL (10)
 #endif
 
+#ifndef MYNEWT_VAL_BLE_MESH_RPL_INDEX
+#define MYNEWT_VAL_BLE_MESH_RPL_INDEX ((MYNEWT_VAL_BLE_MESH_CRPL) >= 16)
+#endif
+
 /* Overridden by apps/blemesh (defined by @apache-mynewt-nimble/nimble/host/mesh) */
 #ifndef MYNEWT_VAL_BLE_MESH_DEBUG
 #define MYNEWT_VAL_BLE_MESH_DEBUG (1)
@@ -1350,6 +1366,10 @@
 #define MYNEWT_VAL_BLE_MESH_MSG_CACHE_SIZE (10)
 #endif
 
+#ifndef MYNEWT_VAL_BLE_MESH_MSG_CACHE_INDEX
+#define MYNEWT_VAL_BLE_MESH_MSG_CACHE_INDEX ((MYNEWT_VAL_BLE_MESH_MSG_CACHE_SIZE) > 64)
+#endif
+
 #ifndef MYNEWT_VAL_BLE_MESH_NET_LOG_LVL
 #define MYNEWT_VAL_BLE_MESH_NET_LOG_LVL (1)
 #endif
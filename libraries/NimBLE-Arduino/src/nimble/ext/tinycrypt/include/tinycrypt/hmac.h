@@ -72,8 +72,11 @@ extern "C" {
 struct tc_hmac_state_struct {
 	/* the internal state required by h */
 	struct tc_sha256_state_struct hash_state;
-	/* HMAC key schedule */
-	uint8_t key[2*TC_SHA256_BLOCK_SIZE];
+	/*
+	 * HMAC key schedule: the hash states after the inner and the outer
+	 * padded key blocks
+	 */
+	unsigned int key[2*TC_SHA256_STATE_BLOCKS];
 };
 typedef struct tc_hmac_state_struct *TCHmacState_t;
 
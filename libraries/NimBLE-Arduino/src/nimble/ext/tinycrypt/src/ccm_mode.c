@@ -36,6 +36,9 @@
 
 #include <stdio.h>
 
+/* number of counter blocks encrypted per tc_aes_encrypt_blocks call */
+#define CCM_CTR_BATCH_BLOCKS 4
+
 int tc_ccm_config(TCCcmMode_t c, TCAesKeySched_t sched, uint8_t *nonce,
 		  unsigned int nlen, unsigned int mlen)
 {
@@ -94,9 +97,11 @@ static int ccm_ctr_mode(uint8_t *out, unsigned int outlen, const uint8_t *in,
 			unsigned int inlen, uint8_t *ctr, const TCAesKeySched_t sched)
 {
 
-	uint8_t buffer[TC_AES_BLOCK_SIZE];
+	uint8_t buffer[CCM_CTR_BATCH_BLOCKS * TC_AES_BLOCK_SIZE];
 	uint8_t nonce[TC_AES_BLOCK_SIZE];
 	uint16_t block_num;
+	unsigned int nblocks;
+	unsigned int n;
 	unsigned int i;
 
 	/* input sanity check: */
@@ -115,17 +120,33 @@ static int ccm_ctr_mode(uint8_t *out, unsigned int outlen, const uint8_t *in,
 
 	/* select the last 2 bytes of the nonce to be incremented */
 	block_num = (uint16_t) ((nonce[14] << 8)|(nonce[15]));
-	for (i = 0; i < inlen; ++i) {
-		if ((i % (TC_AES_BLOCK_SIZE)) == 0) {
+	while (inlen > 0) {
+		/* lay out the counter blocks for this batch */
+		nblocks = (inlen + TC_AES_BLOCK_SIZE - 1) / TC_AES_BLOCK_SIZE;
+		if (nblocks > CCM_CTR_BATCH_BLOCKS) {
+			nblocks = CCM_CTR_BATCH_BLOCKS;
+		}
+		for (i = 0; i < nblocks; ++i) {
 			block_num++;
 			nonce[14] = (uint8_t)(block_num >> 8);
 			nonce[15] = (uint8_t)(block_num);
-			if (!tc_aes_encrypt(buffer, nonce, sched)) {
-				return TC_CRYPTO_FAIL;
-			}
+			(void) _copy(&buffer[i * TC_AES_BLOCK_SIZE], TC_AES_BLOCK_SIZE,
+				     nonce, sizeof(nonce));
+		}
+
+		if (!tc_aes_encrypt_blocks(buffer, buffer, nblocks, sched)) {
+			return TC_CRYPTO_FAIL;
 		}
+
 		/* update the output */
-		*out++ = buffer[i % (TC_AES_BLOCK_SIZE)] ^ *in++;
+		n = nblocks * TC_AES_BLOCK_SIZE;
+		if (n > inlen) {
+			n = inlen;
+		}
+		for (i = 0; i < n; ++i) {
+			*out++ = buffer[i] ^ *in++;
+		}
+		inlen -= n;
 	}
 
 	/* update the counter */
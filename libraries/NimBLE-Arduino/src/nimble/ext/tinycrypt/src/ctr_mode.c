@@ -34,13 +34,18 @@
 #include <nimble/ext/tinycrypt/include/tinycrypt/ctr_mode.h>
 #include <nimble/ext/tinycrypt/include/tinycrypt/utils.h>
 
+/* number of counter blocks encrypted per tc_aes_encrypt_blocks call */
+#define CTR_BATCH_BLOCKS 4
+
 int tc_ctr_mode(uint8_t *out, unsigned int outlen, const uint8_t *in,
 		unsigned int inlen, uint8_t *ctr, const TCAesKeySched_t sched)
 {
 
-	uint8_t buffer[TC_AES_BLOCK_SIZE];
+	uint8_t buffer[CTR_BATCH_BLOCKS * TC_AES_BLOCK_SIZE];
 	uint8_t nonce[TC_AES_BLOCK_SIZE];
 	unsigned int block_num;
+	unsigned int nblocks;
+	unsigned int n;
 	unsigned int i;
 
 	/* input sanity check: */
@@ -60,21 +65,36 @@ int tc_ctr_mode(uint8_t *out, unsigned int outlen, const uint8_t *in,
 	/* select the last 4 bytes of the nonce to be incremented */
 	block_num = (nonce[12] << 24) | (nonce[13] << 16) |
 		    (nonce[14] << 8) | (nonce[15]);
-	for (i = 0; i < inlen; ++i) {
-		if ((i % (TC_AES_BLOCK_SIZE)) == 0) {
-			/* encrypt data using the current nonce */
-			if (tc_aes_encrypt(buffer, nonce, sched)) {
-				block_num++;
-				nonce[12] = (uint8_t)(block_num >> 24);
-				nonce[13] = (uint8_t)(block_num >> 16);
-				nonce[14] = (uint8_t)(block_num >> 8);
-				nonce[15] = (uint8_t)(block_num);
-			} else {
-				return TC_CRYPTO_FAIL;
-			}
+	while (inlen > 0) {
+		/* lay out the counter blocks for this batch */
+		nblocks = (inlen + TC_AES_BLOCK_SIZE - 1) / TC_AES_BLOCK_SIZE;
+		if (nblocks > CTR_BATCH_BLOCKS) {
+			nblocks = CTR_BATCH_BLOCKS;
+		}
+		for (i = 0; i < nblocks; ++i) {
+			(void)_copy(&buffer[i * TC_AES_BLOCK_SIZE], TC_AES_BLOCK_SIZE,
+				    nonce, sizeof(nonce));
+			block_num++;
+			nonce[12] = (uint8_t)(block_num >> 24);
+			nonce[13] = (uint8_t)(block_num >> 16);
+			nonce[14] = (uint8_t)(block_num >> 8);
+			nonce[15] = (uint8_t)(block_num);
+		}
+
+		/* encrypt data using the counter blocks */
+		if (!tc_aes_encrypt_blocks(buffer, buffer, nblocks, sched)) {
+			return TC_CRYPTO_FAIL;
 		}
+
 		/* update the output */
-		*out++ = buffer[i%(TC_AES_BLOCK_SIZE)] ^ *in++;
+		n = nblocks * TC_AES_BLOCK_SIZE;
+		if (n > inlen) {
+			n = inlen;
+		}
+		for (i = 0; i < n; ++i) {
+			*out++ = buffer[i] ^ *in++;
+		}
+		inlen -= n;
 	}
 
 	/* update the counter */
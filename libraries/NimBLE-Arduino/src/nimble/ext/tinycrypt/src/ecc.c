@@ -54,6 +54,7 @@
 
 #include <nimble/ext/tinycrypt/include/tinycrypt/ecc.h>
 #include <nimble/ext/tinycrypt/include/tinycrypt/ecc_platform_specific.h>
+#include <nimble/porting/nimble/include/syscfg/syscfg.h>
 #include <string.h>
 
 /* IMPORTANT: Make sure a cryptographically-secure PRNG is set and the platform
@@ -291,6 +292,54 @@ static void uECC_vli_mult(uECC_word_t *result, const uECC_word_t *left,
 	result[num_words * 2 - 1] = r0;
 }
 
+/* r2:r1:r0 += 2 * a * b */
+static void mul2add(uECC_word_t a, uECC_word_t b, uECC_word_t *r0,
+		    uECC_word_t *r1, uECC_word_t *r2)
+{
+
+	uECC_dword_t p = (uECC_dword_t)a * b;
+	uECC_dword_t r01 = ((uECC_dword_t)(*r1) << uECC_WORD_BITS) | *r0;
+	*r2 += (p >> (uECC_WORD_BITS * 2 - 1));
+	p *= 2;
+	r01 += p;
+	*r2 += (r01 < p);
+	*r1 = r01 >> uECC_WORD_BITS;
+	*r0 = (uECC_word_t)r01;
+
+}
+
+/*
+ * Computes result = left * left, using each cross product once and doubling
+ * it. Result must be 2 * num_words long.
+ */
+static void uECC_vli_square(uECC_word_t *result, const uECC_word_t *left,
+			    wordcount_t num_words)
+{
+
+	uECC_word_t r0 = 0;
+	uECC_word_t r1 = 0;
+	uECC_word_t r2 = 0;
+	wordcount_t i, k;
+
+	for (k = 0; k < num_words * 2 - 1; ++k) {
+
+		i = (k < num_words) ? 0 : (k + 1) - num_words;
+		for ( ; i <= k && i <= k - i; ++i) {
+			if (i < k - i) {
+				mul2add(left[i], left[k - i], &r0, &r1, &r2);
+			} else {
+				muladd(left[i], left[k - i], &r0, &r1, &r2);
+			}
+		}
+
+		result[k] = r0;
+		r0 = r1;
+		r1 = r2;
+		r2 = 0;
+	}
+	result[num_words * 2 - 1] = r0;
+}
+
 void uECC_vli_modAdd(uECC_word_t *result, const uECC_word_t *left,
 		     const uECC_word_t *right, const uECC_word_t *mod,
 		     wordcount_t num_words)
@@ -383,7 +432,10 @@ static void uECC_vli_modSquare_fast(uECC_word_t *result,
 				    const uECC_word_t *left,
 				    uECC_Curve curve)
 {
-	uECC_vli_modMult_fast(result, left, left, curve);
+	uECC_word_t product[2 * NUM_ECC_WORDS];
+	uECC_vli_square(product, left, curve->num_words);
+
+	curve->mmod_fast(result, product);
 }
 
 
@@ -788,6 +840,248 @@ uECC_word_t regularize_k(const uECC_word_t * const k, uECC_word_t *k0,
 	return carry;
 }
 
+#if MYNEWT_VAL(TINYCRYPT_UECC_GEN_COMB)
+/*
+ * Comb table for multiplying the generator: entry b - 1 is the sum of
+ * 2^(64 * j) * G over the bits j set in b, in affine coordinates.
+ */
+#define COMB_TEETH 4
+#define COMB_SPACING 64
+
+static const uECC_word_t comb_G[(1 << COMB_TEETH) - 1][NUM_ECC_WORDS * 2] = {
+	{
+		0xd898c296, 0xf4a13945, 0x2deb33a0, 0x77037d81,
+		0x63a440f2, 0xf8bce6e5, 0xe12c4247, 0x6b17d1f2,
+		0x37bf51f5, 0xcbb64068, 0x6b315ece, 0x2bce3357,
+		0x7c0f9e16, 0x8ee7eb4a, 0xfe1a7f9b, 0x4fe342e2
+	},
+	{
+		0x8e14db63, 0x90e75cb4, 0xad651f7e, 0x29493baa,
+		0x326e25de, 0x8492592e, 0x2811aaa5, 0x0fa822bc,
+		0x5f462ee7, 0xe4112454, 0x50fe82f5, 0x34b1a650,
+		0xb3df188b, 0x6f4ad4bc, 0xf5dba80d, 0xbff44ae8
+	},
+	{
+		0x097992af, 0x93391ce2, 0x0d35f1fa, 0xe96c98fd,
+		0x95e02789, 0xb257c0de, 0x89d6726f, 0x300a4bbc,
+		0xc08127a0, 0xaa54a291, 0xa9d806a5, 0x5bb1eead,
+		0xff1e3c6f, 0x7f1ddb25, 0xd09b4644, 0x72aac7e0
+	},
+	{
+		0xd789bd85, 0x57c84fc9, 0xc297eac3, 0xfc35ff7d,
+		0x88c6766e, 0xfb982fd5, 0xeedb5e67, 0x447d739b,
+		0x72e25b32, 0x0c7e33c9, 0xa7fae500, 0x3d349b95,
+		0x3a4aaff7, 0xe12e9d95, 0x834131ee, 0x2d4825ab
+	},
+	{
+		0x2a1d367f, 0x13949c93, 0x1a0a11b7, 0xef7fbd2b,
+		0xb91dfc60, 0xddc6068b, 0x8a9c72ff, 0xef951932,
+		0x7376d8a8, 0x196035a7, 0x95ca1740, 0x23183b08,
+		0x022c219c, 0xc1ee9807, 0x7dbb2c9b, 0x611e9fc3
+	},
+	{
+		0x0b57f4bc, 0xcae2b192, 0xc6c9bc36, 0x2936df5e,
+		0xe11238bf, 0x7dea6482, 0x7b51f5d8, 0x55066379,
+		0x348a964c, 0x44ffe216, 0xdbdefbe1, 0x9fb3d576,
+		0x8d9d50e5, 0x0afa4001, 0x8aecb851, 0x15716484
+	},
+	{
+		0xfc5cde01, 0xe48ecaff, 0x0d715f26, 0x7ccd84e7,
+		0xf43e4391, 0xa2e8f483, 0xb21141ea, 0xeb5d7745,
+		0x731a3479, 0xcac917e2, 0x2844b645, 0x85f22cfe,
+		0x58006cee, 0x0990e6a1, 0xdbecc17b, 0xeafd72eb
+	},
+	{
+		0x313728be, 0x6cf20ffb, 0xa3c6b94a, 0x96439591,
+		0x44315fc5, 0x2736ff83, 0xa7849276, 0xa6d39677,
+		0xc357f5f4, 0xf2bab833, 0x2284059b, 0x824a920c,
+		0x2d27ecdf, 0x66b8babd, 0x9b0b8816, 0x674f8474
+	},
+	{
+		0x677c8a3e, 0x2df48c04, 0x0203a56b, 0x74e02f08,
+		0xb8c7fedb, 0x31855f7d, 0x72c9ddad, 0x4e769e76,
+		0xb824bbb0, 0xa4c36165, 0x3b9122a5, 0xfb9ae16f,
+		0x06947281, 0x1ec00572, 0xde830663, 0x42b99082
+	},
+	{
+		0xdda868b9, 0x6ef95150, 0x9c0ce131, 0xd1f89e79,
+		0x08a1c478, 0x7fdc1ca0, 0x1c6ce04d, 0x78878ef6,
+		0x1fe0d976, 0x9c62b912, 0xbde08d4f, 0x6ace570e,
+		0x12309def, 0xde53142c, 0x7b72c321, 0xb6cb3f5d
+	},
+	{
+		0xc31a3573, 0x7f991ed2, 0xd54fb496, 0x5b82dd5b,
+		0x812ffcae, 0x595c5220, 0x716b1287, 0x0c88bc4d,
+		0x5f48aca8, 0x3a57bf63, 0xdf2564f3, 0x7c8181f4,
+		0x9c04e6aa, 0x18d1b5b3, 0xf3901dc6, 0xdd5ddea3
+	},
+	{
+		0x3e72ad0c, 0xe96a79fb, 0x42ba792f, 0x43a0a28c,
+		0x083e49f3, 0xefe0a423, 0x6b317466, 0x68f344af,
+		0x3fb24d4a, 0xcdfe17db, 0x71f5c626, 0x668bfc22,
+		0x24d67ff3, 0x604ed93c, 0xf8540a20, 0x31b9c405
+	},
+	{
+		0xa2582e7f, 0xd36b4789, 0x4ec39c28, 0x0d1a1014,
+		0xedbad7a0, 0x663c62c3, 0x6f461db9, 0x4052bf4b,
+		0x188d25eb, 0x235a27c3, 0x99bfcc5b, 0xe724f339,
+		0x71d70cc8, 0x862be6bd, 0x90b0fc61, 0xfecf4d51
+	},
+	{
+		0xa1d4cfac, 0x74346c10, 0x8526a7a4, 0xafdf5cc0,
+		0xf62bff7a, 0x123202a8, 0xc802e41a, 0x1eddbae2,
+		0xd603f844, 0x8fa0af2d, 0x4c701917, 0x36e06b7e,
+		0x73db33a0, 0x0c45f452, 0x560ebcfc, 0x43104d86
+	},
+	{
+		0x0d1d78e5, 0x9615b511, 0x25c4744b, 0x66b0de32,
+		0x6aaf363a, 0x0a4a46fb, 0x84f7a21c, 0xb48e26b4,
+		0x21a01b2d, 0x06ebb0f6, 0x8b7b0f98, 0xc004e404,
+		0xfed6f668, 0x64131bcd, 0x4d4d3dab, 0xfac01540
+	}
+};
+
+/* all ones if a == 0, otherwise 0, without a branch */
+static uECC_word_t mask_zero(uECC_word_t a)
+{
+	return (uECC_word_t)0 - ((~a & (a - 1)) >> (uECC_WORD_BITS - 1));
+}
+
+/* dest = src where mask is all ones */
+static void vli_cmov(uECC_word_t *dest, const uECC_word_t *src,
+		     uECC_word_t mask, wordcount_t num_words)
+{
+	wordcount_t i;
+	for (i = 0; i < num_words; ++i) {
+		dest[i] = (dest[i] & ~mask) | (src[i] & mask);
+	}
+}
+
+/* Reads every entry, so that the memory accesses do not depend on digit. */
+static void comb_select(uECC_word_t *point, unsigned int digit)
+{
+	unsigned int b;
+	for (b = 1; b < (1 << COMB_TEETH); ++b) {
+		vli_cmov(point, comb_G[b - 1], mask_zero(b ^ digit),
+			 NUM_ECC_WORDS * 2);
+	}
+}
+
+/*
+ * (X3, Y3, Z3) = (X1, Y1, Z1) + (x2, y2), Jacobian plus affine.
+ * Returns all ones if the x coordinates are the same, the formula does not
+ * work for doubling or adding the negated point.
+ */
+static uECC_word_t add_mixed(uECC_word_t *X3, uECC_word_t *Y3, uECC_word_t *Z3,
+			     const uECC_word_t *X1, const uECC_word_t *Y1,
+			     const uECC_word_t *Z1, const uECC_word_t *point,
+			     uECC_Curve curve)
+{
+	uECC_word_t t1[NUM_ECC_WORDS];
+	uECC_word_t t2[NUM_ECC_WORDS];
+	uECC_word_t t3[NUM_ECC_WORDS];
+	uECC_word_t t4[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+
+	uECC_vli_modSquare_fast(t1, Z1, curve); /* t1 = z1^2 */
+	uECC_vli_modMult_fast(t2, point, t1, curve); /* t2 = x2*z1^2 = U2 */
+	uECC_vli_modMult_fast(t1, t1, Z1, curve); /* t1 = z1^3 */
+	uECC_vli_modMult_fast(t1, point + num_words, t1, curve); /* t1 = y2*z1^3 = S2 */
+	uECC_vli_modSub(t2, t2, X1, curve->p, num_words); /* t2 = U2 - x1 = H */
+	uECC_vli_modSub(t1, t1, Y1, curve->p, num_words); /* t1 = S2 - y1 = R */
+
+	uECC_vli_modMult_fast(Z3, Z1, t2, curve); /* z3 = z1*H */
+	uECC_vli_modSquare_fast(t3, t2, curve); /* t3 = H^2 */
+	uECC_vli_modMult_fast(t4, t2, t3, curve); /* t4 = H^3 */
+	uECC_vli_modMult_fast(t3, X1, t3, curve); /* t3 = x1*H^2 = V */
+
+	uECC_vli_modSquare_fast(X3, t1, curve); /* x3 = R^2 */
+	uECC_vli_modSub(X3, X3, t4, curve->p, num_words); /* x3 = R^2 - H^3 */
+	uECC_vli_modSub(X3, X3, t3, curve->p, num_words);
+	uECC_vli_modSub(X3, X3, t3, curve->p, num_words); /* x3 = R^2 - H^3 - 2V */
+
+	uECC_vli_modSub(t3, t3, X3, curve->p, num_words); /* t3 = V - x3 */
+	uECC_vli_modMult_fast(t3, t1, t3, curve); /* t3 = R*(V - x3) */
+	uECC_vli_modMult_fast(t4, Y1, t4, curve); /* t4 = y1*H^3 */
+	uECC_vli_modSub(Y3, t3, t4, curve->p, num_words); /* y3 = R*(V - x3) - y1*H^3 */
+
+	return mask_zero(!uECC_vli_isZero(t2, num_words));
+}
+
+/*
+ * result = scalar * G with the comb table, 64 doublings and 64 additions
+ * instead of the 256 steps of the ladder. Every step does the same work
+ * whatever the digit is. Returns 0 if an addition hit the case add_mixed
+ * cannot handle, the caller then falls back to the ladder.
+ */
+static uECC_word_t EccPoint_mult_comb(uECC_word_t *result,
+				      const uECC_word_t *scalar,
+				      uECC_Curve curve)
+{
+	uECC_word_t X[NUM_ECC_WORDS];
+	uECC_word_t Y[NUM_ECC_WORDS];
+	uECC_word_t Z[NUM_ECC_WORDS];
+	uECC_word_t X3[NUM_ECC_WORDS];
+	uECC_word_t Y3[NUM_ECC_WORDS];
+	uECC_word_t Z3[NUM_ECC_WORDS];
+	uECC_word_t T[NUM_ECC_WORDS * 2];
+	uECC_word_t one[NUM_ECC_WORDS];
+	uECC_word_t infinity = (uECC_word_t)-1;
+	uECC_word_t failed = 0;
+	uECC_word_t nonzero;
+	uECC_word_t same_x;
+	unsigned int digit;
+	bitcount_t i;
+	wordcount_t j;
+	wordcount_t num_words = curve->num_words;
+
+	uECC_vli_clear(one, num_words);
+	one[0] = 1;
+
+	/*
+	 * R starts at infinity. Until the first non-zero digit it holds G, so
+	 * that the doubling and the addition run on a real point, but the sums
+	 * are not kept.
+	 */
+	uECC_vli_set(X, curve->G, num_words);
+	uECC_vli_set(Y, curve->G + num_words, num_words);
+	uECC_vli_set(Z, one, num_words);
+
+	for (i = COMB_SPACING - 1; i >= 0; --i) {
+		digit = 0;
+		for (j = 0; j < COMB_TEETH; ++j) {
+			digit |= (!!uECC_vli_testBit(scalar, i + j * COMB_SPACING)) << j;
+		}
+		nonzero = ~mask_zero(digit);
+
+		curve->double_jacobian(X, Y, Z, curve);
+		comb_select(T, digit);
+		same_x = add_mixed(X3, Y3, Z3, X, Y, Z, T, curve);
+		failed |= same_x & nonzero & ~infinity;
+
+		/* R = R + T, or T if R is infinity, or R if the digit is 0 */
+		vli_cmov(X, X3, nonzero & ~infinity, num_words);
+		vli_cmov(Y, Y3, nonzero & ~infinity, num_words);
+		vli_cmov(Z, Z3, nonzero & ~infinity, num_words);
+		vli_cmov(X, T, nonzero & infinity, num_words);
+		vli_cmov(Y, T + num_words, nonzero & infinity, num_words);
+		vli_cmov(Z, one, nonzero & infinity, num_words);
+		infinity &= ~nonzero;
+	}
+
+	if (failed | infinity) {
+		return 0;
+	}
+
+	uECC_vli_modInv(Z, Z, curve->p, num_words); /* 1 / z */
+	apply_z(X, Y, Z, curve);
+
+	uECC_vli_set(result, X, num_words);
+	uECC_vli_set(result + num_words, Y, num_words);
+	return 1;
+}
+#endif /* MYNEWT_VAL(TINYCRYPT_UECC_GEN_COMB) */
+
 uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
 					uECC_word_t *private_key,
 					uECC_Curve curve)
@@ -798,6 +1092,12 @@ uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
 	uECC_word_t *p2[2] = {tmp1, tmp2};
 	uECC_word_t carry;
 
+#if MYNEWT_VAL(TINYCRYPT_UECC_GEN_COMB)
+	if (EccPoint_mult_comb(result, private_key, curve)) {
+		return 1;
+	}
+#endif
+
 	/* Regularize the bitcount for the private key so that attackers cannot
 	 * use a side channel attack to learn the number of leading zeros. */
 	carry = regularize_k(private_key, tmp1, tmp2, curve);
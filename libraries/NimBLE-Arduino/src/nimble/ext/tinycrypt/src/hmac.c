@@ -34,19 +34,61 @@
 #include <nimble/ext/tinycrypt/include/tinycrypt/constants.h>
 #include <nimble/ext/tinycrypt/include/tinycrypt/utils.h>
 
-static void rekey(uint8_t *key, const uint8_t *new_key, unsigned int key_size)
+/*
+ * Hash state after one block of zero bytes, which is the key schedule left in
+ * an erased ctx (see tc_hmac_final).
+ */
+static const unsigned int zero_key_iv[TC_SHA256_STATE_BLOCKS] = {
+	0xda5698be, 0x17b9b469, 0x62335799, 0x779fbeca,
+	0x8ce5d491, 0xc0d26243, 0xbafef9ea, 0x1837a9d8
+};
+
+/*
+ * Hashes the key xor'ed with pad as one block, keeping the state so that
+ * tc_hmac_init and tc_hmac_final can start from it instead of hashing the
+ * padded key again.
+ */
+static void pad_state(unsigned int *iv, const uint8_t *new_key,
+		      unsigned int key_size, uint8_t pad,
+		      TCSha256State_t hash_state)
 {
-	const uint8_t inner_pad = (uint8_t) 0x36;
-	const uint8_t outer_pad = (uint8_t) 0x5c;
+	uint8_t block[TC_SHA256_BLOCK_SIZE];
 	unsigned int i;
 
 	for (i = 0; i < key_size; ++i) {
-		key[i] = inner_pad ^ new_key[i];
-		key[i + TC_SHA256_BLOCK_SIZE] = outer_pad ^ new_key[i];
+		block[i] = pad ^ new_key[i];
 	}
 	for (; i < TC_SHA256_BLOCK_SIZE; ++i) {
-		key[i] = inner_pad; key[i + TC_SHA256_BLOCK_SIZE] = outer_pad;
+		block[i] = pad;
 	}
+
+	(void)tc_sha256_init(hash_state);
+	(void)tc_sha256_update(hash_state, block, TC_SHA256_BLOCK_SIZE);
+	(void)_copy((uint8_t *)iv, sizeof(hash_state->iv),
+		    (const uint8_t *)hash_state->iv, sizeof(hash_state->iv));
+
+	_set(block, 0, sizeof(block));
+}
+
+static void rekey(TCHmacState_t ctx, const uint8_t *new_key,
+		  unsigned int key_size)
+{
+	const uint8_t inner_pad = (uint8_t) 0x36;
+	const uint8_t outer_pad = (uint8_t) 0x5c;
+
+	pad_state(&ctx->key[0], new_key, key_size, inner_pad, &ctx->hash_state);
+	pad_state(&ctx->key[TC_SHA256_STATE_BLOCKS], new_key, key_size,
+		  outer_pad, &ctx->hash_state);
+	_set(&ctx->hash_state, 0, sizeof(ctx->hash_state));
+}
+
+/* sets hash_state as if the padded key block at iv had just been hashed */
+static void resume(TCSha256State_t hash_state, const unsigned int *iv)
+{
+	(void)tc_sha256_init(hash_state);
+	(void)_copy((uint8_t *)hash_state->iv, sizeof(hash_state->iv),
+		    (const uint8_t *)iv, sizeof(hash_state->iv));
+	hash_state->bits_hashed = (TC_SHA256_BLOCK_SIZE << 3);
 }
 
 int tc_hmac_set_key(TCHmacState_t ctx, const uint8_t *key,
@@ -62,6 +104,7 @@ int tc_hmac_set_key(TCHmacState_t ctx, const uint8_t *key,
 
 	const uint8_t dummy_key[key_size];
 	struct tc_hmac_state_struct dummy_state;
+	uint8_t digest[TC_SHA256_DIGEST_SIZE];
 
 	if (key_size <= TC_SHA256_BLOCK_SIZE) {
 		/*
@@ -75,21 +118,19 @@ int tc_hmac_set_key(TCHmacState_t ctx, const uint8_t *key,
 		(void)tc_sha256_update(&dummy_state.hash_state,
 				       dummy_key,
 				       key_size);
-		(void)tc_sha256_final(&dummy_state.key[TC_SHA256_DIGEST_SIZE],
-				      &dummy_state.hash_state);
+		(void)tc_sha256_final(digest, &dummy_state.hash_state);
 
 		/* Actual code for when key_size <= TC_SHA256_BLOCK_SIZE: */
-		rekey(ctx->key, key, key_size);
+		rekey(ctx, key, key_size);
 	} else {
 		(void)tc_sha256_init(&ctx->hash_state);
 		(void)tc_sha256_update(&ctx->hash_state, key, key_size);
-		(void)tc_sha256_final(&ctx->key[TC_SHA256_DIGEST_SIZE],
-				      &ctx->hash_state);
-		rekey(ctx->key,
-		      &ctx->key[TC_SHA256_DIGEST_SIZE],
-		      TC_SHA256_DIGEST_SIZE);
+		(void)tc_sha256_final(digest, &ctx->hash_state);
+		rekey(ctx, digest, TC_SHA256_DIGEST_SIZE);
 	}
 
+	_set(digest, 0, sizeof(digest));
+
 	return TC_CRYPTO_SUCCESS;
 }
 
@@ -101,8 +142,7 @@ int tc_hmac_init(TCHmacState_t ctx)
 		return TC_CRYPTO_FAIL;
 	}
 
-  (void) tc_sha256_init(&ctx->hash_state);
-  (void) tc_sha256_update(&ctx->hash_state, ctx->key, TC_SHA256_BLOCK_SIZE);
+	resume(&ctx->hash_state, &ctx->key[0]);
 
 	return TC_CRYPTO_SUCCESS;
 }
@@ -134,15 +174,20 @@ int tc_hmac_final(uint8_t *tag, unsigned int taglen, TCHmacState_t ctx)
 
 	(void) tc_sha256_final(tag, &ctx->hash_state);
 
-	(void)tc_sha256_init(&ctx->hash_state);
-	(void)tc_sha256_update(&ctx->hash_state,
-			       &ctx->key[TC_SHA256_BLOCK_SIZE],
-				TC_SHA256_BLOCK_SIZE);
+	resume(&ctx->hash_state, &ctx->key[TC_SHA256_STATE_BLOCKS]);
 	(void)tc_sha256_update(&ctx->hash_state, tag, TC_SHA256_DIGEST_SIZE);
 	(void)tc_sha256_final(tag, &ctx->hash_state);
 
-	/* destroy the current state */
+	/*
+	 * destroy the current state, leaving the schedule of an all zero key as
+	 * erasing the padded key blocks used to
+	 */
 	_set(ctx, 0, sizeof(*ctx));
+	(void)_copy((uint8_t *)&ctx->key[0], sizeof(zero_key_iv),
+		    (const uint8_t *)zero_key_iv, sizeof(zero_key_iv));
+	(void)_copy((uint8_t *)&ctx->key[TC_SHA256_STATE_BLOCKS],
+		    sizeof(zero_key_iv),
+		    (const uint8_t *)zero_key_iv, sizeof(zero_key_iv));
 
 	return TC_CRYPTO_SUCCESS;
 }
@@ -64,6 +64,8 @@ int tc_sha256_init(TCSha256State_t s)
 
 int tc_sha256_update(TCSha256State_t s, const uint8_t *data, size_t datalen)
 {
+	size_t n;
+
 	/* input sanity check: */
 	if (s == (TCSha256State_t) 0 ||
 	    data == (void *) 0) {
@@ -72,8 +74,24 @@ int tc_sha256_update(TCSha256State_t s, const uint8_t *data, size_t datalen)
 		return TC_CRYPTO_SUCCESS;
 	}
 
-	while (datalen-- > 0) {
-		s->leftover[s->leftover_offset++] = *(data++);
+	while (datalen > 0) {
+		if (s->leftover_offset == 0 && datalen >= TC_SHA256_BLOCK_SIZE) {
+			/* whole blocks are hashed straight from the input */
+			compress(s->iv, data);
+			data += TC_SHA256_BLOCK_SIZE;
+			datalen -= TC_SHA256_BLOCK_SIZE;
+			s->bits_hashed += (TC_SHA256_BLOCK_SIZE << 3);
+			continue;
+		}
+
+		n = TC_SHA256_BLOCK_SIZE - s->leftover_offset;
+		if (n > datalen) {
+			n = datalen;
+		}
+		(void)_copy(s->leftover + s->leftover_offset, n, data, n);
+		s->leftover_offset += n;
+		data += n;
+		datalen -= n;
 		if (s->leftover_offset >= TC_SHA256_BLOCK_SIZE) {
 			compress(s->iv, s->leftover);
 			s->leftover_offset = 0;
@@ -164,52 +182,60 @@ static inline unsigned int ROTR(unsigned int a, unsigned int n)
 #define sigma0(a)(ROTR((a), 7) ^ ROTR((a), 18) ^ ((a) >> 3))
 #define sigma1(a)(ROTR((a), 17) ^ ROTR((a), 19) ^ ((a) >> 10))
 
-#define Ch(a, b, c)(((a) & (b)) ^ ((~(a)) & (c)))
-#define Maj(a, b, c)(((a) & (b)) ^ ((a) & (c)) ^ ((b) & (c)))
+#define Ch(a, b, c)((c) ^ ((a) & ((b) ^ (c))))
+#define Maj(a, b, c)(((a) & (b)) | ((c) & ((a) | (b))))
 
-static inline unsigned int BigEndian(const uint8_t **c)
-{
-	unsigned int n = 0;
+#define BigEndian(c)(((unsigned int)(c)[0] << 24) | \
+		     ((unsigned int)(c)[1] << 16) | \
+		     ((unsigned int)(c)[2] << 8) | \
+		     ((unsigned int)(c)[3]))
 
-	n = (((unsigned int)(*((*c)++))) << 24);
-	n |= ((unsigned int)(*((*c)++)) << 16);
-	n |= ((unsigned int)(*((*c)++)) << 8);
-	n |= ((unsigned int)(*((*c)++)));
-	return n;
-}
+/* message schedule word i, for i < 16 from the block, then in place in w[16] */
+#define W0(i)(w[i] = BigEndian(data + 4 * (i)))
+#define W(i)(w[(i) & 0x0f] += sigma1(w[((i) + 14) & 0x0f]) + \
+		w[((i) + 9) & 0x0f] + sigma0(w[((i) + 1) & 0x0f]))
+
+/*
+ * One round without moving the working variables: d becomes the new e and h
+ * the new a, the next round is called with the names rotated by one.
+ */
+#define ROUND(a, b, c, d, e, f, g, h, i, x) do { \
+		t1 = (h) + Sigma1(e) + Ch(e, f, g) + k256[i] + (x); \
+		(d) += t1; \
+		(h) = t1 + Sigma0(a) + Maj(a, b, c); \
+	} while (0)
 
 static void compress(unsigned int *iv, const uint8_t *data)
 {
 	unsigned int a, b, c, d, e, f, g, h;
-	unsigned int s0, s1;
-	unsigned int t1, t2;
-	unsigned int work_space[16];
-	unsigned int n;
+	unsigned int t1;
+	unsigned int w[16];
 	unsigned int i;
 
 	a = iv[0]; b = iv[1]; c = iv[2]; d = iv[3];
 	e = iv[4]; f = iv[5]; g = iv[6]; h = iv[7];
 
-	for (i = 0; i < 16; ++i) {
-		n = BigEndian(&data);
-		t1 = work_space[i] = n;
-		t1 += h + Sigma1(e) + Ch(e, f, g) + k256[i];
-		t2 = Sigma0(a) + Maj(a, b, c);
-		h = g; g = f; f = e; e = d + t1;
-		d = c; c = b; b = a; a = t1 + t2;
+	/* eight rounds per pass, so the variables are back in place each pass */
+	for (i = 0; i < 16; i += 8) {
+		ROUND(a, b, c, d, e, f, g, h, i, W0(i));
+		ROUND(h, a, b, c, d, e, f, g, i + 1, W0(i + 1));
+		ROUND(g, h, a, b, c, d, e, f, i + 2, W0(i + 2));
+		ROUND(f, g, h, a, b, c, d, e, i + 3, W0(i + 3));
+		ROUND(e, f, g, h, a, b, c, d, i + 4, W0(i + 4));
+		ROUND(d, e, f, g, h, a, b, c, i + 5, W0(i + 5));
+		ROUND(c, d, e, f, g, h, a, b, i + 6, W0(i + 6));
+		ROUND(b, c, d, e, f, g, h, a, i + 7, W0(i + 7));
 	}
 
-	for ( ; i < 64; ++i) {
-		s0 = work_space[(i+1)&0x0f];
-		s0 = sigma0(s0);
-		s1 = work_space[(i+14)&0x0f];
-		s1 = sigma1(s1);
-
-		t1 = work_space[i&0xf] += s0 + s1 + work_space[(i+9)&0xf];
-		t1 += h + Sigma1(e) + Ch(e, f, g) + k256[i];
-		t2 = Sigma0(a) + Maj(a, b, c);
-		h = g; g = f; f = e; e = d + t1;
-		d = c; c = b; b = a; a = t1 + t2;
+	for ( ; i < 64; i += 8) {
+		ROUND(a, b, c, d, e, f, g, h, i, W(i));
+		ROUND(h, a, b, c, d, e, f, g, i + 1, W(i + 1));
+		ROUND(g, h, a, b, c, d, e, f, i + 2, W(i + 2));
+		ROUND(f, g, h, a, b, c, d, e, i + 3, W(i + 3));
+		ROUND(e, f, g, h, a, b, c, d, i + 4, W(i + 4));
+		ROUND(d, e, f, g, h, a, b, c, i + 5, W(i + 5));
+		ROUND(c, d, e, f, g, h, a, b, i + 6, W(i + 6));
+		ROUND(b, c, d, e, f, g, h, a, i + 7, W(i + 7));
 	}
 
 	iv[0] += a; iv[1] += b; iv[2] += c; iv[3] += d;
@@ -112,6 +112,9 @@ int ble_ll_resolv_rpa(const uint8_t *rpa, const uint8_t *irk);
 /* Try to resolve peer RPA and return index on RL if matched */
 int ble_ll_resolv_peer_rpa_any(const uint8_t *rpa);
 
+/* Resolve RPA with the local or peer IRK of RL entry, uses the RPA cache */
+int ble_ll_resolv_rpa_rl(const uint8_t *rpa, int index, int local);
+
 /* Initialize resolv*/
 void ble_ll_resolv_init(void);
 
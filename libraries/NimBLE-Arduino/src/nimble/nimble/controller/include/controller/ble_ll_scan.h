@@ -249,6 +249,17 @@ int ble_ll_scan_dup_check_ext(uint8_t addr_type, uint8_t *addr, bool has_aux,
                               uint16_t adi);
 int ble_ll_scan_dup_update_ext(uint8_t addr_type, uint8_t *addr, bool has_aux,
                                uint16_t adi);
+
+/* Duplicate filter statistics, since init or last read with clear */
+struct ble_ll_scan_dup_stats {
+    uint32_t hits;      /* advertiser found in the filter */
+    uint32_t misses;    /* advertiser added to the filter */
+    uint32_t evictions; /* advertiser removed to make room for a new one */
+};
+
+/* Read the duplicate filter statistics and entries in use */
+uint16_t ble_ll_scan_dup_stats_read(struct ble_ll_scan_dup_stats *stats,
+                                    int clear);
 int ble_ll_scan_have_rxd_scan_rsp(uint8_t *addr, uint8_t txadd, uint8_t ext_adv,
                                   uint16_t adi);
 void ble_ll_scan_add_scan_rsp_adv(uint8_t *addr, uint8_t txadd, uint8_t ext_adv,
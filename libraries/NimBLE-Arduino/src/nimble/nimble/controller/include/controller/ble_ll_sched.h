@@ -94,6 +94,8 @@ typedef int (* ble_ll_sched_preempt_cb_t)(struct ble_ll_sched_item *sch,
  *  enqueued: Flag denoting if item is on the scheduler list. 0: no, 1:yes
  *  remainder: # of usecs from offset till tx/rx should occur
  *  txrx_offset: Number of ticks from start time until tx/rx should occur.
+ *  index_levels: # of index levels above the list the item is linked into
+ *  index_next: Next item on each index level
  *
  */
 struct ble_ll_sched_item
@@ -104,11 +106,17 @@ struct ble_ll_sched_item
 #endif
     uint8_t         enqueued;
     uint8_t         remainder;
+#if MYNEWT_VAL(BLE_LL_SCHED_INDEX_LEVELS)
+    uint8_t         index_levels;
+#endif
     uint32_t        start_time;
     uint32_t        end_time;
     void            *cb_arg;
     sched_cb_func   sched_cb;
     TAILQ_ENTRY(ble_ll_sched_item) link;
+#if MYNEWT_VAL(BLE_LL_SCHED_INDEX_LEVELS)
+    struct ble_ll_sched_item *index_next[MYNEWT_VAL(BLE_LL_SCHED_INDEX_LEVELS)];
+#endif
 };
 
 /* Initialize the scheduler */
@@ -21,6 +21,7 @@
 #define H_BLE_LL_TRACE_
 
 #include "nimble/porting/nimble/include/os/os_trace_api.h"
+#include "nimble/porting/nimble/include/os/os_trace_ring.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -40,6 +41,7 @@ extern "C" {
 #define BLE_LL_TRACE_ID_ADV_HALT                11
 #define BLE_LL_TRACE_ID_AUX_REF                 12
 #define BLE_LL_TRACE_ID_AUX_UNREF               13
+#define BLE_LL_TRACE_ID_SCHED_INSERT            14
 
 #if MYNEWT_VAL(BLE_LL_SYSVIEW)
 
@@ -47,24 +49,6 @@ extern uint32_t ble_ll_trace_off;
 
 void ble_ll_trace_init(void);
 
-static inline void
-ble_ll_trace_u32(unsigned id, uint32_t p1)
-{
-    os_trace_api_u32(ble_ll_trace_off + id, p1);
-}
-
-static inline void
-ble_ll_trace_u32x2(unsigned id, uint32_t p1, uint32_t p2)
-{
-    os_trace_api_u32x2(ble_ll_trace_off + id, p1, p2);
-}
-
-static inline void
-ble_ll_trace_u32x3(unsigned id, uint32_t p1, uint32_t p2, uint32_t p3)
-{
-    os_trace_api_u32x3(ble_ll_trace_off + id, p1, p2, p3);
-}
-
 #else
 
 static inline void
@@ -72,22 +56,35 @@ ble_ll_trace_init(void)
 {
 }
 
+#endif
+
+/* Records also go to the trace ring, with p1 truncated to arg0 */
 static inline void
 ble_ll_trace_u32(unsigned id, uint32_t p1)
 {
+#if MYNEWT_VAL(BLE_LL_SYSVIEW)
+    os_trace_api_u32(ble_ll_trace_off + id, p1);
+#endif
+    os_trace_ring_rec(OS_TRACE_RING_ID_LL + id, p1, 0, 0);
 }
 
 static inline void
 ble_ll_trace_u32x2(unsigned id, uint32_t p1, uint32_t p2)
 {
+#if MYNEWT_VAL(BLE_LL_SYSVIEW)
+    os_trace_api_u32x2(ble_ll_trace_off + id, p1, p2);
+#endif
+    os_trace_ring_rec(OS_TRACE_RING_ID_LL + id, p1, p2, 0);
 }
 
 static inline void
 ble_ll_trace_u32x3(unsigned id, uint32_t p1, uint32_t p2, uint32_t p3)
 {
-}
-
+#if MYNEWT_VAL(BLE_LL_SYSVIEW)
+    os_trace_api_u32x3(ble_ll_trace_off + id, p1, p2, p3);
 #endif
+    os_trace_ring_rec(OS_TRACE_RING_ID_LL + id, p1, p2, p3);
+}
 
 #ifdef __cplusplus
 }
@@ -330,6 +330,38 @@ ble_ll_hci_vs_set_antenna(uint16_t ocf, const uint8_t *cmdbuf, uint8_t cmdlen,
 }
 #endif
 
+#if MYNEWT_VAL(BLE_LL_ROLE_OBSERVER)
+static int
+ble_ll_hci_vs_rd_scan_dup_stats(uint16_t ocf, const uint8_t *cmdbuf,
+                                uint8_t cmdlen, uint8_t *rspbuf,
+                                uint8_t *rsplen)
+{
+    const struct ble_hci_vs_rd_scan_dup_stats_cp *cmd = (const void *)cmdbuf;
+    struct ble_hci_vs_rd_scan_dup_stats_rp *rsp = (void *)rspbuf;
+    struct ble_ll_scan_dup_stats stats;
+    uint16_t cnt;
+
+    if (cmdlen != sizeof(*cmd)) {
+        return BLE_ERR_INV_HCI_CMD_PARMS;
+    }
+
+    if (cmd->clear > 1) {
+        return BLE_ERR_INV_HCI_CMD_PARMS;
+    }
+
+    cnt = ble_ll_scan_dup_stats_read(&stats, cmd->clear);
+
+    rsp->hits = htole32(stats.hits);
+    rsp->misses = htole32(stats.misses);
+    rsp->evictions = htole32(stats.evictions);
+    rsp->capacity = htole16(MYNEWT_VAL(BLE_LL_NUM_SCAN_DUP_ADVS));
+    rsp->count = htole16(cnt);
+    *rsplen = sizeof(*rsp);
+
+    return BLE_ERR_SUCCESS;
+}
+#endif
+
 static struct ble_ll_hci_vs_cmd g_ble_ll_hci_vs_cmds[] = {
     BLE_LL_HCI_VS_CMD(BLE_HCI_OCF_VS_RD_STATIC_ADDR,
                       ble_ll_hci_vs_rd_static_addr),
@@ -356,6 +388,10 @@ static struct ble_ll_hci_vs_cmd g_ble_ll_hci_vs_cmds[] = {
 #if MYNEWT_VAL(BLE_FEM_ANTENNA)
     BLE_LL_HCI_VS_CMD(BLE_HCI_OCF_VS_SET_ANTENNA, ble_ll_hci_vs_set_antenna),
 #endif
+#if MYNEWT_VAL(BLE_LL_ROLE_OBSERVER)
+    BLE_LL_HCI_VS_CMD(BLE_HCI_OCF_VS_RD_SCAN_DUP_STATS,
+                      ble_ll_hci_vs_rd_scan_dup_stats),
+#endif
 };
 
 static struct ble_ll_hci_vs_cmd *
@@ -44,12 +44,123 @@ struct ble_ll_resolv_data
     uint8_t rl_cnt;
     ble_npl_time_t rpa_tmo;
     struct ble_npl_callout rpa_timer;
+#if MYNEWT_VAL(BLE_LL_RESOLV_RPA_CACHE_SIZE)
+    uint8_t rpa_cache_cnt;
+    uint8_t rpa_cache_next;
+#endif
 };
 struct ble_ll_resolv_data g_ble_ll_resolv_data;
 
 __attribute__((aligned(4)))
 struct ble_ll_resolv_entry g_ble_ll_resolv_list[MYNEWT_VAL(BLE_LL_RESOLV_LIST_SIZE)];
 
+#if MYNEWT_VAL(BLE_LL_RESOLV_RPA_CACHE_SIZE)
+/*
+ * A recently resolved RPA.
+ *      rc_idx is the index of the resolving list entry whose IRK resolves
+ *      the RPA. A peer RPA with rc_idx -1 did not resolve with any peer IRK.
+ *      rc_local selects the local or the peer IRK of the entry.
+ */
+struct ble_ll_resolv_rpa_cache_entry
+{
+    uint8_t rc_rpa[BLE_DEV_ADDR_LEN];
+    int8_t rc_idx;
+    uint8_t rc_local;
+};
+
+static struct ble_ll_resolv_rpa_cache_entry
+    g_ble_ll_resolv_rpa_cache[MYNEWT_VAL(BLE_LL_RESOLV_RPA_CACHE_SIZE)];
+#endif
+
+/**
+ * Called to forget all resolved RPAs. Must be called whenever an entry is
+ * added to or removed from the resolving list (this changes the IRKs and
+ * the indices) and when the RPA timeout expires.
+ */
+static void
+ble_ll_resolv_rpa_cache_flush(void)
+{
+#if MYNEWT_VAL(BLE_LL_RESOLV_RPA_CACHE_SIZE)
+    os_sr_t sr;
+
+    OS_ENTER_CRITICAL(sr);
+    g_ble_ll_resolv_data.rpa_cache_cnt = 0;
+    g_ble_ll_resolv_data.rpa_cache_next = 0;
+    OS_EXIT_CRITICAL(sr);
+#endif
+}
+
+#if MYNEWT_VAL(BLE_LL_RESOLV_RPA_CACHE_SIZE)
+/**
+ * Looks up an RPA in the cache. A peer RPA is found regardless of the index,
+ * a local RPA only together with the index of the entry whose local IRK
+ * resolved it (the same local IRK may be used by many entries).
+ *
+ * @param rpa
+ * @param index     Index on RL, only used for local RPAs
+ * @param local
+ * @param rl_idx    Index on RL which resolves the RPA, -1 if none
+ *
+ * @return int 1: RPA found in cache. 0: not found.
+ */
+static int
+ble_ll_resolv_rpa_cache_find(const uint8_t *rpa, int index, int local,
+                             int *rl_idx)
+{
+    int i;
+    int rc;
+    os_sr_t sr;
+    struct ble_ll_resolv_rpa_cache_entry *rc_entry;
+
+    rc = 0;
+    OS_ENTER_CRITICAL(sr);
+    rc_entry = &g_ble_ll_resolv_rpa_cache[0];
+    for (i = 0; i < g_ble_ll_resolv_data.rpa_cache_cnt; ++i) {
+        if ((rc_entry->rc_local == local) &&
+            (!local || (rc_entry->rc_idx == index)) &&
+            (!memcmp(rc_entry->rc_rpa, rpa, BLE_DEV_ADDR_LEN))) {
+            *rl_idx = rc_entry->rc_idx;
+            rc = 1;
+            break;
+        }
+        ++rc_entry;
+    }
+    OS_EXIT_CRITICAL(sr);
+
+    return rc;
+}
+
+/**
+ * Adds an RPA to the cache, replacing the oldest entry if the cache is full.
+ *
+ * @param rpa
+ * @param rl_idx    Index on RL which resolves the RPA, -1 if none
+ * @param local
+ */
+static void
+ble_ll_resolv_rpa_cache_add(const uint8_t *rpa, int rl_idx, int local)
+{
+    os_sr_t sr;
+    struct ble_ll_resolv_rpa_cache_entry *rc_entry;
+
+    OS_ENTER_CRITICAL(sr);
+    rc_entry = &g_ble_ll_resolv_rpa_cache[g_ble_ll_resolv_data.rpa_cache_next];
+    memcpy(rc_entry->rc_rpa, rpa, BLE_DEV_ADDR_LEN);
+    rc_entry->rc_idx = rl_idx;
+    rc_entry->rc_local = local;
+
+    if (++g_ble_ll_resolv_data.rpa_cache_next ==
+        MYNEWT_VAL(BLE_LL_RESOLV_RPA_CACHE_SIZE)) {
+        g_ble_ll_resolv_data.rpa_cache_next = 0;
+    }
+    if (g_ble_ll_resolv_data.rpa_cache_cnt <
+        MYNEWT_VAL(BLE_LL_RESOLV_RPA_CACHE_SIZE)) {
+        g_ble_ll_resolv_data.rpa_cache_cnt++;
+    }
+    OS_EXIT_CRITICAL(sr);
+}
+#endif
+
 /**
  * Called to determine if a change is allowed to the resolving list at this
  * time. We are not allowed to modify the resolving list if address translation
@@ -143,6 +254,8 @@ ble_ll_resolv_rpa_timer_cb(struct ble_npl_event *ev)
         ++rl;
     }
 
+    ble_ll_resolv_rpa_cache_flush();
+
     ble_npl_callout_reset(&g_ble_ll_resolv_data.rpa_timer,
                           g_ble_ll_resolv_data.rpa_tmo);
 
@@ -193,6 +306,7 @@ ble_ll_resolv_list_clr(void)
     g_ble_ll_resolv_data.rl_cnt_hw = 0;
     g_ble_ll_resolv_data.rl_cnt = 0;
     ble_hw_resolv_list_clear();
+    ble_ll_resolv_rpa_cache_flush();
 
     /* stop RPA timer when clearing RL */
     ble_npl_callout_stop(&g_ble_ll_resolv_data.rpa_timer);
@@ -354,6 +468,7 @@ ble_ll_resolv_list_add(const uint8_t *cmdbuf, uint8_t len)
     }
 
     g_ble_ll_resolv_data.rl_cnt++;
+    ble_ll_resolv_rpa_cache_flush();
 
     /* start RPA timer if this was first element added to RL */
     if (g_ble_ll_resolv_data.rl_cnt == 1) {
@@ -403,6 +518,8 @@ ble_ll_resolv_list_rmv(const uint8_t *cmdbuf, uint8_t len)
             g_ble_ll_resolv_data.rl_cnt_hw--;
         }
 
+        ble_ll_resolv_rpa_cache_flush();
+
         /* stop RPA timer if list is empty */
         if (g_ble_ll_resolv_data.rl_cnt == 0) {
             ble_npl_callout_stop(&g_ble_ll_resolv_data.rpa_timer);
@@ -685,18 +802,74 @@ ble_ll_resolv_rpa(const uint8_t *rpa, const uint8_t *irk)
     return rc;
 }
 
+/**
+ * Resolve a Resolvable Private Address with the local or peer IRK of an
+ * entry on the resolving list. Recently resolved RPAs are taken from the
+ * cache without running the AES.
+ *
+ * @param rpa
+ * @param index Index on RL
+ * @param local
+ *
+ * @return int 1: RPA resolves with the IRK. 0: it does not.
+ */
+int
+ble_ll_resolv_rpa_rl(const uint8_t *rpa, int index, int local)
+{
+    struct ble_ll_resolv_entry *rl;
+    int rc;
+#if MYNEWT_VAL(BLE_LL_RESOLV_RPA_CACHE_SIZE)
+    int rl_idx;
+
+    if (ble_ll_resolv_rpa_cache_find(rpa, index, local, &rl_idx)) {
+        return rl_idx == index;
+    }
+#endif
+
+    rl = &g_ble_ll_resolv_list[index];
+    rc = ble_ll_resolv_rpa(rpa, local ? rl->rl_local_irk : rl->rl_peer_irk);
+
+#if MYNEWT_VAL(BLE_LL_RESOLV_RPA_CACHE_SIZE)
+    /* A peer RPA which does not resolve with this IRK may still resolve
+     * with another one, so only a match can be cached.
+     */
+    if (rc) {
+        ble_ll_resolv_rpa_cache_add(rpa, index, local);
+    }
+#endif
+
+    return rc;
+}
+
 int
 ble_ll_resolv_peer_rpa_any(const uint8_t *rpa)
 {
     int i;
 
+#if MYNEWT_VAL(BLE_LL_RESOLV_RPA_CACHE_SIZE)
+    if (ble_ll_resolv_rpa_cache_find(rpa, -1, 0, &i)) {
+        return i;
+    }
+#endif
+
     for (i = 0; i < g_ble_ll_resolv_data.rl_cnt_hw; i++) {
         if (ble_ll_resolv_rpa(rpa, g_ble_ll_resolv_list[i].rl_peer_irk)) {
-            return i;
+            break;
         }
     }
 
-    return -1;
+    if (i == g_ble_ll_resolv_data.rl_cnt_hw) {
+        i = -1;
+    }
+
+#if MYNEWT_VAL(BLE_LL_RESOLV_RPA_CACHE_SIZE)
+    /* Unresolved RPAs are cached as well, they are the common case when
+     * scanning in a crowded area.
+     */
+    ble_ll_resolv_rpa_cache_add(rpa, i, 0);
+#endif
+
+    return i;
 }
 
 /**
@@ -63,6 +63,11 @@
     #error "Cannot have more than 255 scan response entries!"
 #endif
 
+/* Duplicate filter entries are linked by 16-bit index */
+#if MYNEWT_VAL(BLE_LL_NUM_SCAN_DUP_ADVS) > 65534
+    #error "Cannot have more than 65534 duplicate filter entries!"
+#endif
+
 #if MYNEWT_VAL(BLE_LL_CFG_FEAT_LE_CODED_PHY)
 #define SCAN_VALID_PHY_MASK     (BLE_HCI_LE_PHY_1M_PREF_MASK | BLE_HCI_LE_PHY_CODED_PREF_MASK)
 #else
@@ -114,6 +119,11 @@ g_ble_ll_scan_rsp_advs[MYNEWT_VAL(BLE_LL_NUM_SCAN_RSP_ADVS)];
 #define BLE_LL_SCAN_DUP_F_ADV_REPORT_SENT       (0x01)
 #define BLE_LL_SCAN_DUP_F_DIR_ADV_REPORT_SENT   (0x02)
 #define BLE_LL_SCAN_DUP_F_SCAN_RSP_SENT         (0x04)
+#define BLE_LL_SCAN_DUP_F_REFERENCED            (0x80)
+
+#define BLE_LL_SCAN_DUP_IDX_NONE                (0xffff)
+/* Odd number of buckets, never 0 */
+#define BLE_LL_SCAN_DUP_HASH_SIZE   (MYNEWT_VAL(BLE_LL_NUM_SCAN_DUP_ADVS) | 1)
 
 struct ble_ll_scan_dup_entry {
     uint8_t type;       /* entry type, see BLE_LL_SCAN_ENTRY_TYPE_* */
@@ -122,14 +132,33 @@ struct ble_ll_scan_dup_entry {
 #if MYNEWT_VAL(BLE_LL_CFG_FEAT_LL_EXT_ADV)
     uint16_t adi;
 #endif
-    TAILQ_ENTRY(ble_ll_scan_dup_entry) link;
+    uint16_t next;      /* next entry in the same hash bucket */
 };
 
-static os_membuf_t g_scan_dup_mem[ OS_MEMPOOL_SIZE(
-                                   MYNEWT_VAL(BLE_LL_NUM_SCAN_DUP_ADVS),
-                                   sizeof(struct ble_ll_scan_dup_entry)) ];
-static struct os_mempool g_scan_dup_pool;
-static TAILQ_HEAD(ble_ll_scan_dup_list, ble_ll_scan_dup_entry) g_scan_dup_list;
+/*
+ * Duplicate filter entries are kept in a fixed table and linked into the hash
+ * bucket of their type and address. Anonymous advertisers have a zero address.
+ * When the table is full, a clock hand evicts the first entry which was not
+ * looked up again since the hand passed it the last time. New entries start
+ * unreferenced, so advertisers seen only once are evicted first.
+ */
+static struct ble_ll_scan_dup_entry
+    g_scan_dup_tbl[MYNEWT_VAL(BLE_LL_NUM_SCAN_DUP_ADVS)];
+static uint16_t g_scan_dup_hash[BLE_LL_SCAN_DUP_HASH_SIZE];
+static uint16_t g_scan_dup_cnt;
+static uint16_t g_scan_dup_hand;
+/* Entry matched or added by the last duplicate check */
+static struct ble_ll_scan_dup_entry *g_scan_dup_last;
+static struct ble_ll_scan_dup_stats g_scan_dup_stats;
+
+static void
+ble_ll_scan_dup_clear(void)
+{
+    memset(g_scan_dup_hash, 0xff, sizeof(g_scan_dup_hash));
+    g_scan_dup_cnt = 0;
+    g_scan_dup_hand = 0;
+    g_scan_dup_last = NULL;
+}
 
 #if MYNEWT_VAL(BLE_LL_CFG_FEAT_LL_EXT_ADV)
 static int
@@ -624,10 +653,10 @@ ble_ll_scan_dup_update_legacy(uint8_t addr_type, const uint8_t *addr,
 
     /*
      * We assume ble_ll_scan_dup_check() was called before which either matched
-     * some entry or allocated new one and placed in on the top of queue.
+     * some entry or allocated new one.
      */
 
-    e = TAILQ_FIRST(&g_scan_dup_list);
+    e = g_scan_dup_last;
     BLE_LL_ASSERT(e && e->type == type && !memcmp(e->addr, addr, 6));
 
     if (subev == BLE_HCI_LE_SUBEV_DIRECT_ADV_RPT) {
@@ -960,8 +989,7 @@ ble_ll_scan_sm_start(struct ble_ll_scan_sm *scansm)
     /* Forget filtered advertisers from previous scan. */
     g_ble_ll_scan_num_rsp_advs = 0;
 
-    os_mempool_clear(&g_scan_dup_pool);
-    TAILQ_INIT(&g_scan_dup_list);
+    ble_ll_scan_dup_clear();
 
     /*
      * First scan window can start when RF is enabled. Add 1 tick since we are
@@ -1327,7 +1355,8 @@ ble_ll_scan_rx_filter(uint8_t own_addr_type, uint8_t scan_filt_policy,
         switch (ble_ll_addr_subtype(addrd->targeta, addrd->targeta_type)) {
         case BLE_LL_ADDR_SUBTYPE_RPA:
             /* Check if TargetA can be resolved using the same RL entry as AdvA */
-            if (rl && ble_ll_resolv_rpa(addrd->targeta, rl->rl_local_irk)) {
+            if (rl && ble_ll_resolv_rpa_rl(addrd->targeta,
+                                           ble_ll_resolv_get_idx(rl), 1)) {
                 addrd->targeta_resolved = 1;
                 break;
             }
@@ -1757,27 +1786,81 @@ ble_ll_scan_wfr_timer_exp(void)
     ble_phy_restart_rx();
 }
 
-static inline void
-ble_ll_scan_dup_move_to_head(struct ble_ll_scan_dup_entry *e)
+static inline uint16_t
+ble_ll_scan_dup_hash(uint8_t type, const uint8_t *addr)
 {
-    if (e != TAILQ_FIRST(&g_scan_dup_list)) {
-        TAILQ_REMOVE(&g_scan_dup_list, e, link);
-        TAILQ_INSERT_HEAD(&g_scan_dup_list, e, link);
+    uint32_t h;
+    int i;
+
+    h = type;
+    for (i = 0; i < BLE_DEV_ADDR_LEN; i++) {
+        h = (h * 31) + addr[i];
     }
+
+    return h % BLE_LL_SCAN_DUP_HASH_SIZE;
 }
 
-static inline struct ble_ll_scan_dup_entry *
-ble_ll_scan_dup_new(void)
+static struct ble_ll_scan_dup_entry *
+ble_ll_scan_dup_find(uint8_t type, const uint8_t *addr, uint16_t bucket)
 {
     struct ble_ll_scan_dup_entry *e;
+    uint16_t idx;
+
+    idx = g_scan_dup_hash[bucket];
+    while (idx != BLE_LL_SCAN_DUP_IDX_NONE) {
+        e = &g_scan_dup_tbl[idx];
+        if ((e->type == type) && !memcmp(e->addr, addr, BLE_DEV_ADDR_LEN)) {
+            g_scan_dup_stats.hits++;
+            e->flags |= BLE_LL_SCAN_DUP_F_REFERENCED;
+            return e;
+        }
+        idx = e->next;
+    }
 
-    e = os_memblock_get(&g_scan_dup_pool);
-    if (!e) {
-        e = TAILQ_LAST(&g_scan_dup_list, ble_ll_scan_dup_list);
-        TAILQ_REMOVE(&g_scan_dup_list, e, link);
+    return NULL;
+}
+
+static struct ble_ll_scan_dup_entry *
+ble_ll_scan_dup_new(uint16_t bucket)
+{
+    struct ble_ll_scan_dup_entry *e;
+    uint16_t *prev;
+    uint16_t idx;
+
+    if (g_scan_dup_cnt < MYNEWT_VAL(BLE_LL_NUM_SCAN_DUP_ADVS)) {
+        idx = g_scan_dup_cnt++;
+    } else {
+        /* Give entries which were looked up again another round */
+        e = &g_scan_dup_tbl[g_scan_dup_hand];
+        while (e->flags & BLE_LL_SCAN_DUP_F_REFERENCED) {
+            e->flags &= ~BLE_LL_SCAN_DUP_F_REFERENCED;
+            if (++g_scan_dup_hand == MYNEWT_VAL(BLE_LL_NUM_SCAN_DUP_ADVS)) {
+                g_scan_dup_hand = 0;
+            }
+            e = &g_scan_dup_tbl[g_scan_dup_hand];
+        }
+
+        idx = g_scan_dup_hand;
+        if (++g_scan_dup_hand == MYNEWT_VAL(BLE_LL_NUM_SCAN_DUP_ADVS)) {
+            g_scan_dup_hand = 0;
+        }
+
+        /* Unlink evicted entry from its bucket */
+        prev = &g_scan_dup_hash[ble_ll_scan_dup_hash(e->type, e->addr)];
+        while (*prev != idx) {
+            prev = &g_scan_dup_tbl[*prev].next;
+        }
+        *prev = e->next;
+
+        g_scan_dup_stats.evictions++;
     }
 
+    g_scan_dup_stats.misses++;
+
+    e = &g_scan_dup_tbl[idx];
     memset(e, 0, sizeof(*e));
+    e->next = g_scan_dup_hash[bucket];
+    g_scan_dup_hash[bucket] = idx;
 
     return e;
 }
@@ -1786,17 +1869,14 @@ static int
 ble_ll_scan_dup_check_legacy(uint8_t addr_type, uint8_t *addr, uint8_t pdu_type)
 {
     struct ble_ll_scan_dup_entry *e;
+    uint16_t bucket;
     uint8_t type;
     int rc;
 
     type = BLE_LL_SCAN_ENTRY_TYPE_LEGACY(addr_type);
+    bucket = ble_ll_scan_dup_hash(type, addr);
 
-    TAILQ_FOREACH(e, &g_scan_dup_list, link) {
-        if ((e->type == type) && !memcmp(e->addr, addr, 6)) {
-            break;
-        }
-    }
-
+    e = ble_ll_scan_dup_find(type, addr, bucket);
     if (e) {
         if (pdu_type == BLE_ADV_PDU_TYPE_ADV_DIRECT_IND) {
             rc = e->flags & BLE_LL_SCAN_DUP_F_DIR_ADV_REPORT_SENT;
@@ -1805,19 +1885,16 @@ ble_ll_scan_dup_check_legacy(uint8_t addr_type, uint8_t *addr, uint8_t pdu_type)
         } else {
             rc = e->flags & BLE_LL_SCAN_DUP_F_ADV_REPORT_SENT;
         }
-
-        ble_ll_scan_dup_move_to_head(e);
     } else {
         rc = 0;
 
-        e = ble_ll_scan_dup_new();
-        e->flags = 0;
+        e = ble_ll_scan_dup_new(bucket);
         e->type = type;
         memcpy(e->addr, addr, 6);
-
-        TAILQ_INSERT_HEAD(&g_scan_dup_list, e, link);
     }
 
+    g_scan_dup_last = e;
+
     return rc;
 }
 
@@ -1826,7 +1903,9 @@ int
 ble_ll_scan_dup_check_ext(uint8_t addr_type, uint8_t *addr, bool has_aux,
                           uint16_t adi)
 {
+    static const uint8_t anon_addr[BLE_DEV_ADDR_LEN];
     struct ble_ll_scan_dup_entry *e;
+    uint16_t bucket;
     bool is_anon;
     uint8_t type;
     int rc;
@@ -1835,39 +1914,32 @@ ble_ll_scan_dup_check_ext(uint8_t addr_type, uint8_t *addr, bool has_aux,
     adi = has_aux ? adi : 0;
 
     type = BLE_LL_SCAN_ENTRY_TYPE_EXT(addr_type, has_aux, is_anon, adi);
-
-    TAILQ_FOREACH(e, &g_scan_dup_list, link) {
-        if ((e->type == type) &&
-            (is_anon || !memcmp(e->addr, addr, BLE_DEV_ADDR_LEN))) {
-            break;
-        }
+    if (is_anon) {
+        addr = (uint8_t *)anon_addr;
     }
+    bucket = ble_ll_scan_dup_hash(type, addr);
 
+    e = ble_ll_scan_dup_find(type, addr, bucket);
     if (e) {
         if (e->adi != adi) {
             rc = 0;
 
-            e->flags = 0;
+            e->flags &= BLE_LL_SCAN_DUP_F_REFERENCED;
             e->adi = adi;
         } else {
             rc = e->flags & BLE_LL_SCAN_DUP_F_ADV_REPORT_SENT;
         }
-
-        ble_ll_scan_dup_move_to_head(e);
     } else {
         rc = 0;
 
-        e = ble_ll_scan_dup_new();
-        e->flags = 0;
+        e = ble_ll_scan_dup_new(bucket);
         e->type = type;
         e->adi = adi;
-        if (!is_anon) {
-            memcpy(e->addr, addr, 6);
-        }
-
-        TAILQ_INSERT_HEAD(&g_scan_dup_list, e, link);
+        memcpy(e->addr, addr, 6);
     }
 
+    g_scan_dup_last = e;
+
     return rc;
 }
 
@@ -1886,10 +1958,10 @@ ble_ll_scan_dup_update_ext(uint8_t addr_type, uint8_t *addr, bool has_aux,
 
     /*
      * We assume ble_ll_scan_dup_check() was called before which either matched
-     * some entry or allocated new one and placed in on the top of queue.
+     * some entry or allocated new one.
      */
 
-    e = TAILQ_FIRST(&g_scan_dup_list);
+    e = g_scan_dup_last;
     BLE_LL_ASSERT(e && e->type == type && (is_anon || !memcmp(e->addr, addr, 6)));
 
     e->flags |= BLE_LL_SCAN_DUP_F_ADV_REPORT_SENT;
@@ -1898,6 +1970,31 @@ ble_ll_scan_dup_update_ext(uint8_t addr_type, uint8_t *addr, bool has_aux,
 }
 #endif
 
+/**
+ * Read the duplicate filter statistics.
+ *
+ * @param stats Filled with the statistics
+ * @param clear Restart the statistics after reading
+ *
+ * @return uint16_t Number of advertisers in the filter
+ */
+uint16_t
+ble_ll_scan_dup_stats_read(struct ble_ll_scan_dup_stats *stats, int clear)
+{
+    os_sr_t sr;
+    uint16_t cnt;
+
+    OS_ENTER_CRITICAL(sr);
+    *stats = g_scan_dup_stats;
+    if (clear) {
+        memset(&g_scan_dup_stats, 0, sizeof(g_scan_dup_stats));
+    }
+    cnt = g_scan_dup_cnt;
+    OS_EXIT_CRITICAL(sr);
+
+    return cnt;
+}
+
 static void
 ble_ll_scan_rx_pkt_in_restore_addr_data(struct ble_mbuf_hdr *hdr,
                                         struct ble_ll_scan_addr_data *addrd)
@@ -2741,8 +2838,7 @@ ble_ll_scan_reset(void)
     g_ble_ll_scan_num_rsp_advs = 0;
     memset(&g_ble_ll_scan_rsp_advs[0], 0, sizeof(g_ble_ll_scan_rsp_advs));
 
-    os_mempool_clear(&g_scan_dup_pool);
-    TAILQ_INIT(&g_scan_dup_list);
+    ble_ll_scan_dup_clear();
 
     /* Call the common init function again */
     ble_ll_scan_common_init();
@@ -2760,16 +2856,7 @@ ble_ll_scan_reset(void)
 void
 ble_ll_scan_init(void)
 {
-    os_error_t err;
-
-    err = os_mempool_init(&g_scan_dup_pool,
-                          MYNEWT_VAL(BLE_LL_NUM_SCAN_DUP_ADVS),
-                          sizeof(struct ble_ll_scan_dup_entry),
-                          g_scan_dup_mem,
-                          "ble_ll_scan_dup_pool");
-    BLE_LL_ASSERT(err == 0);
-
-    TAILQ_INIT(&g_scan_dup_list);
+    ble_ll_scan_dup_clear();
 
     ble_ll_scan_common_init();
 #if MYNEWT_VAL(BLE_LL_CFG_FEAT_LL_EXT_ADV)
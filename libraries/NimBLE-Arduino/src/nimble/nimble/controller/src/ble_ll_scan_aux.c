@@ -1548,7 +1548,7 @@ ble_ll_scan_aux_check_connect_rsp(uint8_t *rxbuf,
         rl = &g_ble_ll_resolv_list[addrd->rpa_index];
 
         if (rl->rl_has_peer) {
-            if (!ble_ll_resolv_rpa(adva, rl->rl_peer_irk)) {
+            if (!ble_ll_resolv_rpa_rl(adva, addrd->rpa_index, 0)) {
                 return -1;
             }
 
@@ -89,6 +89,167 @@ static struct ble_ll_sched_css g_ble_ll_sched_css = {
 static TAILQ_HEAD(ll_sched_qhead, ble_ll_sched_item) g_ble_ll_sched_q;
 static uint8_t g_ble_ll_sched_q_head_changed;
 
+/*
+ * Index over the schedule queue (skip list). Items on the queue are sorted and
+ * do not overlap, so both start and end times increase along the queue. Each
+ * item is also linked into the lowest index_levels levels of the index, with
+ * 1/4 of the items of a level being on the level above. This allows to find the
+ * place of an item without walking all the items scheduled before it.
+ *
+ * With short queues the plain walk is faster, keeping the index up to date
+ * costs more than it saves. The index is enabled by default only with more
+ * than 32 connections, see extras/host/sched_test.c.
+ */
+#define BLE_LL_SCHED_INDEX_LEVELS   MYNEWT_VAL(BLE_LL_SCHED_INDEX_LEVELS)
+
+#if BLE_LL_SCHED_INDEX_LEVELS
+static struct ble_ll_sched_item *g_ble_ll_sched_index[BLE_LL_SCHED_INDEX_LEVELS];
+static uint32_t g_ble_ll_sched_index_seed = 0x2545f491;
+
+static uint8_t
+ble_ll_sched_index_levels(void)
+{
+    uint32_t r;
+    uint8_t levels;
+
+    /* xorshift32, no need for ble_ll_rand() here */
+    r = g_ble_ll_sched_index_seed;
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    g_ble_ll_sched_index_seed = r;
+
+    levels = 0;
+    while (((r & 3) == 0) && (levels < BLE_LL_SCHED_INDEX_LEVELS)) {
+        levels++;
+        r >>= 2;
+    }
+
+    return levels;
+}
+
+static inline struct ble_ll_sched_item *
+ble_ll_sched_index_next(struct ble_ll_sched_item *item, int level)
+{
+    return item ? item->index_next[level] : g_ble_ll_sched_index[level];
+}
+
+/*
+ * Finds the first item on the queue which ends after the given time and sets
+ * pred to the last item ending no later than that time on each index level
+ * (NULL if there is none).
+ */
+static struct ble_ll_sched_item *
+ble_ll_sched_index_find(uint32_t time, struct ble_ll_sched_item **pred)
+{
+    struct ble_ll_sched_item *item;
+    struct ble_ll_sched_item *next;
+    int level;
+
+    item = NULL;
+    for (level = BLE_LL_SCHED_INDEX_LEVELS - 1; level >= 0; level--) {
+        next = ble_ll_sched_index_next(item, level);
+        while (next && LL_TMR_LEQ(next->end_time, time)) {
+            item = next;
+            next = next->index_next[level];
+        }
+        pred[level] = item;
+    }
+
+    next = item ? TAILQ_NEXT(item, link) : TAILQ_FIRST(&g_ble_ll_sched_q);
+    while (next && LL_TMR_LEQ(next->end_time, time)) {
+        next = TAILQ_NEXT(next, link);
+    }
+
+    return next;
+}
+
+/* Item is on the queue before the item being inserted */
+static inline void
+ble_ll_sched_index_pass(struct ble_ll_sched_item *item,
+                        struct ble_ll_sched_item **pred)
+{
+    int level;
+
+    for (level = 0; level < item->index_levels; level++) {
+        pred[level] = item;
+    }
+}
+
+static void
+ble_ll_sched_index_link(struct ble_ll_sched_item *sch,
+                        struct ble_ll_sched_item **pred)
+{
+    int level;
+
+    sch->index_levels = ble_ll_sched_index_levels();
+    for (level = 0; level < sch->index_levels; level++) {
+        sch->index_next[level] = ble_ll_sched_index_next(pred[level], level);
+        if (pred[level]) {
+            pred[level]->index_next[level] = sch;
+        } else {
+            g_ble_ll_sched_index[level] = sch;
+        }
+    }
+}
+
+static void
+ble_ll_sched_index_unlink(struct ble_ll_sched_item *sch)
+{
+    struct ble_ll_sched_item *item;
+    struct ble_ll_sched_item *next;
+    int level;
+
+    /* Most items are removed from the head of the queue */
+    if (sch == TAILQ_FIRST(&g_ble_ll_sched_q)) {
+        for (level = 0; level < sch->index_levels; level++) {
+            g_ble_ll_sched_index[level] = sch->index_next[level];
+        }
+        sch->index_levels = 0;
+        return;
+    }
+
+    item = NULL;
+    for (level = BLE_LL_SCHED_INDEX_LEVELS - 1; level >= 0; level--) {
+        next = ble_ll_sched_index_next(item, level);
+        while (next && LL_TMR_LT(next->start_time, sch->start_time)) {
+            item = next;
+            next = next->index_next[level];
+        }
+
+        if (level >= sch->index_levels) {
+            continue;
+        }
+
+        /* Zero length items may start at the same time */
+        while (next != sch) {
+            BLE_LL_ASSERT(next);
+            item = next;
+            next = next->index_next[level];
+        }
+
+        if (item) {
+            item->index_next[level] = sch->index_next[level];
+        } else {
+            g_ble_ll_sched_index[level] = sch->index_next[level];
+        }
+    }
+
+    sch->index_levels = 0;
+}
+#endif
+
+/* Removes item from the queue */
+static inline void
+ble_ll_sched_q_remove(struct ble_ll_sched_item *sch)
+{
+#if BLE_LL_SCHED_INDEX_LEVELS
+    ble_ll_sched_index_unlink(sch);
+#endif
+    TAILQ_REMOVE(&g_ble_ll_sched_q, sch, link);
+    sch->enqueued = 0;
+}
+
 static int
 preempt_any(struct ble_ll_sched_item *sch,
             struct ble_ll_sched_item *item)
@@ -142,8 +303,7 @@ ble_ll_sched_preempt(struct ble_ll_sched_item *sch,
     do {
         next = TAILQ_NEXT(entry, link);
 
-        TAILQ_REMOVE(&g_ble_ll_sched_q, entry, link);
-        entry->enqueued = 0;
+        ble_ll_sched_q_remove(entry);
 
         switch (entry->sched_type) {
 #if MYNEWT_VAL(BLE_LL_ROLE_CENTRAL) || MYNEWT_VAL(BLE_LL_ROLE_PERIPHERAL)
@@ -231,8 +391,10 @@ ble_ll_sched_insert(struct ble_ll_sched_item *sch, uint32_t max_delay,
                     ble_ll_sched_preempt_cb_t preempt_cb)
 {
     struct ble_ll_sched_item *preempt_first;
-    struct ble_ll_sched_item *first;
     struct ble_ll_sched_item *entry;
+#if BLE_LL_SCHED_INDEX_LEVELS
+    struct ble_ll_sched_item *pred[BLE_LL_SCHED_INDEX_LEVELS];
+#endif
     uint32_t max_start_time;
     uint32_t duration;
 
@@ -243,18 +405,29 @@ ble_ll_sched_insert(struct ble_ll_sched_item *sch, uint32_t max_delay,
     max_start_time = sch->start_time + max_delay;
     duration = sch->end_time - sch->start_time;
 
-    first = TAILQ_FIRST(&g_ble_ll_sched_q);
-    if (!first) {
+    if (!TAILQ_FIRST(&g_ble_ll_sched_q)) {
         TAILQ_INSERT_HEAD(&g_ble_ll_sched_q, sch, link);
         sch->enqueued = 1;
+#if BLE_LL_SCHED_INDEX_LEVELS
+        memset(pred, 0, sizeof(pred));
+#endif
         goto done;
     }
 
-    TAILQ_FOREACH(entry, &g_ble_ll_sched_q, link) {
+    /* Items which end before our item starts can be skipped */
+#if BLE_LL_SCHED_INDEX_LEVELS
+    entry = ble_ll_sched_index_find(sch->start_time, pred);
+#else
+    entry = TAILQ_FIRST(&g_ble_ll_sched_q);
+    while (entry && LL_TMR_LEQ(entry->end_time, sch->start_time)) {
+        entry = TAILQ_NEXT(entry, link);
+    }
+#endif
+
+    for (; entry; entry = TAILQ_NEXT(entry, link)) {
         if (LL_TMR_LEQ(sch->end_time, entry->start_time)) {
             TAILQ_INSERT_BEFORE(entry, sch, link);
-            sch->enqueued = 1;
-            goto done;
+            break;
         }
 
         /* If current item overlaps our item check if we can preempt. If we
@@ -292,18 +465,35 @@ ble_ll_sched_insert(struct ble_ll_sched_item *sch, uint32_t max_delay,
                 sch->end_time = sch->start_time + duration;
             }
         }
+
+#if BLE_LL_SCHED_INDEX_LEVELS
+        ble_ll_sched_index_pass(entry, pred);
+#endif
     }
 
     if (!entry) {
         TAILQ_INSERT_TAIL(&g_ble_ll_sched_q, sch, link);
-        sch->enqueued = 1;
     }
 
+    sch->enqueued = 1;
+
 done:
     if (preempt_first) {
         BLE_LL_ASSERT(sch->enqueued);
         ble_ll_sched_preempt(sch, preempt_first);
+#if BLE_LL_SCHED_INDEX_LEVELS
+        /* Preempted items may start after our item, so it is added to the
+         * index only now and pred may point to removed items.
+         */
+        ble_ll_sched_index_find(sch->start_time, pred);
+#endif
+    }
+
+#if BLE_LL_SCHED_INDEX_LEVELS
+    if (sch->enqueued) {
+        ble_ll_sched_index_link(sch, pred);
     }
+#endif
 
     /* Pause scheduler if inserted as 1st item, we do not want to miss this
      * one. Caller should restart outside critical section.
@@ -313,6 +503,9 @@ done:
         ble_ll_sched_q_head_changed();
     }
 
+    ble_ll_trace_u32x3(BLE_LL_TRACE_ID_SCHED_INSERT, sch->sched_type,
+                       sch->start_time, sch->enqueued ? 0 : -1);
+
     return sch->enqueued ? 0 : -1;
 }
 
@@ -893,8 +1086,7 @@ ble_ll_sched_rmv_elem(struct ble_ll_sched_item *sch)
             first_removed = 1;
         }
 
-        TAILQ_REMOVE(&g_ble_ll_sched_q, sch, link);
-        sch->enqueued = 0;
+        ble_ll_sched_q_remove(sch);
 
         rc = 0;
     } else {
@@ -917,23 +1109,25 @@ ble_ll_sched_rmv_elem_type(uint8_t type, sched_remove_cb_func remove_cb)
 {
     struct ble_ll_sched_item *first;
     struct ble_ll_sched_item *entry;
+    struct ble_ll_sched_item *next;
     uint8_t first_removed;
     os_sr_t sr;
 
     OS_ENTER_CRITICAL(sr);
 
+    first_removed = 0;
     first = TAILQ_FIRST(&g_ble_ll_sched_q);
-    if (first->sched_type == type) {
+    if (first && (first->sched_type == type)) {
         first_removed = 1;
     }
 
-    TAILQ_FOREACH(entry, &g_ble_ll_sched_q, link) {
+    for (entry = first; entry; entry = next) {
+        next = TAILQ_NEXT(entry, link);
         if (entry->sched_type != type) {
             continue;
         }
-        TAILQ_REMOVE(&g_ble_ll_sched_q, entry, link);
+        ble_ll_sched_q_remove(entry);
         remove_cb(entry);
-        entry->enqueued = 0;
     }
 
     if (first_removed) {
@@ -1066,8 +1260,7 @@ ble_ll_sched_run(void *arg)
 #endif
 
         /* Remove schedule item and execute the callback */
-        TAILQ_REMOVE(&g_ble_ll_sched_q, sch, link);
-        sch->enqueued = 0;
+        ble_ll_sched_q_remove(sch);
         g_ble_ll_sched_q_head_changed = 1;
 
         ble_ll_sched_execute_item(sch);
@@ -44,13 +44,14 @@ ble_ll_trace_module_send_desc(void)
     os_trace_module_desc(&g_ble_ll_trace_mod, "11 ll_adv_halt inst=%u");
     os_trace_module_desc(&g_ble_ll_trace_mod, "12 ll_aux_ref aux=%p ref=%u");
     os_trace_module_desc(&g_ble_ll_trace_mod, "13 ll_aux_unref aux=%p ref=%u");
+    os_trace_module_desc(&g_ble_ll_trace_mod, "14 ll_sched_insert type=%u start_time=%u rc=%d");
 }
 
 void
 ble_ll_trace_init(void)
 {
     ble_ll_trace_off =
-            os_trace_module_register(&g_ble_ll_trace_mod, "ble_ll", 12,
+            os_trace_module_register(&g_ble_ll_trace_mod, "ble_ll", 15,
                                      ble_ll_trace_module_send_desc);
 }
 #endif
@@ -9,6 +9,7 @@
 #if MYNEWT_VAL(BLE_MESH)
 
 #include "crypto.h"
+#include "nimble/nimble/host/src/ble_aes_key_priv.h"
 #define MESH_LOG_MODULE BLE_MESH_LOG
 
 static inline void xor16(uint8_t *dst, const uint8_t *a, const uint8_t *b)
@@ -32,7 +33,7 @@ static inline void xor16(uint8_t *dst, const uint8_t *a, const uint8_t *b)
 }
 
 /* pmsg is assumed to have the nonce already present in bytes 1-13 */
-static int ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, uint8_t aad_len,
+static int ccm_calculate_X0(struct ble_aes_key *k, const uint8_t *aad, uint8_t aad_len,
 			    size_t mic_size, uint8_t msg_len, uint8_t b[16],
 			    uint8_t X0[16])
 {
@@ -43,7 +44,7 @@ static int ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, uint8_t a
 
 	sys_put_be16(msg_len, b + 14);
 
-	err = bt_encrypt_be(key, b, X0);
+	err = ble_aes_key_encrypt(k, b, X0);
 	if (err) {
 		return err;
 	}
@@ -67,7 +68,7 @@ static int ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, uint8_t a
 			aad_len -= 16;
 			i = 0;
 
-			err = bt_encrypt_be(key, b, X0);
+			err = ble_aes_key_encrypt(k, b, X0);
 			if (err) {
 				return err;
 			}
@@ -81,7 +82,7 @@ static int ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, uint8_t a
 			b[i] = X0[i];
 		}
 
-		err = bt_encrypt_be(key, b, X0);
+		err = ble_aes_key_encrypt(k, b, X0);
 		if (err) {
 			return err;
 		}
@@ -90,7 +91,7 @@ static int ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, uint8_t a
 	return 0;
 }
 
-static int ccm_auth(const uint8_t key[16], uint8_t nonce[13],
+static int ccm_auth(struct ble_aes_key *k, uint8_t nonce[13],
 		    const uint8_t *cleartext_msg, size_t msg_len, const uint8_t *aad,
 		    size_t aad_len, uint8_t *mic, size_t mic_size)
 {
@@ -110,12 +111,12 @@ static int ccm_auth(const uint8_t key[16], uint8_t nonce[13],
 	/* S[0] = e(AppKey, 0x01 || nonce || 0x0000) */
 	sys_put_be16(0x0000, &b[14]);
 
-	err = bt_encrypt_be(key, b, s0);
+	err = ble_aes_key_encrypt(k, b, s0);
 	if (err) {
 		return err;
 	}
 
-	ccm_calculate_X0(key, aad, aad_len, mic_size, msg_len, b, Xn);
+	ccm_calculate_X0(k, aad, aad_len, mic_size, msg_len, b, Xn);
 
 	for (j = 0; j < blk_cnt; j++) {
 		/* X_1 = e(AppKey, X_0 ^ Payload[0-15]) */
@@ -129,7 +130,7 @@ static int ccm_auth(const uint8_t key[16], uint8_t nonce[13],
 			xor16(b, Xn, &cleartext_msg[j * 16]);
 		}
 
-		err = bt_encrypt_be(key, b, Xn);
+		err = ble_aes_key_encrypt(k, b, Xn);
 		if (err) {
 			return err;
 		}
@@ -143,7 +144,7 @@ static int ccm_auth(const uint8_t key[16], uint8_t nonce[13],
 	return 0;
 }
 
-static int ccm_crypt(const uint8_t key[16], const uint8_t nonce[13],
+static int ccm_crypt(struct ble_aes_key *k, const uint8_t nonce[13],
 		     const uint8_t *in_msg, uint8_t *out_msg, size_t msg_len)
 {
 	uint8_t a_i[16], s_i[16];
@@ -164,7 +165,7 @@ static int ccm_crypt(const uint8_t key[16], const uint8_t nonce[13],
 		/* S_1 = e(AppKey, 0x01 || nonce || 0x0001) */
 		sys_put_be16(j + 1, &a_i[14]);
 
-		err = bt_encrypt_be(key, a_i, s_i);
+		err = ble_aes_key_encrypt(k, a_i, s_i);
 		if (err) {
 			return err;
 		}
@@ -186,15 +187,20 @@ int bt_ccm_decrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t *enc_
 		   size_t msg_len, const uint8_t *aad, size_t aad_len,
 		   uint8_t *out_msg, size_t mic_size)
 {
+	struct ble_aes_key k;
 	uint8_t mic[16];
 
 	if (aad_len >= 0xff00 || mic_size > sizeof(mic)) {
 		return -EINVAL;
 	}
 
-	ccm_crypt(key, nonce, enc_msg, out_msg, msg_len);
+	if (ble_aes_key_set(&k, key)) {
+		return -EINVAL;
+	}
+
+	ccm_crypt(&k, nonce, enc_msg, out_msg, msg_len);
 
-	ccm_auth(key, nonce, out_msg, msg_len, aad, aad_len, mic, mic_size);
+	ccm_auth(&k, nonce, out_msg, msg_len, aad, aad_len, mic, mic_size);
 
 	if (memcmp(mic, enc_msg + msg_len, mic_size)) {
 		return -EBADMSG;
@@ -208,6 +214,7 @@ int bt_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t *msg,
 		   uint8_t *out_msg, size_t mic_size)
 {
 	uint8_t *mic = out_msg + msg_len;
+	struct ble_aes_key k;
 
 	BT_DBG("key %s", bt_hex(key, 16));
 	BT_DBG("nonce %s", bt_hex(nonce, 13));
@@ -219,9 +226,13 @@ int bt_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t *msg,
 		return -EINVAL;
 	}
 
-	ccm_auth(key, nonce, out_msg, msg_len, aad, aad_len, mic, mic_size);
+	if (ble_aes_key_set(&k, key)) {
+		return -EINVAL;
+	}
+
+	ccm_auth(&k, nonce, out_msg, msg_len, aad, aad_len, mic, mic_size);
 
-	ccm_crypt(key, nonce, msg, out_msg, msg_len);
+	ccm_crypt(&k, nonce, msg, out_msg, msg_len);
 
 	return 0;
 }
@@ -76,11 +76,162 @@ struct iv_val {
 	iv_duration:7;
 } __packed;
 
-static struct {
-	uint32_t src : 15, /* MSb of source is always 0 */
-	      seq : 17;
-} msg_cache[MYNEWT_VAL(BLE_MESH_MSG_CACHE_SIZE)];
-static uint16_t msg_cache_next;
+#if MYNEWT_VAL(BLE_MESH_MSG_CACHE_INDEX)
+/* FIFO of recently seen 32-bit keys with a chained hash index, so that a
+ * lookup only walks the entries sharing a bucket instead of the whole
+ * cache. Chain and bucket links hold the entry index + 1, 0 ends a chain,
+ * which makes the zero initialized cache a valid empty one.
+ */
+struct net_cache {
+	uint32_t *key;
+	uint16_t *chain;  /* Next entry in the same bucket */
+	uint16_t *bucket; /* First entry of each bucket */
+	uint16_t size;
+	uint16_t next;    /* Oldest entry, replaced by the next add */
+};
+
+#define NET_CACHE_DEFINE(name, _size)                                   \
+	static uint32_t name##_key[_size];                              \
+	static uint16_t name##_chain[_size];                            \
+	static uint16_t name##_bucket[_size];                           \
+	static struct net_cache name = {                                \
+		.key = name##_key,                                      \
+		.chain = name##_chain,                                  \
+		.bucket = name##_bucket,                                \
+		.size = _size,                                          \
+	}
+
+static uint16_t *net_cache_slot(struct net_cache *cache, uint32_t key)
+{
+	/* Fibonacci hashing, then scale the hash to the bucket count with a
+	 * multiply instead of a division.
+	 */
+	key *= 0x9e3779b1;
+	return &cache->bucket[((uint64_t)key * cache->size) >> 32];
+}
+
+static bool net_cache_find(struct net_cache *cache, uint32_t key)
+{
+	uint16_t i;
+
+	for (i = *net_cache_slot(cache, key); i; i = cache->chain[i - 1]) {
+		if (cache->key[i - 1] == key) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void net_cache_unlink(struct net_cache *cache, uint16_t idx)
+{
+	uint16_t *link = net_cache_slot(cache, cache->key[idx]);
+
+	while (*link) {
+		if (*link == idx + 1) {
+			*link = cache->chain[idx];
+			return;
+		}
+
+		link = &cache->chain[*link - 1];
+	}
+}
+
+static uint16_t net_cache_add(struct net_cache *cache, uint32_t key)
+{
+	uint16_t idx = cache->next;
+	uint16_t *slot;
+
+	/* Evict the oldest entry, a no-op if it was never used or removed */
+	net_cache_unlink(cache, idx);
+
+	slot = net_cache_slot(cache, key);
+	cache->key[idx] = key;
+	cache->chain[idx] = *slot;
+	*slot = idx + 1;
+
+	cache->next = (idx + 1) % cache->size;
+
+	return idx;
+}
+
+static void net_cache_remove(struct net_cache *cache, uint16_t idx)
+{
+	net_cache_unlink(cache, idx);
+	/* Rewind the next index now that we're not using this entry */
+	cache->next = idx;
+}
+
+static void net_cache_reset(struct net_cache *cache)
+{
+	(void)memset(cache->key, 0, cache->size * sizeof(cache->key[0]));
+	(void)memset(cache->chain, 0, cache->size * sizeof(cache->chain[0]));
+	(void)memset(cache->bucket, 0, cache->size * sizeof(cache->bucket[0]));
+	cache->next = 0U;
+}
+#else
+/* FIFO of recently seen 32-bit keys, scanned for lookups. With the small
+ * default sizes that is faster than keeping an index. A removed or unused
+ * entry holds key 0, which the message cache never looks up (source 0 is
+ * unassigned).
+ */
+struct net_cache {
+	uint32_t *key;
+	uint16_t size;
+	uint16_t next;    /* Oldest entry, replaced by the next add */
+};
+
+#define NET_CACHE_DEFINE(name, _size)                                   \
+	static uint32_t name##_key[_size];                              \
+	static struct net_cache name = {                                \
+		.key = name##_key,                                      \
+		.size = _size,                                          \
+	}
+
+static bool net_cache_find(struct net_cache *cache, uint32_t key)
+{
+	uint16_t i;
+
+	for (i = 0; i < cache->size; i++) {
+		if (cache->key[i] == key) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static uint16_t net_cache_add(struct net_cache *cache, uint32_t key)
+{
+	uint16_t idx = cache->next;
+
+	cache->key[idx] = key;
+	cache->next = (idx + 1) % cache->size;
+
+	return idx;
+}
+
+static void net_cache_remove(struct net_cache *cache, uint16_t idx)
+{
+	cache->key[idx] = 0U;
+	/* Rewind the next index now that we're not using this entry */
+	cache->next = idx;
+}
+
+static void net_cache_reset(struct net_cache *cache)
+{
+	(void)memset(cache->key, 0, cache->size * sizeof(cache->key[0]));
+	cache->next = 0U;
+}
+#endif
+
+/* Network message cache, keyed on the 15-bit source (MSb of source is
+ * always 0) and the low 17 bits of the sequence number.
+ */
+NET_CACHE_DEFINE(msg_cache, MYNEWT_VAL(BLE_MESH_MSG_CACHE_SIZE));
+
+#define MSG_CACHE_KEY(src, seq) \
+	((((uint32_t)(src) & BIT_MASK(15)) << 17) | ((seq) & BIT_MASK(17)))
 
 /* Singleton network context (the implementation only supports one) */
 struct bt_mesh_net bt_mesh = {
@@ -102,50 +253,35 @@ os_membuf_t loopback_mbuf_membuf[
 		OS_MEMPOOL_SIZE(LOOPBACK_MAX_PDU_LEN + BT_MESH_MBUF_HEADER_SIZE,
         MYNEWT_VAL(BLE_MESH_LOOPBACK_BUFS))];
 
-static uint32_t dup_cache[MYNEWT_VAL(BLE_MESH_MSG_CACHE_SIZE)];
-static int   dup_cache_next;
+NET_CACHE_DEFINE(dup_cache, MYNEWT_VAL(BLE_MESH_MSG_CACHE_SIZE));
 
 static bool check_dup(struct os_mbuf *data)
 {
 	const uint8_t *tail = net_buf_simple_tail(data);
 	uint32_t val;
-	int i;
 
 	val = sys_get_be32(tail - 4) ^ sys_get_be32(tail - 8);
 
-	for (i = 0; i < ARRAY_SIZE(dup_cache); i++) {
-		if (dup_cache[i] == val) {
-			return true;
-		}
+	if (net_cache_find(&dup_cache, val)) {
+		return true;
 	}
 
-	dup_cache[dup_cache_next++] = val;
-	dup_cache_next %= ARRAY_SIZE(dup_cache);
+	net_cache_add(&dup_cache, val);
 
 	return false;
 }
 
 static bool msg_cache_match(struct os_mbuf *pdu)
 {
-	uint16_t i;
-
-	for (i = 0; i < ARRAY_SIZE(msg_cache); i++) {
-		if (msg_cache[i].src == SRC(pdu->om_data) &&
-		    msg_cache[i].seq == (SEQ(pdu->om_data) & BIT_MASK(17))) {
-			return true;
-		}
-	}
-
-	return false;
+	return net_cache_find(&msg_cache, MSG_CACHE_KEY(SRC(pdu->om_data),
+							SEQ(pdu->om_data)));
 }
 
 static void msg_cache_add(struct bt_mesh_net_rx *rx)
 {
 	/* Add to the cache */
-	rx->msg_cache_idx = msg_cache_next++;
-	msg_cache[rx->msg_cache_idx].src = rx->ctx.addr;
-	msg_cache[rx->msg_cache_idx].seq = rx->seq;
-	msg_cache_next %= ARRAY_SIZE(msg_cache);
+	rx->msg_cache_idx = net_cache_add(&msg_cache,
+					  MSG_CACHE_KEY(rx->ctx.addr, rx->seq));
 }
 
 static void store_iv(bool only_duration)
@@ -192,8 +328,7 @@ int bt_mesh_net_create(uint16_t idx, uint8_t flags, const uint8_t key[16],
 		return err;
 	}
 
-	(void)memset(msg_cache, 0, sizeof(msg_cache));
-	msg_cache_next = 0U;
+	net_cache_reset(&msg_cache);
 
 	bt_mesh.iv_index = iv_index;
 	atomic_set_bit_to(bt_mesh.flags, BT_MESH_IVU_IN_PROGRESS,
@@ -855,9 +990,7 @@ void bt_mesh_net_recv(struct os_mbuf *data, int8_t rssi,
 	 */
 	if (bt_mesh_trans_recv(buf, &rx) == -EAGAIN) {
 		BT_WARN("Removing rejected message from Network Message Cache");
-		msg_cache[rx.msg_cache_idx].src = BT_MESH_ADDR_UNASSIGNED;
-		/* Rewind the next index now that we're not using this entry */
-		msg_cache_next = rx.msg_cache_idx;
+		net_cache_remove(&msg_cache, rx.msg_cache_idx);
 	}
 
 	/* Relay if this was a group/virtual address, or if the destination
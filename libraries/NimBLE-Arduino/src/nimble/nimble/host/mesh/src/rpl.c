@@ -35,6 +35,128 @@ static inline int rpl_idx(const struct bt_mesh_rpl *rpl)
 	return rpl - &replay_list[0];
 }
 
+#if MYNEWT_VAL(BLE_MESH_RPL_INDEX)
+/* Hash index of the used entries by source address. Links hold the entry
+ * index + 1 and 0 ends a chain, so the zeroed list is a valid empty one.
+ */
+static uint16_t rpl_bucket[MYNEWT_VAL(BLE_MESH_CRPL)];
+static uint16_t rpl_chain[MYNEWT_VAL(BLE_MESH_CRPL)];
+/* Lowest index that may be an empty slot */
+static uint16_t rpl_free;
+
+static uint16_t *rpl_slot(uint16_t src)
+{
+	uint32_t hash = src * 0x9e3779b1U;
+
+	return &rpl_bucket[((uint64_t)hash * ARRAY_SIZE(rpl_bucket)) >> 32];
+}
+
+static struct bt_mesh_rpl *rpl_lookup(uint16_t src)
+{
+	uint16_t i;
+
+	for (i = *rpl_slot(src); i; i = rpl_chain[i - 1]) {
+		if (replay_list[i - 1].src == src) {
+			return &replay_list[i - 1];
+		}
+	}
+
+	return NULL;
+}
+
+static void rpl_unlink(struct bt_mesh_rpl *rpl)
+{
+	uint16_t idx = rpl_idx(rpl);
+	uint16_t *link;
+
+	if (!rpl->src) {
+		return;
+	}
+
+	for (link = rpl_slot(rpl->src); *link; link = &rpl_chain[*link - 1]) {
+		if (*link == idx + 1) {
+			*link = rpl_chain[idx];
+			break;
+		}
+	}
+
+	if (idx < rpl_free) {
+		rpl_free = idx;
+	}
+}
+
+/* Changes the source address of an entry, keeping the index up to date */
+static void rpl_set_src(struct bt_mesh_rpl *rpl, uint16_t src)
+{
+	uint16_t *slot;
+
+	if (rpl->src == src) {
+		return;
+	}
+
+	rpl_unlink(rpl);
+	rpl->src = src;
+
+	if (src) {
+		slot = rpl_slot(src);
+		rpl_chain[rpl_idx(rpl)] = *slot;
+		*slot = rpl_idx(rpl) + 1;
+	}
+}
+
+/* Lowest empty slot, which is not claimed until its address is set */
+static struct bt_mesh_rpl *rpl_empty(void)
+{
+	while (rpl_free < ARRAY_SIZE(replay_list)) {
+		if (!replay_list[rpl_free].src) {
+			return &replay_list[rpl_free];
+		}
+
+		rpl_free++;
+	}
+
+	return NULL;
+}
+
+static void rpl_index_reset(void)
+{
+	(void)memset(rpl_bucket, 0, sizeof(rpl_bucket));
+	rpl_free = 0U;
+}
+#else
+/* Small lists are scanned, that is faster than keeping an index */
+static struct bt_mesh_rpl *rpl_lookup(uint16_t src)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		if (replay_list[i].src == src) {
+			return &replay_list[i];
+		}
+	}
+
+	return NULL;
+}
+
+static inline void rpl_unlink(struct bt_mesh_rpl *rpl)
+{
+}
+
+static inline void rpl_set_src(struct bt_mesh_rpl *rpl, uint16_t src)
+{
+	rpl->src = src;
+}
+
+static struct bt_mesh_rpl *rpl_empty(void)
+{
+	return rpl_lookup(BT_MESH_ADDR_UNASSIGNED);
+}
+
+static inline void rpl_index_reset(void)
+{
+}
+#endif
+
 static void clear_rpl(struct bt_mesh_rpl *rpl)
 {
 #if MYNEWT_VAL(BLE_MESH_SETTINGS)
@@ -53,6 +175,7 @@ static void clear_rpl(struct bt_mesh_rpl *rpl)
 		BT_DBG("Cleared RPL");
 	}
 
+	rpl_unlink(rpl);
 	(void)memset(rpl, 0, sizeof(*rpl));
 	atomic_clear_bit(store, rpl_idx(rpl));
 #endif
@@ -90,7 +213,7 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		rpl->seg = 0;
 	}
 
-	rpl->src = rx->ctx.addr;
+	rpl_set_src(rpl, rx->ctx.addr);
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
 
@@ -107,7 +230,7 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		struct bt_mesh_rpl **match)
 {
-	int i;
+	struct bt_mesh_rpl *rpl;
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -119,11 +242,15 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		struct bt_mesh_rpl *rpl = &replay_list[i];
+	/* Existing slot for given address */
+	rpl = rpl_lookup(rx->ctx.addr);
+	if (rpl) {
+		if (rx->old_iv && !rpl->old_iv) {
+			return true;
+		}
 
-		/* Empty slot */
-		if (!rpl->src) {
+		if ((!rx->old_iv && rpl->old_iv) ||
+		    rpl->seq < rx->seq) {
 			if (match) {
 				*match = rpl;
 			} else {
@@ -131,27 +258,21 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 			}
 
 			return false;
+		} else {
+			return true;
 		}
+	}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
-
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				if (match) {
-					*match = rpl;
-				} else {
-					bt_mesh_rpl_update(rpl, rx);
-				}
-
-				return false;
-			} else {
-				return true;
-			}
+	/* Empty slot */
+	rpl = rpl_empty();
+	if (rpl) {
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
 		}
+
+		return false;
 	}
 
 	BT_ERR("RPL is full!");
@@ -166,35 +287,25 @@ void bt_mesh_rpl_clear(void)
 		schedule_rpl_clear();
 	} else {
 		(void)memset(replay_list, 0, sizeof(replay_list));
+		rpl_index_reset();
 	}
 }
 
 #if MYNEWT_VAL(BLE_MESH_SETTINGS)
 static struct bt_mesh_rpl *bt_mesh_rpl_find(uint16_t src)
 {
-	int i;
-
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		if (replay_list[i].src == src) {
-			return &replay_list[i];
-		}
-	}
-
-	return NULL;
+	return rpl_lookup(src);
 }
 
 static struct bt_mesh_rpl *bt_mesh_rpl_alloc(uint16_t src)
 {
-	int i;
+	struct bt_mesh_rpl *rpl = rpl_empty();
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		if (!replay_list[i].src) {
-			replay_list[i].src = src;
-			return &replay_list[i];
-		}
+	if (rpl) {
+		rpl_set_src(rpl, src);
 	}
 
-	return NULL;
+	return rpl;
 }
 #endif
 
@@ -213,6 +324,7 @@ void bt_mesh_rpl_reset(void)
 				if (IS_ENABLED(CONFIG_BT_SETTINGS)) {
 					clear_rpl(rpl);
 				} else {
+					rpl_unlink(rpl);
 					(void)memset(rpl, 0, sizeof(*rpl));
 				}
 			} else {
@@ -245,6 +357,7 @@ static int rpl_set(int argc, char **argv, char *val)
 
 	if (!val) {
 		if (entry) {
+			rpl_unlink(entry);
 			memset(entry, 0, sizeof(*entry));
 		} else {
 			BT_WARN("Unable to find RPL entry for 0x%04x", src);
@@ -328,8 +441,18 @@ static void store_pending_rpl(struct bt_mesh_rpl *rpl)
 	}
 }
 
+static void pending_store(struct bt_mesh_rpl *rpl)
+{
+	if (atomic_test_bit(bt_mesh.flags, BT_MESH_VALID)) {
+		store_pending_rpl(rpl);
+	} else {
+		clear_rpl(rpl);
+	}
+}
+
 void bt_mesh_rpl_pending_store(uint16_t addr)
 {
+	struct bt_mesh_rpl *rpl;
 	int i;
 
 	if (!IS_ENABLED(CONFIG_BT_SETTINGS) ||
@@ -338,25 +461,19 @@ void bt_mesh_rpl_pending_store(uint16_t addr)
 		return;
 	}
 
-	if (addr == BT_MESH_ADDR_ALL_NODES) {
-		bt_mesh_settings_store_cancel(BT_MESH_SETTINGS_RPL_PENDING);
-	}
-
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		if (addr != BT_MESH_ADDR_ALL_NODES &&
-		addr != replay_list[i].src) {
-			continue;
+	if (addr != BT_MESH_ADDR_ALL_NODES) {
+		rpl = rpl_lookup(addr);
+		if (rpl) {
+			pending_store(rpl);
 		}
 
-		if (atomic_test_bit(bt_mesh.flags, BT_MESH_VALID)) {
-			store_pending_rpl(&replay_list[i]);
-		} else {
-			clear_rpl(&replay_list[i]);
-		}
+		return;
+	}
 
-		if (addr != BT_MESH_ADDR_ALL_NODES) {
-			break;
-		}
+	bt_mesh_settings_store_cancel(BT_MESH_SETTINGS_RPL_PENDING);
+
+	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		pending_store(&replay_list[i]);
 	}
 }
 
@@ -8,6 +8,7 @@
 #include <stddef.h>
 #include "nimble/nimble/host/include/host/ble_aes_ccm.h"
 #include "nimble/nimble/host/src/ble_hs_conn_priv.h"
+#include "nimble/nimble/host/src/ble_aes_key_priv.h"
 
 #if MYNEWT_VAL(ENC_ADV_DATA)
 
@@ -110,7 +111,7 @@ static inline void xor16(uint8_t *dst, const uint8_t *a, const uint8_t *b)
 }
 
 /* pmsg is assumed to have the nonce already present in bytes 1-13 */
-static int ble_aes_ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, uint8_t aad_len,
+static int ble_aes_ccm_calculate_X0(struct ble_aes_key *k, const uint8_t *aad, uint8_t aad_len,
                                     size_t mic_size, uint8_t msg_len, uint8_t b[16],
                                     uint8_t X0[16])
 {
@@ -121,7 +122,7 @@ static int ble_aes_ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, u
 
     sys_put_be16(msg_len, b + 14);
 
-    err = ble_aes_ccm_encrypt_be(key, b, X0);
+    err = ble_aes_key_encrypt(k, b, X0);
     if (err) {
         return err;
     }
@@ -145,7 +146,7 @@ static int ble_aes_ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, u
             aad_len -= 16;
             i = 0;
 
-            err = ble_aes_ccm_encrypt_be(key, b, X0);
+            err = ble_aes_key_encrypt(k, b, X0);
             if (err) {
                 return err;
             }
@@ -159,7 +160,7 @@ static int ble_aes_ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, u
             b[i] = X0[i];
         }
 
-        err = ble_aes_ccm_encrypt_be(key, b, X0);
+        err = ble_aes_key_encrypt(k, b, X0);
         if (err) {
             return err;
         }
@@ -168,7 +169,7 @@ static int ble_aes_ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, u
     return 0;
 }
 
-static int ble_aes_ccm_auth(const uint8_t key[16], uint8_t nonce[13],
+static int ble_aes_ccm_auth(struct ble_aes_key *k, uint8_t nonce[13],
                             const uint8_t *cleartext_msg, size_t msg_len, const uint8_t *aad,
                             size_t aad_len, uint8_t *mic, size_t mic_size)
 {
@@ -188,12 +189,12 @@ static int ble_aes_ccm_auth(const uint8_t key[16], uint8_t nonce[13],
     /* S[0] = e(AppKey, 0x01 || nonce || 0x0000) */
     sys_put_be16(0x0000, &b[14]);
 
-    err = ble_aes_ccm_encrypt_be(key, b, s0);
+    err = ble_aes_key_encrypt(k, b, s0);
     if (err) {
         return err;
     }
 
-    ble_aes_ccm_calculate_X0(key, aad, aad_len, mic_size, msg_len, b, Xn);
+    ble_aes_ccm_calculate_X0(k, aad, aad_len, mic_size, msg_len, b, Xn);
 
     for (j = 0; j < blk_cnt; j++) {
         /* X_1 = e(AppKey, X_0 ^ Payload[0-15]) */
@@ -207,7 +208,7 @@ static int ble_aes_ccm_auth(const uint8_t key[16], uint8_t nonce[13],
             xor16(b, Xn, &cleartext_msg[j * 16]);
         }
 
-        err = ble_aes_ccm_encrypt_be(key, b, Xn);
+        err = ble_aes_key_encrypt(k, b, Xn);
         if (err) {
             return err;
         }
@@ -221,7 +222,7 @@ static int ble_aes_ccm_auth(const uint8_t key[16], uint8_t nonce[13],
     return 0;
 }
 
-static int ble_aes_ccm_crypt(const uint8_t key[16], const uint8_t nonce[13],
+static int ble_aes_ccm_crypt(struct ble_aes_key *k, const uint8_t nonce[13],
                              const uint8_t *in_msg, uint8_t *out_msg, size_t msg_len)
 {
     uint8_t a_i[16], s_i[16];
@@ -242,7 +243,7 @@ static int ble_aes_ccm_crypt(const uint8_t key[16], const uint8_t nonce[13],
         /* S_1 = e(AppKey, 0x01 || nonce || 0x0001) */
         sys_put_be16(j + 1, &a_i[14]);
 
-        err = ble_aes_ccm_encrypt_be(key, a_i, s_i);
+        err = ble_aes_key_encrypt(k, a_i, s_i);
         if (err) {
             return err;
         }
@@ -264,6 +265,7 @@ int ble_aes_ccm_decrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t
                         size_t msg_len, const uint8_t *aad, size_t aad_len,
                         uint8_t *out_msg, size_t mic_size)
 {
+    struct ble_aes_key k;
     uint8_t mic[16];
     uint8_t key_reversed[16];
 
@@ -276,9 +278,13 @@ int ble_aes_ccm_decrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t
         key_reversed[i] = key[15 - i];
     }
 
-    ble_aes_ccm_crypt(key_reversed, nonce, enc_msg, out_msg, msg_len);
+    if (ble_aes_key_set(&k, key_reversed)) {
+        return BLE_HS_EUNKNOWN;
+    }
+
+    ble_aes_ccm_crypt(&k, nonce, enc_msg, out_msg, msg_len);
 
-    ble_aes_ccm_auth(key_reversed, nonce, out_msg, msg_len, aad, aad_len, mic, mic_size);
+    ble_aes_ccm_auth(&k, nonce, out_msg, msg_len, aad, aad_len, mic, mic_size);
 
     /*if (memcmp(mic, enc_msg + msg_len, mic_size)) {
         printf("\n%s return here", __func__);
@@ -294,6 +300,7 @@ int ble_aes_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t
 {
     /** MIC starts after encrypted message and is part of encrypted advertisement data */
     uint8_t *mic = out_msg + msg_len;
+    struct ble_aes_key k;
     uint8_t key_reversed[16];
 
     /* Unsupported AAD size */
@@ -306,11 +313,15 @@ int ble_aes_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t
         key_reversed[i] = key[15 - i];
     }
 
+    if (ble_aes_key_set(&k, key_reversed)) {
+        return BLE_HS_EUNKNOWN;
+    }
+
     /** Calculating MIC */
-    ble_aes_ccm_auth(key_reversed, nonce, msg, msg_len, aad, aad_len, mic, mic_size);
+    ble_aes_ccm_auth(&k, nonce, msg, msg_len, aad, aad_len, mic, mic_size);
 
     /** Encrypting advertisment */
-    ble_aes_ccm_crypt(key_reversed, nonce, msg, out_msg, msg_len);
+    ble_aes_ccm_crypt(&k, nonce, msg, out_msg, msg_len);
 
     return 0;
 }
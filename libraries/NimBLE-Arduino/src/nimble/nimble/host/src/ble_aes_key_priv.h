@@ -0,0 +1,91 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef H_BLE_AES_KEY_PRIV_
+#define H_BLE_AES_KEY_PRIV_
+
+#include <stdint.h>
+#include "nimble/porting/nimble/include/syscfg/syscfg.h"
+#include "nimble/nimble/host/include/host/ble_hs.h"
+#if MYNEWT_VAL(BLE_CRYPTO_STACK_MBEDTLS)
+#include "mbedtls/aes.h"
+#else
+#include "nimble/ext/tinycrypt/include/tinycrypt/aes.h"
+#include "nimble/ext/tinycrypt/include/tinycrypt/constants.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * AES-128 key for the blocks of one CCM message, used by the encrypted
+ * advertising data (ble_aes_ccm.c) and by mesh (aes-ccm.c).  With tinycrypt
+ * the key schedule is expanded once per message rather than once per block.
+ */
+struct ble_aes_key {
+#if MYNEWT_VAL(BLE_CRYPTO_STACK_MBEDTLS)
+    const uint8_t *key;
+#else
+    struct tc_aes_key_sched_struct sched;
+#endif
+};
+
+static inline int
+ble_aes_key_set(struct ble_aes_key *k, const uint8_t key[16])
+{
+#if MYNEWT_VAL(BLE_CRYPTO_STACK_MBEDTLS)
+    k->key = key;
+#else
+    if (tc_aes128_set_encrypt_key(&k->sched, key) == TC_CRYPTO_FAIL) {
+        return BLE_HS_EUNKNOWN;
+    }
+#endif
+    return 0;
+}
+
+static inline int
+ble_aes_key_encrypt(struct ble_aes_key *k, const uint8_t in[16],
+                    uint8_t out[16])
+{
+#if MYNEWT_VAL(BLE_CRYPTO_STACK_MBEDTLS)
+    mbedtls_aes_context s;
+    int rc;
+
+    mbedtls_aes_init(&s);
+    rc = mbedtls_aes_setkey_enc(&s, k->key, 128);
+    if (rc == 0) {
+        rc = mbedtls_aes_crypt_ecb(&s, MBEDTLS_AES_ENCRYPT, in, out);
+    }
+    mbedtls_aes_free(&s);
+
+    return rc ? BLE_HS_EUNKNOWN : 0;
+#else
+    if (tc_aes_encrypt(out, in, &k->sched) == TC_CRYPTO_FAIL) {
+        return BLE_HS_EUNKNOWN;
+    }
+    return 0;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
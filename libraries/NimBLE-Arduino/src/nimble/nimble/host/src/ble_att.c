@@ -563,7 +563,9 @@ ble_att_rx_extended(uint16_t conn_handle, uint16_t cid, struct os_mbuf **om)
     /* Strip L2CAP ATT header from the front of the mbuf. */
     os_mbuf_adj(*om, 1);
 
+    os_trace_ring_rec(BLE_HS_TRACE_ID_ATT_RX_START, conn_handle, op, 0);
     rc = entry->bde_fn(conn_handle, cid, om);
+    os_trace_ring_rec(BLE_HS_TRACE_ID_ATT_RX_END, conn_handle, op, rc);
     if (rc != 0) {
         if (rc == BLE_HS_ENOTSUP) {
             ble_att_rx_handle_unknown_request(op, conn_handle, cid, om);
@@ -188,6 +188,7 @@ int ble_att_init(void);
 
 int ble_att_svr_start(void);
 void ble_att_svr_stop(void);
+void ble_att_svr_build_idx(void);
 
 struct ble_att_svr_entry *
 ble_att_svr_find_by_uuid(struct ble_att_svr_entry *start_at,
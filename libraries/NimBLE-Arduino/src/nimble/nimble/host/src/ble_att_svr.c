@@ -57,6 +57,13 @@ static struct ble_att_svr_entry_list ble_att_svr_hidden_list;
 
 static uint16_t ble_att_svr_id;
 
+/* Handle-indexed view of ble_att_svr_list; slot (handle - 1) points to the
+ * visible entry with that handle, or NULL.  Built when the GATT table is
+ * finalized; handles registered afterwards are found by walking the list.
+ */
+static struct ble_att_svr_entry **ble_att_svr_idx;
+static uint16_t ble_att_svr_idx_cnt;
+
 static void *ble_att_svr_entry_mem;
 static struct os_mempool ble_att_svr_entry_pool;
 
@@ -86,6 +93,51 @@ ble_att_svr_entry_alloc(void)
     return entry;
 }
 
+static void
+ble_att_svr_idx_set(uint16_t handle_id, struct ble_att_svr_entry *entry)
+{
+    if (handle_id != 0 && handle_id <= ble_att_svr_idx_cnt) {
+        ble_att_svr_idx[handle_id - 1] = entry;
+    }
+}
+
+static void
+ble_att_svr_idx_free(void)
+{
+    nimble_platform_mem_free(ble_att_svr_idx);
+    ble_att_svr_idx = NULL;
+    ble_att_svr_idx_cnt = 0;
+}
+
+/**
+ * Builds the handle index from the current attribute list.  If there is not
+ * enough memory the index is left empty and lookups walk the list.
+ */
+void
+ble_att_svr_build_idx(void)
+{
+    struct ble_att_svr_entry *entry;
+
+    ble_att_svr_idx_free();
+
+    if (ble_att_svr_id == 0) {
+        return;
+    }
+
+    ble_att_svr_idx = nimble_platform_mem_malloc(ble_att_svr_id *
+                                                 sizeof *ble_att_svr_idx);
+    if (ble_att_svr_idx == NULL) {
+        return;
+    }
+
+    memset(ble_att_svr_idx, 0, ble_att_svr_id * sizeof *ble_att_svr_idx);
+    ble_att_svr_idx_cnt = ble_att_svr_id;
+
+    STAILQ_FOREACH(entry, &ble_att_svr_list, ha_next) {
+        ble_att_svr_idx_set(entry->ha_handle_id, entry);
+    }
+}
+
 static void
 ble_att_svr_entry_free(struct ble_att_svr_entry *entry)
 {
@@ -168,6 +220,7 @@ int ble_att_svr_deregister(uint16_t start_handle, uint16_t end_group_handle) {
     for (idx = start_handle; idx <= end_group_handle; idx++) {
         entry = ble_att_svr_find_by_handle(idx);
         STAILQ_REMOVE(&ble_att_svr_list, entry, ble_att_svr_entry, ha_next);
+        ble_att_svr_idx_set(idx, NULL);
         ble_att_svr_entry_free(entry);
     }
     return 0;
@@ -199,6 +252,10 @@ ble_att_svr_find_by_handle(uint16_t handle_id)
 {
     struct ble_att_svr_entry *entry;
 
+    if (handle_id != 0 && handle_id <= ble_att_svr_idx_cnt) {
+        return ble_att_svr_idx[handle_id - 1];
+    }
+
     for (entry = STAILQ_FIRST(&ble_att_svr_list);
          entry != NULL;
          entry = STAILQ_NEXT(entry, ha_next)) {
@@ -211,6 +268,67 @@ ble_att_svr_find_by_handle(uint16_t handle_id)
     return NULL;
 }
 
+/**
+ * Find the last host attribute with a handle lower than the one specified.
+ * Used as the starting point of a handle range walk.
+ *
+ * @param handle_id             The first handle of the range.
+ *
+ * @return                      The entry preceding the range; NULL if the
+ *                                  range starts at the head of the list.
+ */
+static struct ble_att_svr_entry *
+ble_att_svr_find_prev(uint16_t handle_id)
+{
+    struct ble_att_svr_entry *entry;
+    struct ble_att_svr_entry *prev;
+    uint16_t idx;
+
+    if (handle_id <= 1) {
+        return NULL;
+    }
+
+    if (handle_id - 1 <= ble_att_svr_idx_cnt) {
+        for (idx = handle_id - 1; idx > 0; idx--) {
+            if (ble_att_svr_idx[idx - 1] != NULL) {
+                return ble_att_svr_idx[idx - 1];
+            }
+        }
+        return NULL;
+    }
+
+    prev = NULL;
+    STAILQ_FOREACH(entry, &ble_att_svr_list, ha_next) {
+        if (entry->ha_handle_id >= handle_id) {
+            break;
+        }
+        prev = entry;
+    }
+
+    return prev;
+}
+
+/**
+ * Find the first host attribute with a handle greater than or equal to the
+ * one specified.
+ *
+ * @param handle_id             The first handle of the range.
+ *
+ * @return                      The first entry of the range; NULL if none.
+ */
+static struct ble_att_svr_entry *
+ble_att_svr_find_first(uint16_t handle_id)
+{
+    struct ble_att_svr_entry *prev;
+
+    prev = ble_att_svr_find_prev(handle_id);
+    if (prev == NULL) {
+        return STAILQ_FIRST(&ble_att_svr_list);
+    }
+
+    return STAILQ_NEXT(prev, ha_next);
+}
+
 /**
  * Find a host attribute by UUID.
  *
@@ -848,7 +966,10 @@ ble_att_svr_fill_info(uint16_t start_handle, uint16_t end_handle,
     num_entries = 0;
     rc = 0;
 
-    STAILQ_FOREACH(ha, &ble_att_svr_list, ha_next) {
+    for (ha = ble_att_svr_find_first(start_handle);
+         ha != NULL;
+         ha = STAILQ_NEXT(ha, ha_next)) {
+
         if (ha->ha_handle_id > end_handle) {
             rc = 0;
             goto done;
@@ -1133,7 +1254,10 @@ ble_att_svr_fill_type_value(uint16_t conn_handle,
      * matching group.  For each attribute entry, determine if data needs to be
      * written to the response.
      */
-    STAILQ_FOREACH(ha, &ble_att_svr_list, ha_next) {
+    for (ha = ble_att_svr_find_first(start_handle);
+         ha != NULL;
+         ha = STAILQ_NEXT(ha, ha_next)) {
+
         if (ha->ha_handle_id < start_handle) {
             continue;
         }
@@ -1405,7 +1529,7 @@ ble_att_svr_build_read_type_rsp(uint16_t conn_handle, uint16_t cid,
     mtu = ble_att_mtu_by_cid(conn_handle, cid);
 
     /* Find all matching attributes, writing a record for each. */
-    entry = NULL;
+    entry = ble_att_svr_find_prev(start_handle);
     while (1) {
         entry = ble_att_svr_find_by_uuid(entry, uuid, end_handle);
         if (entry == NULL) {
@@ -2049,7 +2173,10 @@ ble_att_svr_build_read_group_type_rsp(uint16_t conn_handle, uint16_t cid,
     }
 
     rsp->bagp_length = 0;
-    STAILQ_FOREACH(entry, &ble_att_svr_list, ha_next) {
+    for (entry = ble_att_svr_find_first(start_handle);
+         entry != NULL;
+         entry = STAILQ_NEXT(entry, ha_next)) {
+
         if (entry->ha_handle_id < start_handle) {
             continue;
         }
@@ -3199,6 +3326,9 @@ ble_att_svr_move_entries(struct ble_att_svr_entry_list *src,
             STAILQ_REMOVE_AFTER(src, remove, ha_next);
         }
 
+        ble_att_svr_idx_set(entry->ha_handle_id,
+                            dst == &ble_att_svr_list ? entry : NULL);
+
         /* Insert current element */
         if (insert == NULL) {
             STAILQ_INSERT_HEAD(dst, entry, ha_next);
@@ -3247,6 +3377,7 @@ ble_att_svr_reset(void)
     }
 
     ble_att_svr_id = 0;
+    ble_att_svr_idx_free();
 
     /* Note: prep entries do not get freed here because it is assumed there are
      * no established connections.
@@ -3303,6 +3434,7 @@ err:
 void
 ble_att_svr_stop(void)
 {
+    ble_att_svr_idx_free();
     ble_att_svr_free_start_mem();
 }
 
@@ -1728,6 +1728,9 @@ ble_gatts_start(void)
     }
     ble_gatts_free_svc_defs();
 
+    /* The attribute table is complete, index it by handle. */
+    ble_att_svr_build_idx();
+
     if (ble_gatts_num_cfgable_chrs == 0) {
         rc = 0;
         goto done;
@@ -2886,6 +2889,7 @@ int ble_gatts_add_dynamic_svcs(const struct ble_gatt_svc_def *svcs) {
 #endif
     }
     ble_gatts_free_svc_defs();
+    ble_att_svr_build_idx();
      /* Fill the cache. */
     cfg = ble_gatts_get_last_cfg(&ble_gatts_clt_cfgs);
     ha = ble_att_svr_find_by_handle(cfg->chr_val_handle - 1);
@@ -549,6 +549,8 @@ ble_hs_hci_cmd_tx(uint16_t opcode, const void *cmd, uint8_t cmd_len,
     BLE_HS_DBG_ASSERT(ble_hs_hci_ack == NULL);
     ble_hs_hci_lock();
 
+    os_trace_ring_rec(BLE_HS_TRACE_ID_HCI_CMD_START, opcode, 0, 0);
+
     rc = ble_hs_hci_cmd_send_buf(opcode, cmd, cmd_len);
     if (rc != 0) {
         goto done;
@@ -582,6 +584,8 @@ done:
         ble_hs_hci_ack = NULL;
     }
 
+    os_trace_ring_rec(BLE_HS_TRACE_ID_HCI_CMD_END, opcode, rc, 0);
+
     ble_hs_hci_unlock();
     esp_hci_err_to_name(rc, &opcode);
     return rc;
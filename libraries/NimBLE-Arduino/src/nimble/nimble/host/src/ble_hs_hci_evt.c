@@ -1311,11 +1311,16 @@ int
 ble_hs_hci_evt_process(struct ble_hci_ev *ev)
 {
     const struct ble_hs_hci_evt_dispatch_entry *entry;
+    uint8_t evcode;
     int rc;
 
     /* Count events received */
     STATS_INC(ble_hs_stats, hci_event);
 
+    evcode = ev->opcode;
+    os_trace_ring_rec(BLE_HS_TRACE_ID_HCI_EVT_START, evcode,
+                      evcode == BLE_HCI_EVCODE_LE_META ? ev->data[0] : 0, 0);
+
     if(ev->opcode == BLE_HCI_EVCODE_COMMAND_COMPLETE) {
         /* Check if this Command complete has a parsable opcode */
         struct ble_hci_ev_command_complete *cmd_complete = (void *) ev->data;
@@ -1347,6 +1352,8 @@ ble_hs_hci_evt_process(struct ble_hci_ev *ev)
 
     ble_transport_free((uint8_t *)ev);
 
+    os_trace_ring_rec(BLE_HS_TRACE_ID_HCI_EVT_END, evcode, rc, 0);
+
     return rc;
 }
 
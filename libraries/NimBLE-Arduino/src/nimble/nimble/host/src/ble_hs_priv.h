@@ -45,6 +45,7 @@
 #include "nimble/nimble/host/include/host/ble_hs.h"
 #include "nimble/nimble/include/nimble/nimble_opt.h"
 #include "nimble/porting/nimble/include/stats/stats.h"
+#include "nimble/porting/nimble/include/os/os_trace_ring.h"
 #if MYNEWT_VAL(BLE_GATT_CACHING)
 #include "ble_gattc_cache_priv.h"
 #endif
@@ -72,6 +73,19 @@ struct os_event;
 #define BLE_HS_MAX_CONNECTIONS 0
 #endif
 
+/* Trace ring records of the host, arg0 pairs START with END */
+#define BLE_HS_TRACE_ID_HCI_CMD_START   (OS_TRACE_RING_ID_HS + 0) /* opcode */
+#define BLE_HS_TRACE_ID_HCI_CMD_END     (OS_TRACE_RING_ID_HS + 1) /* opcode,
+                                                                   * rc */
+#define BLE_HS_TRACE_ID_HCI_EVT_START   (OS_TRACE_RING_ID_HS + 2) /* evcode,
+                                                                   * subev */
+#define BLE_HS_TRACE_ID_HCI_EVT_END     (OS_TRACE_RING_ID_HS + 3) /* evcode,
+                                                                   * rc */
+#define BLE_HS_TRACE_ID_ATT_RX_START    (OS_TRACE_RING_ID_HS + 4) /* conn,
+                                                                   * op */
+#define BLE_HS_TRACE_ID_ATT_RX_END      (OS_TRACE_RING_ID_HS + 5) /* conn,
+                                                                   * op, rc */
+
 #if !MYNEWT_VAL(BLE_ATT_SVR_QUEUED_WRITE)
 #define BLE_HS_ATT_SVR_QUEUED_WRITE_TMO 0
 #else
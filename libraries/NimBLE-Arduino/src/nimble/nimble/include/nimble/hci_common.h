@@ -1366,6 +1366,19 @@ struct ble_hci_vs_set_antenna_cp {
     uint8_t antenna;
 } __attribute__((packed));
 
+/* Read scan duplicate filter statistics, optionally restart them */
+#define BLE_HCI_OCF_VS_RD_SCAN_DUP_STATS                (MYNEWT_VAL(BLE_HCI_VS_OCF_OFFSET) + (0x000A))
+struct ble_hci_vs_rd_scan_dup_stats_cp {
+    uint8_t clear;
+} __attribute__((packed));
+struct ble_hci_vs_rd_scan_dup_stats_rp {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint16_t capacity;
+    uint16_t count;
+} __attribute__((packed));
+
 
 
 #define BLE_HCI_OCF_VS_DUPLICATE_EXCEPTION_LIST         (MYNEWT_VAL(BLE_HCI_VS_OCF_OFFSET) + (0x0108))
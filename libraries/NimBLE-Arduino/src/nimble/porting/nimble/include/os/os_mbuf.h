@@ -244,6 +244,65 @@ _os_mbuf_trailingspace(struct os_mbuf *om)
  */
 #define OS_MBUF_TRAILINGSPACE(__om) _os_mbuf_trailingspace(__om)
 
+/**
+ * A read-only view of one contiguous run of bytes in an mbuf chain.
+ */
+struct os_mbuf_iovec {
+    /** Start of the bytes, inside the data buffer of an mbuf */
+    const uint8_t *iov_base;
+    /** Number of bytes */
+    uint16_t iov_len;
+};
+
+/**
+ * Describes "len" bytes of an mbuf chain, starting "off" bytes from the
+ * beginning, as a list of contiguous segments without copying the data.
+ * The segments are only valid until the chain is modified or freed.
+ *
+ * @param om                    The mbuf chain to describe.
+ * @param off                   The offset into the chain to start at.
+ * @param len                   The number of bytes to describe.
+ * @param iov                   The segments to fill in; may be NULL if
+ *                                  iov_cnt is 0.
+ * @param iov_cnt               The number of entries in iov.
+ *
+ * @return                      The number of segments in the range, only
+ *                                  the first iov_cnt of them are filled in;
+ *                              -1 if the mbuf does not contain enough data.
+ */
+static inline int
+os_mbuf_to_iovec(const struct os_mbuf *om, int off, int len,
+                 struct os_mbuf_iovec *iov, int iov_cnt)
+{
+    uint16_t count;
+    int cnt;
+
+    while (om != NULL && off >= om->om_len) {
+        off -= om->om_len;
+        om = SLIST_NEXT(om, om_next);
+    }
+
+    cnt = 0;
+    while (len > 0 && om != NULL) {
+        count = om->om_len - off;
+        if (count > len) {
+            count = len;
+        }
+        if (count > 0) {
+            if (cnt < iov_cnt) {
+                iov[cnt].iov_base = om->om_data + off;
+                iov[cnt].iov_len = count;
+            }
+            cnt++;
+        }
+        len -= count;
+        off = 0;
+        om = SLIST_NEXT(om, om_next);
+    }
+
+    return (len > 0 ? -1 : cnt);
+}
+
 
 #if SOC_ESP_NIMBLE_CONTROLLER && CONFIG_BT_CONTROLLER_ENABLED
 /**
@@ -71,6 +71,10 @@ struct os_mempool {
     SLIST_HEAD(,os_memblock);
     /** Name for memory block */
     const char *name;
+#if !(SOC_ESP_NIMBLE_CONTROLLER && CONFIG_BT_CONTROLLER_ENABLED)
+    /** Number of allocations that found the pool empty, saturates */
+    uint16_t mp_num_fail;
+#endif
 };
 
 /**
@@ -127,6 +131,10 @@ struct os_mempool_info {
     int omi_min_free;
     /** Name of the memory pool */
     char omi_name[OS_MEMPOOL_INFO_NAME_LEN];
+#if !(SOC_ESP_NIMBLE_CONTROLLER && CONFIG_BT_CONTROLLER_ENABLED)
+    /** Number of allocations that found the pool empty */
+    int omi_num_fail;
+#endif
 };
 
 /**
@@ -346,6 +354,17 @@ os_error_t os_mempool_clear(struct os_mempool *mp);
  */
 os_error_t os_mempool_ext_clear(struct os_mempool_ext *mpe);
 
+/**
+ * Restarts the usage statistics of a memory pool: the lowest number of free
+ * blocks becomes the current number free and the allocation failure count is
+ * zeroed.  Blocks in use at the busiest point are
+ * mp_num_blocks - mp_min_free, so clearing this periodically gives the peak
+ * usage of each period.
+ *
+ * @param mp                    The mempool to restart the statistics of.
+ */
+void os_mempool_stats_clear(struct os_mempool *mp);
+
 /**
  * Performs an integrity check of the specified mempool.  This function
  * attempts to detect memory corruption in the specified memory pool.
@@ -0,0 +1,137 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef OS_TRACE_RING_H
+#define OS_TRACE_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "nimble/porting/nimble/include/syscfg/syscfg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Binary trace ring.
+ *
+ * Tracepoints store fixed size, timestamped records in a ring of
+ * OS_TRACE_RING_SIZE entries (power of 2, 0 compiles the tracepoints out).
+ * Writers never block or take a lock, the oldest records are overwritten when
+ * nobody reads the ring. The ring can be read with os_trace_ring_read(),
+ * written out with os_trace_ring_dump() or copied from g_os_trace_ring with a
+ * debugger; extras/ble_trace_decode.py turns either into latency histograms.
+ *
+ * Records with the same 16 bit key in arg0 pair a *_START id with the
+ * following *_END id (id + 1) into a duration.
+ */
+
+#define OS_TRACE_RING_MAGIC             (0x5254424e) /* "NBTR" */
+
+/* Ids of the records, 0 is never used */
+#define OS_TRACE_RING_ID_LOST           (1)     /* arg1: number of records */
+#define OS_TRACE_RING_ID_MEMPOOL_EMPTY  (2)     /* arg0: block size,
+                                                 * arg1: blocks, arg2: pool */
+
+/* Bases of the record ids of the controller and the host */
+#define OS_TRACE_RING_ID_LL             (0x20)
+#define OS_TRACE_RING_ID_HS             (0x40)
+
+struct os_trace_ring_rec {
+    uint32_t ts;
+    uint8_t id;
+    /* Number of times the ring wrapped when the record was written */
+    uint8_t lap;
+    uint16_t arg0;
+    uint32_t arg1;
+    uint32_t arg2;
+};
+
+struct os_trace_ring_hdr {
+    uint32_t magic;
+    uint16_t rec_size;
+    /* Records in the ring, 0 in a dump where the records follow oldest
+     * first until the end of the data.
+     */
+    uint16_t num_recs;
+    /* Timestamp ticks per second */
+    uint32_t ts_freq;
+    /* Number of records written so far */
+    uint32_t head;
+};
+
+typedef void os_trace_ring_out_fn(const void *buf, size_t len, void *arg);
+
+#if MYNEWT_VAL(OS_TRACE_RING_SIZE)
+
+#if MYNEWT_VAL(OS_TRACE_RING_SIZE) & (MYNEWT_VAL(OS_TRACE_RING_SIZE) - 1)
+#error "OS_TRACE_RING_SIZE must be a power of 2"
+#endif
+
+struct os_trace_ring {
+    struct os_trace_ring_hdr hdr;
+    struct os_trace_ring_rec recs[MYNEWT_VAL(OS_TRACE_RING_SIZE)];
+};
+
+extern struct os_trace_ring g_os_trace_ring;
+
+void os_trace_ring_put(uint8_t id, uint16_t arg0, uint32_t arg1,
+                       uint32_t arg2);
+
+/**
+ * Copies records from the ring, oldest first. Stops at a record which is
+ * still being written.
+ *
+ * @param pos   Index of the next record to read, 0 for the oldest one. Moved
+ *              past the copied records; when records were overwritten before
+ *              they could be read, it is moved past those too.
+ * @param recs  Buffer for the records.
+ * @param max   Size of the buffer in records.
+ *
+ * @return int  Number of records copied.
+ */
+int os_trace_ring_read(uint32_t *pos, struct os_trace_ring_rec *recs, int max);
+
+/**
+ * Writes a header and all records in the ring, oldest first. A record with
+ * OS_TRACE_RING_ID_LOST is inserted where records were overwritten while
+ * writing.
+ *
+ * @param out   Called with each chunk of the dump.
+ * @param arg   Passed to out.
+ *
+ * @return int  Number of records written.
+ */
+int os_trace_ring_dump(os_trace_ring_out_fn *out, void *arg);
+
+#endif
+
+static inline void
+os_trace_ring_rec(uint8_t id, uint16_t arg0, uint32_t arg1, uint32_t arg2)
+{
+#if MYNEWT_VAL(OS_TRACE_RING_SIZE)
+    os_trace_ring_put(id, arg0, arg1, arg2);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OS_TRACE_RING_H */
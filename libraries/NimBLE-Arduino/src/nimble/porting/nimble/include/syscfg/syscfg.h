@@ -126,6 +126,14 @@
 #define MYNEWT_VAL_BLE_LL_CONN_EVENT_END_MARGIN (0)
 #endif
 
+#ifndef MYNEWT_VAL_BLE_LL_RESOLV_RPA_CACHE_SIZE
+#define MYNEWT_VAL_BLE_LL_RESOLV_RPA_CACHE_SIZE (16)
+#endif
+
+#ifndef MYNEWT_VAL_BLE_LL_SCHED_INDEX_LEVELS
+#define MYNEWT_VAL_BLE_LL_SCHED_INDEX_LEVELS ((MYNEWT_VAL_BLE_MAX_CONNECTIONS) > 32 ? 2 : 0)
+#endif
+
 #ifndef MYNEWT_VAL_BLE_FEM_LNA
 #define MYNEWT_VAL_BLE_FEM_LNA (0)
 #endif
@@ -256,6 +264,22 @@
 #define MYNEWT_VAL_BLE_SM_LVL (0)
 #endif
 
+#ifndef MYNEWT_VAL_TINYCRYPT_UECC_GEN_COMB
+#ifdef CONFIG_BT_NIMBLE_TINYCRYPT_ECC_GEN_COMB
+#define MYNEWT_VAL_TINYCRYPT_UECC_GEN_COMB (CONFIG_BT_NIMBLE_TINYCRYPT_ECC_GEN_COMB)
+#else
+#define MYNEWT_VAL_TINYCRYPT_UECC_GEN_COMB (1)
+#endif
+#endif
+
+#ifndef MYNEWT_VAL_OS_TRACE_RING_SIZE
+#ifdef CONFIG_BT_NIMBLE_TRACE_RING_SIZE
+#define MYNEWT_VAL_OS_TRACE_RING_SIZE (CONFIG_BT_NIMBLE_TRACE_RING_SIZE)
+#else
+#define MYNEWT_VAL_OS_TRACE_RING_SIZE (0)
+#endif
+#endif
+
 #endif /* !ESP_PLATFORM */
 
 #if 0
@@ -1152,6 +1176,10 @@
 #define MYNEWT_VAL_BLE_MESH_CRPL (10)
 #endif
 
+#ifndef MYNEWT_VAL_BLE_MESH_RPL_INDEX
+#define MYNEWT_VAL_BLE_MESH_RPL_INDEX ((MYNEWT_VAL_BLE_MESH_CRPL) >= 16)
+#endif
+
 /* Overridden by apps/blemesh (defined by @apache-mynewt-nimble/nimble/host/mesh) */
 #ifndef MYNEWT_VAL_BLE_MESH_DEBUG
 #define MYNEWT_VAL_BLE_MESH_DEBUG (1)
@@ -1347,6 +1375,10 @@
 #define MYNEWT_VAL_BLE_MESH_MSG_CACHE_SIZE (10)
 #endif
 
+#ifndef MYNEWT_VAL_BLE_MESH_MSG_CACHE_INDEX
+#define MYNEWT_VAL_BLE_MESH_MSG_CACHE_INDEX ((MYNEWT_VAL_BLE_MESH_MSG_CACHE_SIZE) > 64)
+#endif
+
 #ifndef MYNEWT_VAL_BLE_MESH_NODE_ID_TIMEOUT
 #define MYNEWT_VAL_BLE_MESH_NODE_ID_TIMEOUT (60)
 #endif
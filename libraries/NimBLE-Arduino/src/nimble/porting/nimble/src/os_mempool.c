@@ -23,6 +23,7 @@
 
 #include "nimble/porting/nimble/include/os/os.h"
 #include "nimble/porting/nimble/include/os/os_trace_api.h"
+#include "nimble/porting/nimble/include/os/os_trace_ring.h"
 
 #include <string.h>
 #include <assert.h>
@@ -153,6 +154,7 @@ os_mempool_init_internal(struct os_mempool *mp, uint16_t blocks,
     mp->mp_num_free = blocks;
     mp->mp_min_free = blocks;
     mp->mp_flags = flags;
+    mp->mp_num_fail = 0;
     mp->mp_num_blocks = blocks;
     mp->mp_membuf_addr = (uint32_t)(uintptr_t)membuf;
     mp->name = name;
@@ -263,6 +265,7 @@ os_mempool_clear(struct os_mempool *mp)
     /* cleanup the memory pool structure */
     mp->mp_num_free = mp->mp_num_blocks;
     mp->mp_min_free = mp->mp_num_blocks;
+    mp->mp_num_fail = 0;
     os_mempool_poison(mp, (void *)mp->mp_membuf_addr);
     os_mempool_guard(mp, (void *)mp->mp_membuf_addr);
     SLIST_FIRST(mp) = (void *)(uintptr_t)mp->mp_membuf_addr;
@@ -366,12 +369,17 @@ os_memblock_get(struct os_mempool *mp)
             if (mp->mp_min_free > mp->mp_num_free) {
                 mp->mp_min_free = mp->mp_num_free;
             }
+        } else if (mp->mp_num_fail != UINT16_MAX) {
+            mp->mp_num_fail++;
         }
         OS_EXIT_CRITICAL(sr);
 
         if (block) {
             os_mempool_poison_check(mp, block);
             os_mempool_guard_check(mp, block);
+        } else {
+            os_trace_ring_rec(OS_TRACE_RING_ID_MEMPOOL_EMPTY, mp->mp_block_size,
+                              mp->mp_num_blocks, (uint32_t)(uintptr_t)mp);
         }
     }
 
@@ -458,6 +466,17 @@ done:
     return ret;
 }
 
+void
+os_mempool_stats_clear(struct os_mempool *mp)
+{
+    os_sr_t sr;
+
+    OS_ENTER_CRITICAL(sr);
+    mp->mp_min_free = mp->mp_num_free;
+    mp->mp_num_fail = 0;
+    OS_EXIT_CRITICAL(sr);
+}
+
 struct os_mempool *
 os_mempool_info_get_next(struct os_mempool *mp, struct os_mempool_info *omi)
 {
@@ -477,6 +496,7 @@ os_mempool_info_get_next(struct os_mempool *mp, struct os_mempool_info *omi)
     omi->omi_num_blocks = cur->mp_num_blocks;
     omi->omi_num_free = cur->mp_num_free;
     omi->omi_min_free = cur->mp_min_free;
+    omi->omi_num_fail = cur->mp_num_fail;
     strncpy(omi->omi_name, cur->name, sizeof(omi->omi_name) - 1);
     omi->omi_name[sizeof(omi->omi_name) - 1] = '\0';
 
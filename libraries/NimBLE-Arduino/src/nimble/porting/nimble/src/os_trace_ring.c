@@ -0,0 +1,222 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "nimble/porting/nimble/include/syscfg/syscfg.h"
+
+#if MYNEWT_VAL(OS_TRACE_RING_SIZE)
+
+#include <string.h>
+#include "nimble/porting/nimble/include/os/os.h"
+#include "nimble/porting/nimble/include/os/os_trace_ring.h"
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#else
+#include "nimble/porting/nimble/include/os/os_cputime.h"
+#endif
+
+#define OS_TRACE_RING_SIZE      MYNEWT_VAL(OS_TRACE_RING_SIZE)
+
+#if OS_TRACE_RING_SIZE > 32768
+#error "OS_TRACE_RING_SIZE must not exceed 32768"
+#endif
+
+/* Lap of a record as stored in it, never 0 so that unused entries are not
+ * taken for records of the first lap.
+ */
+#define OS_TRACE_RING_LAP(idx)  ((uint8_t)(((idx) / OS_TRACE_RING_SIZE) % 255 + 1))
+
+#ifdef ESP_PLATFORM
+#define OS_TRACE_RING_TS_FREQ   (1000000)
+#else
+#define OS_TRACE_RING_TS_FREQ   MYNEWT_VAL(OS_CPUTIME_FREQ)
+#endif
+
+#define OS_TRACE_RING_DUMP_CHUNK    (8)
+
+struct os_trace_ring g_os_trace_ring = {
+    .hdr = {
+        .magic = OS_TRACE_RING_MAGIC,
+        .rec_size = sizeof(struct os_trace_ring_rec),
+        .num_recs = OS_TRACE_RING_SIZE,
+        .ts_freq = OS_TRACE_RING_TS_FREQ,
+    },
+};
+
+static inline uint32_t
+os_trace_ring_ts(void)
+{
+#ifdef ESP_PLATFORM
+    return (uint32_t)esp_timer_get_time();
+#else
+    return os_cputime_get32();
+#endif
+}
+
+static inline uint32_t
+os_trace_ring_reserve(void)
+{
+#if defined(__ARM_ARCH_6M__)
+    /* No atomic read-modify-write on Cortex-M0 */
+    uint32_t idx;
+    os_sr_t sr;
+
+    OS_ENTER_CRITICAL(sr);
+    idx = g_os_trace_ring.hdr.head++;
+    OS_EXIT_CRITICAL(sr);
+
+    return idx;
+#else
+    uint32_t idx;
+
+    idx = __atomic_fetch_add(&g_os_trace_ring.hdr.head, 1, __ATOMIC_RELAXED);
+
+    /* Orders the new head before the stores to the record, a reader which
+     * copied part of the record then also sees the head and drops the copy.
+     */
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    return idx;
+#endif
+}
+
+void
+os_trace_ring_put(uint8_t id, uint16_t arg0, uint32_t arg1, uint32_t arg2)
+{
+    struct os_trace_ring_rec *rec;
+    uint32_t idx;
+
+    idx = os_trace_ring_reserve();
+    rec = &g_os_trace_ring.recs[idx & (OS_TRACE_RING_SIZE - 1)];
+
+    rec->ts = os_trace_ring_ts();
+    rec->id = id;
+    rec->arg0 = arg0;
+    rec->arg1 = arg1;
+    rec->arg2 = arg2;
+
+    /* Readers take the record once the lap matches */
+    __atomic_store_n(&rec->lap, OS_TRACE_RING_LAP(idx), __ATOMIC_RELEASE);
+}
+
+int
+os_trace_ring_read(uint32_t *pos, struct os_trace_ring_rec *recs, int max)
+{
+    struct os_trace_ring_rec *rec;
+    uint32_t first;
+    uint32_t head;
+    uint32_t idx;
+    int32_t drop;
+    int cnt;
+
+    head = __atomic_load_n(&g_os_trace_ring.hdr.head, __ATOMIC_ACQUIRE);
+    if (head - *pos > OS_TRACE_RING_SIZE) {
+        *pos = head - OS_TRACE_RING_SIZE;
+    }
+
+    idx = *pos;
+    for (cnt = 0; (cnt < max) && (idx != head); cnt++, idx++) {
+        rec = &g_os_trace_ring.recs[idx & (OS_TRACE_RING_SIZE - 1)];
+        if (__atomic_load_n(&rec->lap, __ATOMIC_ACQUIRE) !=
+            OS_TRACE_RING_LAP(idx)) {
+            /* Reserved but not written yet */
+            break;
+        }
+        recs[cnt] = *rec;
+    }
+
+    /* Writers reserve an entry before overwriting it, so the records
+     * copied before the oldest one still in the ring may be torn.
+     */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    head = __atomic_load_n(&g_os_trace_ring.hdr.head, __ATOMIC_RELAXED);
+    first = head - OS_TRACE_RING_SIZE;
+    drop = (int32_t)(first - *pos);
+    if (drop > 0) {
+        if (drop >= cnt) {
+            *pos = first;
+            return 0;
+        }
+        memmove(recs, recs + drop, (cnt - drop) * sizeof(*recs));
+        cnt -= drop;
+        *pos += drop;
+    }
+
+    *pos += cnt;
+
+    return cnt;
+}
+
+int
+os_trace_ring_dump(os_trace_ring_out_fn *out, void *arg)
+{
+    struct os_trace_ring_rec recs[OS_TRACE_RING_DUMP_CHUNK];
+    struct os_trace_ring_rec lost;
+    struct os_trace_ring_hdr hdr;
+    uint32_t prev;
+    uint32_t pos;
+    uint32_t end;
+    int total;
+    int max;
+    int cnt;
+
+    /* Only the records written before the dump started, a busy ring would
+     * never end otherwise.
+     */
+    hdr = g_os_trace_ring.hdr;
+    hdr.head = __atomic_load_n(&g_os_trace_ring.hdr.head, __ATOMIC_ACQUIRE);
+    hdr.num_recs = 0;
+    out(&hdr, sizeof(hdr), arg);
+
+    end = hdr.head;
+    pos = end > OS_TRACE_RING_SIZE ? end - OS_TRACE_RING_SIZE : 0;
+    total = 0;
+
+    while ((int32_t)(end - pos) > 0) {
+        max = end - pos;
+        if (max > OS_TRACE_RING_DUMP_CHUNK) {
+            max = OS_TRACE_RING_DUMP_CHUNK;
+        }
+
+        prev = pos;
+        cnt = os_trace_ring_read(&pos, recs, max);
+        if ((cnt == 0) && (pos == prev)) {
+            /* Next record is still being written or was overwritten by a
+             * writer of an earlier lap finishing late, skip it.
+             */
+            pos++;
+        }
+
+        if (pos - cnt != prev) {
+            memset(&lost, 0, sizeof(lost));
+            lost.id = OS_TRACE_RING_ID_LOST;
+            lost.arg1 = pos - cnt - prev;
+            out(&lost, sizeof(lost), arg);
+            total++;
+        }
+
+        if (cnt) {
+            out(recs, cnt * sizeof(recs[0]), arg);
+            total += cnt;
+        }
+    }
+
+    return total;
+}
+
+#endif
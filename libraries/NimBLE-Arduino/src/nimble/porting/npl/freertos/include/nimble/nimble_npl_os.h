@@ -401,7 +401,9 @@ static inline bool ble_npl_hw_is_in_critical(void)
 
 #ifndef ESP_PLATFORM
 #define IRAM_ATTR
+#ifndef NIMBLE_CFG_CONTROLLER
 #define NIMBLE_CFG_CONTROLLER 1
+#endif
 #define NIMBLE_EVT_QUEUE_SIZE 4
 #else
 #define NIMBLE_EVT_QUEUE_SIZE 32
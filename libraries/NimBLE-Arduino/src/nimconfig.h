@@ -166,12 +166,43 @@
  */
 // #define CONFIG_NIMBLE_CPP_ADDR_FMT_UPPERCASE 1
 
+/**
+ * @brief Un-comment to change the number of erased scan results kept for reuse.
+ * @details Reusing these avoids a heap allocation for each new device found, set to 0 to disable.
+ */
+// #define CONFIG_NIMBLE_CPP_SCAN_DEVICE_POOL_SIZE 8
+
+/**
+ * @brief Un-comment to change the number of new scan devices held for their scan response or next fragment.
+ * @details Only used with scan filters, see NimBLEScan::addServiceUUIDFilter.
+ */
+// #define CONFIG_NIMBLE_CPP_SCAN_HELD_DEVICES 8
+
+/**
+ * @brief Un-comment to change the default number of notifications a NimBLENotifyStream sends per connection interval.
+ * @details Raise this if the controller can fit more packets in a connection event.
+ */
+// #define CONFIG_NIMBLE_CPP_NOTIFY_STREAM_PACKETS_PER_EVENT 4
+
 /**
  * @brief Un-comment to use mbedtls instead of tinycrypt.
  * @details This could save approximately 8k of flash if already using mbedtls for other functionality.
  */
 // #define CONFIG_BT_NIMBLE_CRYPTO_STACK_MBEDTLS 1
 
+/**
+ * @brief Un-comment to compute public keys with the same ladder as the DH key instead of a precomputed table.
+ * @details The table makes generating a pairing key pair approximately 3 times faster for approximately 1k of flash.
+ */
+// #define CONFIG_BT_NIMBLE_TINYCRYPT_ECC_GEN_COMB 0
+
+/**
+ * @brief Un-comment and set to a power of 2 to record timestamped trace events in a ring of that many entries.
+ * @details Each entry uses 16 bytes of RAM. Records HCI command/event, ATT request, connection event and
+ * scheduler timing as well as memory pool depletion, see extras/ble_trace_decode.py.
+ */
+// #define CONFIG_BT_NIMBLE_TRACE_RING_SIZE 256
+
 /**********************************
  End Arduino user-config
 **********************************/
@@ -332,6 +363,22 @@
 #define MYNEWT_VAL_BLE_CRYPTO_STACK_MBEDTLS (CONFIG_BT_NIMBLE_CRYPTO_STACK_MBEDTLS)
 #endif
 
+#ifndef CONFIG_BT_NIMBLE_TINYCRYPT_ECC_GEN_COMB
+#define CONFIG_BT_NIMBLE_TINYCRYPT_ECC_GEN_COMB 1
+#endif
+
+#ifndef MYNEWT_VAL_TINYCRYPT_UECC_GEN_COMB
+#define MYNEWT_VAL_TINYCRYPT_UECC_GEN_COMB (CONFIG_BT_NIMBLE_TINYCRYPT_ECC_GEN_COMB)
+#endif
+
+#ifndef CONFIG_BT_NIMBLE_TRACE_RING_SIZE
+#define CONFIG_BT_NIMBLE_TRACE_RING_SIZE 0
+#endif
+
+#ifndef MYNEWT_VAL_OS_TRACE_RING_SIZE
+#define MYNEWT_VAL_OS_TRACE_RING_SIZE (CONFIG_BT_NIMBLE_TRACE_RING_SIZE)
+#endif
+
 #ifdef ESP_PLATFORM
 #ifndef CONFIG_BTDM_CONTROLLER_MODE_BLE_ONLY
 #define CONFIG_BTDM_CONTROLLER_MODE_BLE_ONLY
@@ -418,6 +465,18 @@ defined(CONFIG_IDF_TARGET_ESP32C3) || defined(CONFIG_IDF_TARGET_ESP32S3)
 #define CONFIG_NIMBLE_CPP_FREERTOS_TASK_BLOCK_BIT 31
 #endif
 
+#ifndef CONFIG_NIMBLE_CPP_SCAN_DEVICE_POOL_SIZE
+#define CONFIG_NIMBLE_CPP_SCAN_DEVICE_POOL_SIZE 8
+#endif
+
+#ifndef CONFIG_NIMBLE_CPP_SCAN_HELD_DEVICES
+#define CONFIG_NIMBLE_CPP_SCAN_HELD_DEVICES 8
+#endif
+
+#ifndef CONFIG_NIMBLE_CPP_NOTIFY_STREAM_PACKETS_PER_EVENT
+#define CONFIG_NIMBLE_CPP_NOTIFY_STREAM_PACKETS_PER_EVENT 4
+#endif
+
 #if CONFIG_NIMBLE_CPP_DEBUG_ASSERT_ENABLED && !defined NDEBUG
 void nimble_cpp_assert(const char *file, unsigned line) __attribute((weak, noreturn));
 # define NIMBLE_ATT_VAL_FILE  (__builtin_strrchr(__FILE__, '/') ? \
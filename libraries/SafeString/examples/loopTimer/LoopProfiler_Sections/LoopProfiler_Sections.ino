@@ -0,0 +1,61 @@
+// LoopProfiler_Sections.ino
+// Latency histograms for the loop and for sections of code
+#include <loopProfiler.h>
+#include <BufferedOutput.h>
+// install SafeString library from Library manager or from https://www.forward.com.au/pfod/ArduinoProgramming/SafeString/index.html
+// to get BufferedOutput. See https://www.forward.com.au/pfod/ArduinoProgramming/Serial_IO/index.html for a full tutorial
+// on Arduino Serial I/O that Works
+#include <millisDelay.h>
+
+createBufferedOutput(bufferedOut, 80, DROP_UNTIL_EMPTY);
+// the CSV and histogram report is longer than bufferedOut, so it blocks until sent instead of dropping lines
+createBufferedOutput(reportOut, 80, BLOCK_IF_FULL);
+
+loopProfileSection loopSection("loop"); // time between loop() calls
+loopProfileSection stallSection("stall"); // time spent in stallTask()
+
+millisDelay stallDelay;
+millisDelay csvDelay;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(115200);
+  for (int i = 10; i > 0; i--) {
+    Serial.println(i);
+    delay(500);
+  }
+  bufferedOut.connect(Serial);  // connect buffered stream to Serial
+  reportOut.connect(Serial);
+  stallDelay.start(1000); // stall for 40ms every 1sec
+  csvDelay.start(60000); // print CSV and the loop histogram every 60sec
+}
+
+// the task method, a blocking delay to show up in the histograms
+void stallTask() {
+  stallSection.begin();
+  if (stallDelay.justFinished()) {
+    stallDelay.repeat();
+    delay(40);
+  }
+  stallSection.end();
+}
+
+// the task method
+void printCSV() {
+  if (csvDelay.justFinished()) {
+    csvDelay.repeat();
+    bufferedOut.flush(); // finish the pending output first
+    loopProfiler.printCSV(reportOut); // copy this output to compare firmware builds
+    loopSection.printHistogram(reportOut);
+    reportOut.flush(); // the next loop() records this delay once a minute
+  }
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  loopSection.check(); // record the time since the last loop()
+  bufferedOut.nextByteOut(); // call at least once per loop to release chars
+  loopProfiler.check(bufferedOut); // print p50 p99 p999 max for each section every 5sec
+  stallTask();
+  printCSV();
+}
@@ -25,6 +25,30 @@
 // so for ALL boards require serialPtr->availableForWrite() > 1 before writing to serialPtr
 // MegaTinyCore does not have availableForWrite() in Stream or HardwareSerial
 
+// ESP32 drainInBackground() creates txMutex, after that all public methods that touch the ringBuffer hold it
+// the mutex is recursive as write( ) calls nextByteOut() etc.
+#if defined(ARDUINO_ARCH_ESP32)
+class BufferedOutputLock {
+  public:
+    BufferedOutputLock(SemaphoreHandle_t _mutex) {
+      mutex = _mutex;
+      if (mutex) {
+        xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+      }
+    }
+    ~BufferedOutputLock() {
+      if (mutex) {
+        xSemaphoreGiveRecursive(mutex);
+      }
+    }
+  private:
+    SemaphoreHandle_t mutex;
+};
+#define BUFFERED_OUTPUT_LOCK() BufferedOutputLock rbLock(txMutex)
+#else
+#define BUFFERED_OUTPUT_LOCK()
+#endif
+
 /**
     use
     createBufferedOutput(name, size, mode);
@@ -75,6 +99,10 @@ BufferedOutput::BufferedOutput( size_t _bufferSize, uint8_t _buf[],  BufferedOut
   }
   us_perByte = 0;
   sendTimerStart = 0;
+#if defined(ARDUINO_ARCH_ESP32)
+  txMutex = NULL;
+  txTask = NULL;
+#endif
 }
 
 /**
@@ -228,6 +256,7 @@ size_t BufferedOutput::getSize() {
 
 // prevents current buffer contects from being cleared by clearSpace(), but clear() will still clear the whole buffer
 void BufferedOutput::protect() {
+  BUFFERED_OUTPUT_LOCK();
   if (rb_lastBufferedByteProtect()) {
     return;
   } else {
@@ -240,6 +269,7 @@ void BufferedOutput::protect() {
 // clears space in outgoing (write) buffer, by removing last bytes written, until a protected section reached
 //  the Serial Tx buffer is NOT changed
 int BufferedOutput::clearSpace(size_t len) {
+  BUFFERED_OUTPUT_LOCK();
   waitForEmpty = false;
   allOrNothing = false; // force something next write
   int avail = internalAvailableForWrite(); // already subtracts 4 from rb_buffer
@@ -266,6 +296,7 @@ int BufferedOutput::clearSpace(size_t len) {
 // only clears the BufferedOutput buffer not any HardwareSerial buffer
 // clears BufferedOutput buffer even if protected with protect()
 void BufferedOutput::clear() {
+  BUFFERED_OUTPUT_LOCK();
   bool notEmpty = (rb_available() != 0);
   rb_clear();
   if (notEmpty) {
@@ -334,6 +365,7 @@ int BufferedOutput::availableForWrite() {
   if (!streamPtr) {
     return 0;
   }
+  BUFFERED_OUTPUT_LOCK();
   nextByteOut(); // try sending first to free some buffer space
   if (waitForEmpty) {
     return 0;
@@ -345,6 +377,7 @@ int BufferedOutput::availableForWrite() {
 // note should not get \r without \n because if
 // \r\n trucated to \r the will have \r~~\r\n due to dropMark
 size_t BufferedOutput::terminateLastLine() {
+  BUFFERED_OUTPUT_LOCK();
   if (lastCharWritten != '\n') {
     if (internalAvailableForWrite() >= 2) {
       return write((const uint8_t*)"\r\n", 2);
@@ -361,6 +394,7 @@ size_t BufferedOutput::write(const uint8_t *buffer, size_t size) {
   if (!streamPtr) {
     return 0;
   }
+  BUFFERED_OUTPUT_LOCK();
   nextByteOut(); // sets waitForEmpty false if !DROP_UNTIL_EMPTY
   if (mode == BLOCK_IF_FULL) { // ignores all or nothing
     for (size_t i = 0; i < size; i++) {
@@ -441,6 +475,7 @@ size_t BufferedOutput::write(uint8_t c) {
   if (!streamPtr) {
     return 0;
   }
+  BUFFERED_OUTPUT_LOCK();
 #ifdef DEBUG
   bool showDelay = true;
 #endif // DEBUG    
@@ -528,6 +563,7 @@ void BufferedOutput::nextByteOut() {
   //  delay(5000);
     return;
   }
+  BUFFERED_OUTPUT_LOCK();
   if (inNextByteOut) {
     return;
   }
@@ -565,13 +601,7 @@ void BufferedOutput::nextByteOut() {
         toWrite = rbAvail;
       }
       serialBytesWritten = (toWrite > 0); //set once here
-      for (int i = 0; i < toWrite; i++) {
-        uint8_t b = (uint8_t)rb_read();
-        if (b) {
-          streamPtr->write(b);
-        }
-        // else  skip protect bytes '\0'
-      }
+      rb_writeTo(streamPtr, toWrite); // skips protect bytes '\0'
     }
     // here have either filled txBuffer OR emptied rb_buffer
     // if serialBytesWritten then wrote to txBuffer
@@ -657,11 +687,43 @@ void BufferedOutput::flush() {
   if (!streamPtr) {
     return;
   }
+  BUFFERED_OUTPUT_LOCK();
   while (bytesToBeSent() != 0) {
     nextByteOut();
   }
 }
 
+#if defined(ARDUINO_ARCH_ESP32)
+// ESP32 only, start a task to call nextByteOut() every tick
+bool BufferedOutput::drainInBackground(uint32_t stackSize, UBaseType_t priority) {
+  if (txTask) {
+    return true; // already running
+  }
+  if ((!streamPtr) || (txBufferSize == 0)) {
+    return false; // not connected or releasing at baudRate
+  }
+  if (!txMutex) {
+    txMutex = xSemaphoreCreateRecursiveMutex();
+    if (!txMutex) {
+      return false;
+    }
+  }
+  if (xTaskCreate(txTaskLoop, "BufferedOutput", stackSize, this, priority, &txTask) != pdPASS) {
+    txTask = NULL;
+    return false;
+  }
+  return true;
+}
+
+void BufferedOutput::txTaskLoop(void *arg) {
+  BufferedOutput *bufferedOutput = (BufferedOutput *)arg;
+  for (;;) {
+    bufferedOutput->nextByteOut();
+    vTaskDelay(1); // at 115200 only ~12 bytes are sent per 1ms tick, much less than the Serial Tx buffer
+  }
+}
+#endif
+
 //===============  ringBuffer methods ==============
 // write() will silently fail if ringbuffer is full
 
@@ -740,6 +802,38 @@ void BufferedOutput::rb_dump(Stream * streamPtr) {
   streamPtr->println("-");
 }
 
+// writes upto len bytes to the stream using one write(buf,size) for each contiguous block
+// '\0' protect bytes are removed but not written
+// returns the number of bytes removed from the ringBuffer, including any '\0'
+size_t BufferedOutput::rb_writeTo(Stream * streamPtr, size_t len) {
+  if (len > rb_buffer_count) {
+    len = rb_buffer_count;
+  }
+  size_t removed = 0;
+  while (removed < len) {
+    size_t run = rb_bufSize - rb_buffer_tail; // upto the end of rb_buf
+    if (run > (len - removed)) {
+      run = len - removed;
+    }
+    const uint8_t* start = rb_buf + rb_buffer_tail;
+    const uint8_t* protectByte = (const uint8_t*)memchr(start, '\0', run);
+    size_t n = protectByte ? (size_t)(protectByte - start) : run;
+    if (n) {
+      streamPtr->write(start, n);
+    }
+    if (protectByte) {
+      n++; // skip the '\0'
+    }
+    rb_buffer_tail += n;
+    if (rb_buffer_tail >= rb_bufSize) {
+      rb_buffer_tail = 0; // wrap around
+    }
+    rb_buffer_count -= n;
+    removed += n;
+  }
+  return removed;
+}
+
 int BufferedOutput::rb_read() {
   if (rb_buffer_count == 0) {
     return -1;
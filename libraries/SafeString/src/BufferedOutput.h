@@ -31,11 +31,20 @@
     output.read(); // can also read from output, not buffered reads directly from Serial.
    ...
    }
+
+  On ESP32, when connected to a HardwareSerial (or a Stream with availableForWrite()), in setup() after connect( ) you can call
+  output.drainInBackground();
+  to start a FreeRTOS task that moves the buffered bytes into Serial's Tx buffer, so output continues while the loop() is blocked.
 */
 
 #include <Print.h>
 #include <Printable.h>
 #include "SafeString.h"  // for Output and #define SSTRING_DEBUG and stream support
+#if defined(ARDUINO_ARCH_ESP32)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#endif
 
 // handle namespace arduino
 #include "SafeStringNameSpaceStart.h"
@@ -116,10 +125,25 @@ class BufferedOutput : public Stream {
      
      This must be called often, at least every loop().<br>
      It releases one or more bytes if there is space available in the Serial Tx buffer<br>
-     <b>OR</b> if a baud rate is set, then at that rate.
+     <b>OR</b> if a baud rate is set, then at that rate.<br>
+     When using the Serial Tx buffer, as many bytes as fit are written with one write(buf,len) call per contiguous block of the ring buffer.
     */
     
     void nextByteOut();
+
+#if defined(ARDUINO_ARCH_ESP32)
+    /**
+     bool drainInBackground(uint32_t stackSize = 2048, UBaseType_t priority = 1);
+
+     ESP32 only. Call in setup() after connect( ).<br>
+     Starts a FreeRTOS task that calls nextByteOut() every tick, so the buffered output is released even when the loop() is blocked.<br>
+     Only works when availableForWrite() is used to throttle output, i.e. not with connect(stream, baudRate).<br>
+     After this call all BufferedOutput methods lock the buffer, so it can also be printed to from other tasks.
+
+     @return true if the task is running
+    */
+    bool drainInBackground(uint32_t stackSize = 2048, UBaseType_t priority = 1);
+#endif
     
     /**
     write(uint8_t b)  
@@ -211,6 +235,11 @@ class BufferedOutput : public Stream {
     int txBufferSize; // serial tx buffer, if any OR set to zero to only use ringBuffer
     bool dropMarkWritten;
     uint8_t lastCharWritten; // check for \n
+#if defined(ARDUINO_ARCH_ESP32)
+    SemaphoreHandle_t txMutex; // non-NULL after drainInBackground()
+    TaskHandle_t txTask;
+    static void txTaskLoop(void *arg);
+#endif
 
     // ringBuffer methods
     /**
@@ -232,6 +261,7 @@ class BufferedOutput : public Stream {
     size_t rb_getSize(); // size of ring buffer
     bool rb_lastBufferedByteProtect();
     void rb_dump(Stream* streamPtr);
+    size_t rb_writeTo(Stream* streamPtr, size_t len); // bulk write upto len bytes, skipping '\0', returns bytes removed from ringBuffer
 
     uint8_t* rb_buf;
     uint16_t rb_bufSize;
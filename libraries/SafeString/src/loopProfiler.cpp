@@ -0,0 +1,247 @@
+// loopProfiler.cpp
+
+#include <limits.h>
+#include "loopProfiler.h"
+
+loopProfileSection *loopProfileSection::first = NULL;
+
+// index of highest set bit, v must be != 0
+static inline uint8_t msb32(uint32_t v) {
+#if ULONG_MAX == 0xFFFFFFFFUL
+  return 31 - __builtin_clzl(v);
+#else
+  return 63 - __builtin_clzl(v);
+#endif
+}
+
+// name of this section, added to the front of the section list
+loopProfileSection::loopProfileSection(const char * _name) {
+  name = _name;
+  next = first;
+  first = this;
+  clear();
+}
+
+void loopProfileSection::begin() {
+  started = true;
+  start_us = micros(); // start timing <<<<<<<<<<<<<<<<
+}
+
+void loopProfileSection::end() {
+  uint32_t us = micros(); // stop timing <<<<<<<<<<<<<<<<
+  if (!started) {
+    return;
+  }
+  started = false;
+  record(us - start_us);
+}
+
+void loopProfileSection::check() {
+  uint32_t us = micros(); // stop timing <<<<<<<<<<<<<<<<
+  if (checked) {
+    record(us - start_us);
+  }
+  checked = true;
+  start_us = micros(); // start timing again, ignore the time spent recording
+}
+
+// 0,1 are exact, then 2 buckets for each power of 2
+uint8_t loopProfileSection::bucketIndex(uint32_t us) {
+  if (us < 2) {
+    return us;
+  }
+  uint8_t msb = msb32(us);
+  if (msb >= (LOOP_PROFILER_BUCKETS / 2)) {
+    return LOOP_PROFILER_BUCKETS - 1;
+  }
+  return (msb << 1) | ((us >> (msb - 1)) & 1);
+}
+
+uint32_t loopProfileSection::bucketLower_us(uint8_t idx) {
+  if (idx < 2) {
+    return idx;
+  }
+  uint8_t msb = idx >> 1;
+  return (((uint32_t)1) << msb) | (((uint32_t)(idx & 1)) << (msb - 1));
+}
+
+uint32_t loopProfileSection::bucketUpper_us(uint8_t idx) {
+  if (idx >= (LOOP_PROFILER_BUCKETS - 1)) {
+    return 0xFFFFFFFFUL;
+  }
+  return bucketLower_us(idx + 1) - 1;
+}
+
+void loopProfileSection::record(uint32_t us) {
+  uint8_t idx = bucketIndex(us);
+  if (buckets[idx] == ((loopProfileCount_t)~((loopProfileCount_t)0))) {
+    halveCounts(); // keep the shape of the histogram
+  }
+  buckets[idx]++;
+  count++;
+  if (us > max_us) {
+    max_us = us;
+  }
+}
+
+// rounds up so that a single long stall is never lost
+void loopProfileSection::halveCounts() {
+  for (uint8_t i = 0; i < LOOP_PROFILER_BUCKETS; i++) {
+    buckets[i] = (buckets[i] >> 1) + (buckets[i] & 1);
+  }
+}
+
+uint32_t loopProfileSection::percentile(uint16_t perMille) const {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < LOOP_PROFILER_BUCKETS; i++) {
+    total += buckets[i];
+  }
+  if (total == 0) {
+    return 0;
+  }
+  if (perMille > 1000) {
+    perMille = 1000;
+  }
+  // rank of the measurement at this percentile, only calculated when printing
+  uint32_t rank = total - ((total / 1000) * (1000 - perMille)) - (((total % 1000) * (1000 - perMille)) / 1000);
+  if (rank == 0) {
+    rank = 1;
+  }
+  uint32_t sum = 0;
+  for (uint8_t i = 0; i < LOOP_PROFILER_BUCKETS; i++) {
+    sum += buckets[i];
+    if (sum >= rank) {
+      uint32_t upper = bucketUpper_us(i);
+      return (upper < max_us) ? upper : max_us;
+    }
+  }
+  return max_us;
+}
+
+uint32_t loopProfileSection::getMax() const {
+  return max_us;
+}
+
+uint32_t loopProfileSection::getCount() const {
+  return count;
+}
+
+const char* loopProfileSection::getName() const {
+  return name ? name : "section";
+}
+
+loopProfileSection *loopProfileSection::getNext() const {
+  return next;
+}
+
+loopProfileSection *loopProfileSection::getFirst() {
+  return first;
+}
+
+void loopProfileSection::clear() {
+  started = false;
+  checked = false;
+  start_us = 0;
+  count = 0;
+  max_us = 0;
+  for (uint8_t i = 0; i < LOOP_PROFILER_BUCKETS; i++) {
+    buckets[i] = 0;
+  }
+}
+
+void loopProfileSection::print(Print &out) {
+  print(&out);
+}
+
+void loopProfileSection::print(Print *out) {
+  if (out == NULL) {
+    return;
+  }
+  out->print(getName());
+  out->print(" us Latency count:"); out->print(count);
+  out->print(" p50:"); out->print(percentile(500));
+  out->print(" p99:"); out->print(percentile(990));
+  out->print(" p999:"); out->print(percentile(999));
+  out->print(" max:"); out->print(max_us);
+  out->println();
+}
+
+void loopProfileSection::printCSV(Print &out) {
+  out.print(getName()); out.print(',');
+  out.print(count); out.print(',');
+  out.print(percentile(500)); out.print(',');
+  out.print(percentile(990)); out.print(',');
+  out.print(percentile(999)); out.print(',');
+  out.print(max_us);
+  out.println();
+}
+
+void loopProfileSection::printHistogram(Print &out) {
+  out.print(getName()); out.println(" us histogram");
+  for (uint8_t i = 0; i < LOOP_PROFILER_BUCKETS; i++) {
+    if (buckets[i] == 0) {
+      continue;
+    }
+    out.print(' '); out.print(bucketLower_us(i));
+    out.print('-');
+    if (i == (LOOP_PROFILER_BUCKETS - 1)) {
+      out.print("max");
+    } else {
+      out.print(bucketUpper_us(i));
+    }
+    out.print(':'); out.print(buckets[i]);
+    out.println();
+  }
+}
+
+loopProfilerClass::loopProfilerClass() {
+  print_us_Delay.start(PRINT_US_DELAY);
+}
+
+void loopProfilerClass::check(Print &out) {
+  check(&out);
+}
+
+// if loopProfiler.check() called nothing is printed
+void loopProfilerClass::check(Print *out) {
+  if (print_us_Delay.justFinished()) {
+    print_us_Delay.restart(); // this may drift
+    print(out); // print results if out != NULL
+  }
+}
+
+void loopProfilerClass::print(Print &out) {
+  print(&out);
+}
+
+void loopProfilerClass::print(Print *out) {
+  if (out == NULL) {
+    return;
+  }
+  unsigned long us = micros();
+  for (loopProfileSection *s = loopProfileSection::getFirst(); s != NULL; s = s->getNext()) {
+    s->print(out);
+  }
+  out->print(" prt:");
+  out->println((micros() - us));
+  // skip the print time for the sections using check()
+  us = micros() - us;
+  for (loopProfileSection *s = loopProfileSection::getFirst(); s != NULL; s = s->getNext()) {
+    if (s->checked) {
+      s->start_us += us;
+    }
+  }
+}
+
+void loopProfilerClass::printCSV(Print &out) {
+  out.println("name,count,p50_us,p99_us,p999_us,max_us");
+  for (loopProfileSection *s = loopProfileSection::getFirst(); s != NULL; s = s->getNext()) {
+    s->printCSV(out);
+  }
+}
+
+void loopProfilerClass::clear() {
+  for (loopProfileSection *s = loopProfileSection::getFirst(); s != NULL; s = s->getNext()) {
+    s->clear();
+  }
+}
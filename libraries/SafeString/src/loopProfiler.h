@@ -0,0 +1,112 @@
+#ifndef LOOP_PROFILER_H
+#define LOOP_PROFILER_H
+// loopProfiler.h
+
+#include <Arduino.h>
+
+// download millisDelay from https://www.forward.com.au/pfod/ArduinoProgramming/TimingDelaysInArduino.html
+#include <millisDelay.h>
+
+/**************
+  loopProfileSection keeps a log scaled latency histogram for a named section of code.<br>
+  Where loopTimer only keeps the max and average over 5sec, the histogram shows how often a long delay happens,
+  e.g. a 40ms stall once an hour or every second.<br>
+
+  Create one loopProfileSection per section you want to time, e.g.<br>
+  <code>loopProfileSection ntpSection("ntp");</code><br>
+  then surround the code with begin()/end()<br>
+  <code>ntpSection.begin();<br>
+  updateNTP();<br>
+  ntpSection.end();</code><br>
+  or, like loopTimer.check(), call<br>
+  <code>loopSection.check();</code><br>
+  once each loop() to record the time between calls.<br>
+
+  Recording a time does not use any division and uses fixed memory, LOOP_PROFILER_BUCKETS counters per section.<br>
+  Each power of 2 of us is split into 2 buckets, so the percentiles are accurate to within 50% (upper bound of the bucket is reported).<br>
+  Times >= 2^(LOOP_PROFILER_BUCKETS/2) us (about 16.7sec for the default 48 buckets) are counted in the last bucket.<br>
+
+  The predefined **loopProfiler** object prints all the sections every 5 sec<br>
+  <code>loopProfiler.check(bufferedOut);</code><br>
+  Sample output is:-<br>
+  <code>ntp us Latency count:4960 p50:3 p99:23 p999:47 max:40312</code><br>
+
+  The output can be sent to any Print, e.g. BufferedOutput, a Telnet client or an HTTP response (AsyncResponseStream),
+  or a SafeString. Use printCSV() for output that is easy to compare between firmware builds, and
+  printHistogram() to list the non-zero buckets.<br>
+****************************************************************************************/
+
+#ifndef LOOP_PROFILER_BUCKETS
+#define LOOP_PROFILER_BUCKETS 48
+#endif
+
+#if defined(ARDUINO_ARCH_AVR)
+typedef uint16_t loopProfileCount_t; // save RAM on UNO etc, buckets are halved when one fills up
+#else
+typedef uint32_t loopProfileCount_t;
+#endif
+
+class loopProfileSection {
+  public:
+    loopProfileSection(const char *_name); // name of this section, sections are linked into a list for loopProfiler
+    void begin(); // start timing this section
+    void end(); // stop timing and record the us since begin(), ignored if begin() not called
+    void check(); // record the us since the last call to check(), like loopTimer.check()
+    void record(uint32_t us); // add a measurement to the histogram, no division
+
+    uint32_t percentile(uint16_t perMille) const; // e.g. 500 for p50, 990 for p99, 999 for p999, returns upper bound of bucket in us
+    uint32_t getMax() const; // max us recorded
+    uint32_t getCount() const; // number of measurements recorded
+    const char* getName() const;
+    void clear(); // clears all previous data
+
+    void print(Print &out); // name count p50 p99 p999 max
+    void print(Print *out);
+    void printCSV(Print &out); // name,count,p50,p99,p999,max
+    void printHistogram(Print &out); // non-zero buckets as lower-upper:count
+
+    static uint32_t bucketLower_us(uint8_t idx); // smallest us counted in this bucket
+    static uint32_t bucketUpper_us(uint8_t idx); // largest us counted in this bucket
+    static uint8_t bucketIndex(uint32_t us); // bucket that this us is counted in
+
+    loopProfileSection *getNext() const; // next section in the list or NULL
+    static loopProfileSection *getFirst(); // first section or NULL if none
+
+  private:
+    friend class loopProfilerClass; // to skip the print time
+    void halveCounts();
+    const char *name;
+    bool started; // true between begin() and end()
+    bool checked; // true after first call to check()
+    uint32_t start_us; // begin() or last check() time
+    uint32_t count; // number recorded
+    uint32_t max_us; // max recorded
+    loopProfileCount_t buckets[LOOP_PROFILER_BUCKETS];
+    loopProfileSection *next;
+    static loopProfileSection *first;
+};
+
+/**************
+  loopProfilerClass prints all the loopProfileSections.<br>
+  <code>loopProfiler.check(Serial);</code><br>
+  prints all sections every 5 sec, <code>loopProfiler.check();</code> does nothing.<br>
+  Use <code>loopProfiler.print(out)</code> or <code>loopProfiler.printCSV(out)</code> to print when you want to,
+  e.g. from a Telnet command or web page handler.
+****************************************************************************************/
+class loopProfilerClass {
+  public:
+    loopProfilerClass();
+    void check(Print *out = NULL); // prints all sections every 5 sec if out != NULL
+    void check(Print &out);
+    void print(Print &out); // prints all sections
+    void print(Print *out);
+    void printCSV(Print &out); // prints header line then all sections as CSV
+    void clear(); // clears all sections
+
+  private:
+    unsigned long PRINT_US_DELAY = 5000; // ms print every 5 sec
+    millisDelay print_us_Delay;
+};
+
+static loopProfilerClass loopProfiler;
+#endif // LOOP_PROFILER_H
@@ -34,7 +34,7 @@ bool TSPoint::operator!=(TSPoint p1) {
   return  ((p1.x != x) || (p1.y != y) || (p1.z != z));
 }
 
-#if (NUMSAMPLES > 2)
+#if (NUMSAMPLES > 2) || (TS_POLL_SAMPLES > 2)
 static void insert_sort(int array[], uint8_t size) {
   uint8_t j;
   int save;
@@ -133,6 +133,16 @@ TSPoint TouchScreen::getPoint(void) {
    int z1 = analogRead(_xm); 
    int z2 = analogRead(_yp);
 
+   z = calcPressure(z1, z2, x);
+
+   if (! valid) {
+     z = 0;
+   }
+
+   return TSPoint(x, y, z);
+}
+
+int16_t TouchScreen::calcPressure(int z1, int z2, int x) {
    if (_rxplate != 0) {
      // now read the x 
      float rtouch;
@@ -143,16 +153,122 @@ TSPoint TouchScreen::getPoint(void) {
      rtouch *= _rxplate;
      rtouch /= 1024;
      
-     z = rtouch;
+     return rtouch;
    } else {
-     z = (1023-(z2-z1));
+     return (1023-(z2-z1));
    }
+}
 
-   if (! valid) {
-     z = 0;
-   }
+// phases of poll()
+#define TS_POLL_X  0
+#define TS_POLL_Y  1
+#define TS_POLL_Z1 2
+#define TS_POLL_Z2 3
 
-   return TSPoint(x, y, z);
+void TouchScreen::initPoll(void) {
+  _pollPhase = TS_POLL_X;
+  _pollCount = 0;
+  _filterShift = 1;
+  _pollX = _pollY = _pollZ1 = 0;
+  _lastTouching = false;
+  _lastPoint = TSPoint(0, 0, 0);
+  _lastPointTime = 0;
+}
+
+bool TouchScreen::poll(void) {
+  int sample;
+  switch (_pollPhase) {
+    case TS_POLL_X:
+      pinMode(_yp, INPUT);
+      pinMode(_ym, INPUT);
+      digitalWrite(_yp, LOW);
+      digitalWrite(_ym, LOW);
+      pinMode(_xp, OUTPUT);
+      digitalWrite(_xp, HIGH);
+      pinMode(_xm, OUTPUT);
+      digitalWrite(_xm, LOW);
+      sample = analogRead(_yp);
+      break;
+    case TS_POLL_Y:
+      pinMode(_xp, INPUT);
+      pinMode(_xm, INPUT);
+      digitalWrite(_xp, LOW);
+      digitalWrite(_xm, LOW);
+      pinMode(_yp, OUTPUT);
+      digitalWrite(_yp, HIGH);
+      pinMode(_ym, OUTPUT);
+      digitalWrite(_ym, LOW);
+      sample = analogRead(_xm);
+      break;
+    default: // TS_POLL_Z1 and TS_POLL_Z2
+      // Set X+ to ground, Y- to VCC, Hi-Z X- and Y+
+      pinMode(_xp, OUTPUT);
+      digitalWrite(_xp, LOW);
+      pinMode(_ym, OUTPUT);
+      digitalWrite(_ym, HIGH);
+      digitalWrite(_xm, LOW);
+      pinMode(_xm, INPUT);
+      digitalWrite(_yp, LOW);
+      pinMode(_yp, INPUT);
+      sample = analogRead((_pollPhase == TS_POLL_Z1) ? _xm : _yp);
+      break;
+  }
+
+  if (_pollPhase == TS_POLL_Z1) {
+    _pollZ1 = sample;
+    _pollPhase = TS_POLL_Z2;
+    return false;
+  }
+  if (_pollPhase != TS_POLL_Z2) {
+    _pollSamples[_pollCount++] = sample;
+    if (_pollCount < TS_POLL_SAMPLES) {
+      return false;
+    }
+    _pollCount = 0;
+#if TS_POLL_SAMPLES > 2
+    insert_sort(_pollSamples, TS_POLL_SAMPLES);
+#endif
+    if (_pollPhase == TS_POLL_X) {
+      _pollX = 1023 - _pollSamples[TS_POLL_SAMPLES/2];
+      _pollPhase = TS_POLL_Y;
+    } else {
+      _pollY = 1023 - _pollSamples[TS_POLL_SAMPLES/2];
+      _pollPhase = TS_POLL_Z1;
+    }
+    return false;
+  }
+
+  // TS_POLL_Z2, publish the new point
+  _pollPhase = TS_POLL_X;
+  int16_t z = calcPressure(_pollZ1, sample, _pollX);
+  bool touching = (z > pressureThreshhold);
+  int16_t x = _pollX;
+  int16_t y = _pollY;
+  if (touching && _lastTouching && _filterShift) {
+    // IIR only while the touch continues, so a new touch is not dragged from the last one
+    x = _lastPoint.x + ((x - _lastPoint.x) >> _filterShift);
+    y = _lastPoint.y + ((y - _lastPoint.y) >> _filterShift);
+  }
+  _lastTouching = touching;
+  _lastPoint = TSPoint(x, y, z);
+  _lastPointTime = millis();
+  return true;
+}
+
+TSPoint TouchScreen::getLastPoint(void) {
+  return _lastPoint;
+}
+
+unsigned long TouchScreen::getLastPointTime(void) {
+  return _lastPointTime;
+}
+
+bool TouchScreen::isLastPointTouching(void) {
+  return _lastTouching;
+}
+
+void TouchScreen::setFilterShift(uint8_t shift) {
+  _filterShift = shift;
 }
 
 TouchScreen::TouchScreen(uint8_t xp, uint8_t yp, uint8_t xm, uint8_t ym) {
@@ -162,6 +278,7 @@ TouchScreen::TouchScreen(uint8_t xp, uint8_t yp, uint8_t xm, uint8_t ym) {
   _xp = xp;
   _rxplate = 0;
   pressureThreshhold = 10;
+  initPoll();
 }
 
 
@@ -174,6 +291,7 @@ TouchScreen::TouchScreen(uint8_t xp, uint8_t yp, uint8_t xm, uint8_t ym,
   _rxplate = rxplate;
 
   pressureThreshhold = 10;
+  initPoll();
 }
 
 int TouchScreen::readTouchX(void) {
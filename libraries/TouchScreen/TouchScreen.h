@@ -7,6 +7,11 @@
 #define _ADAFRUIT_TOUCHSCREEN_H_
 #include <stdint.h>
 
+// number of samples per axis for poll(), the median is used
+#ifndef TS_POLL_SAMPLES
+#define TS_POLL_SAMPLES 3
+#endif
+
 class TSPoint {
  public:
   TSPoint(void);
@@ -30,9 +35,30 @@ class TouchScreen {
   TSPoint getPoint();
   int16_t pressureThreshhold;
 
+  // non-blocking alternative to getPoint(), call poll() each loop()
+  // each call does one analogRead, so it only blocks for a single ADC conversion.
+  // The X, Y and Z phases run over successive calls and a new point is published
+  // every (2 * TS_POLL_SAMPLES + 2) calls.
+  // Like getPoint(), poll() leaves the touch pins as it set them, restore any pins
+  // shared with the display after each call.
+  bool poll(void); // returns true when a new point was published
+  TSPoint getLastPoint(void); // latest point, x,y filtered while touching
+  unsigned long getLastPointTime(void); // millis() when the latest point was published
+  bool isLastPointTouching(void); // latest point z > pressureThreshhold
+  void setFilterShift(uint8_t shift); // x,y IIR filter, x += (new - x) >> shift, 0 is off, default 1
+
 private:
+  void initPoll(void);
+  int16_t calcPressure(int z1, int z2, int x);
   uint8_t _yp, _ym, _xm, _xp;
   uint16_t _rxplate;
+
+  uint8_t _pollPhase, _pollCount, _filterShift;
+  int _pollSamples[TS_POLL_SAMPLES];
+  int _pollX, _pollY, _pollZ1;
+  bool _lastTouching;
+  TSPoint _lastPoint;
+  unsigned long _lastPointTime;
 };
 
 #endif
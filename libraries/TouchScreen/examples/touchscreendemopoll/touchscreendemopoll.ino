@@ -0,0 +1,44 @@
+// Touch screen library with X Y and Z (pressure) readings as well
+// as oversampling to avoid 'bouncing'
+// This demo uses the non-blocking poll() instead of getPoint(), public domain
+
+#include <stdint.h>
+#include "TouchScreen.h"
+
+// These are the pins for the shield!
+#define YP A1  // must be an analog pin, use "An" notation!
+#define XM A2  // must be an analog pin, use "An" notation!
+#define YM 7   // can be a digital pin
+#define XP 6   // can be a digital pin
+
+#define MINPRESSURE 10
+#define MAXPRESSURE 1000
+
+// For better pressure precision, we need to know the resistance
+// between X+ and X- Use any multimeter to read it
+// For the one we're using, its 300 ohms across the X plate
+TouchScreen ts = TouchScreen(XP, YP, XM, YM, 300);
+
+void setup(void) {
+  Serial.begin(9600);
+}
+
+void loop(void) {
+  // one ADC sample per loop, true when a new point is ready
+  bool newPoint = ts.poll();
+  // the analog touch pins are shared with the display control pins on most shields
+  pinMode(XM, OUTPUT);
+  pinMode(YP, OUTPUT);
+
+  if (newPoint) {
+    TSPoint p = ts.getLastPoint();
+    if (p.z > MINPRESSURE && p.z < MAXPRESSURE) {
+      Serial.print("X = "); Serial.print(p.x);
+      Serial.print("\tY = "); Serial.print(p.y);
+      Serial.print("\tPressure = "); Serial.print(p.z);
+      Serial.print("\tms = "); Serial.println(ts.getLastPointTime());
+    }
+  }
+
+  // redraw the display here, it is never blocked for more than one ADC conversion
+}
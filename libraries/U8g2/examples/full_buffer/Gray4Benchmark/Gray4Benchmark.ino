@@ -0,0 +1,175 @@
+/*
+
+  Gray4Benchmark.ino
+
+  Time of a 256x64 frame on 4 bit gray scale displays (SSD1322, SSD1362):
+    - conversion of the monochrome frame with the bit loop and with the lookup table
+    - sendBuffer() with the monochrome buffer (conversion and transfer)
+    - sendBuffer() with the 4 bit gray scale buffer (transfer only)
+  After the measurement, a gray scale picture with anti-aliased text is shown.
+  The results are written to the serial monitor.
+  The gray scale buffer requires 8 KB RAM in addition to the monochrome buffer.
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Distributed under the 2-clause BSD license of U8g2, see LICENSE.
+
+*/
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+#ifdef U8X8_HAVE_HW_SPI
+#include <SPI.h>
+#endif
+#ifdef U8X8_HAVE_HW_I2C
+#include <Wire.h>
+#endif
+
+
+/*
+  U8g2lib Example Overview:
+    Frame Buffer Examples: clearBuffer/sendBuffer. Fast, but may not work with all Arduino boards because of RAM consumption
+    Page Buffer Examples: firstPage/nextPage. Less RAM usage, should work with all Arduino boards.
+    U8x8 Text Only Example: No RAM usage, direct communication with display controller. No graphics, 8x8 Text only.
+    
+*/
+
+// Please UNCOMMENT one of the contructor lines below
+// U8g2 Contructor List (Frame Buffer)
+// The complete list is available here: https://github.com/olikraus/u8g2/wiki/u8g2setupcpp
+// Please update the pin numbers according to your setup. Use U8X8_PIN_NONE if the reset pin is not connected
+//U8G2_SSD1322_NHD_256X64_F_4W_SW_SPI u8g2(U8G2_R0, /* clock=*/ 13, /* data=*/ 11, /* cs=*/ 10, /* dc=*/ 9, /* reset=*/ 8);	// Enable U8G2_16BIT in u8g2.h
+//U8G2_SSD1322_NHD_256X64_F_4W_HW_SPI u8g2(U8G2_R0, /* cs=*/ 10, /* dc=*/ 9, /* reset=*/ 8);	// Enable U8G2_16BIT in u8g2.h
+//U8G2_SSD1322_ZJY_256X64_F_4W_SW_SPI u8g2(U8G2_R0, /* clock=*/ 13, /* data=*/ 11, /* cs=*/ 10, /* dc=*/ 9, /* reset=*/ 8);	// Enable U8G2_16BIT in u8g2.h
+//U8G2_SSD1322_ZJY_256X64_F_4W_HW_SPI u8g2(U8G2_R0, /* cs=*/ 10, /* dc=*/ 9, /* reset=*/ 8);	// Enable U8G2_16BIT in u8g2.h
+//U8G2_SSD1362_256X64_F_4W_SW_SPI u8g2(U8G2_R0, /* clock=*/ 13, /* data=*/ 11, /* cs=*/ 10, /* dc=*/ 9, /* reset=*/ 8);	// Enable U8G2_16BIT in u8g2.h
+//U8G2_SSD1362_256X64_F_4W_HW_SPI u8g2(U8G2_R0, /* cs=*/ 10, /* dc=*/ 9, /* reset=*/ 8);	// Enable U8G2_16BIT in u8g2.h
+
+// End of constructor list
+
+
+#define FRAMES 20
+
+uint8_t gray_buf[256*64/2];	// 4 bit per pixel
+uint8_t tile_buf[32];
+uint8_t *mono_buf;
+uint8_t mono_tile_height;
+
+/* the conversion of a tile before the lookup table was introduced */
+uint8_t *convertTileBitLoop(uint8_t *ptr) {
+  uint8_t v;
+  uint8_t a,b;
+  uint8_t i, j;
+  uint8_t *dest;
+  
+  for( j = 0; j < 4; j++ ) {
+    dest = tile_buf;
+    dest += j;
+    a = *ptr++;
+    b = *ptr++;
+    for( i = 0; i < 8; i++ ) {
+      v = 0;
+      if ( a&1 ) v |= 0xf0;
+      if ( b&1 ) v |= 0x0f;
+      *dest = v;
+      dest+=4;
+      a >>= 1;
+      b >>= 1;
+    }
+  }
+  return tile_buf;
+}
+
+/* convert all tiles of the 256x64 monochrome frame, returns microseconds per frame */
+uint32_t measureConversion(uint8_t is_lut) {
+  uint32_t t;
+  uint16_t i;
+  uint8_t f;
+  uint8_t *ptr;
+  
+  t = micros();
+  for( f = 0; f < FRAMES; f++ ) {
+    ptr = mono_buf;
+    for( i = 0; i < 32*8; i++ ) {
+      if ( is_lut )
+        u8x8_ConvertTileTo4bpp(tile_buf, ptr, 4, 4);
+      else
+        convertTileBitLoop(ptr);
+      ptr += 8;
+    }
+  }
+  return (micros() - t) / FRAMES;
+}
+
+uint32_t measureSendBuffer(void) {
+  uint32_t t;
+  uint8_t f;
+  
+  t = micros();
+  for( f = 0; f < FRAMES; f++ )
+    u8g2.sendBuffer();
+  return (micros() - t) / FRAMES;
+}
+
+void drawMono(void) {
+  u8g2.clearBuffer();
+  u8g2.setFont(u8g2_font_ncenB14_tr);
+  u8g2.drawStr(0, 20, "Monochrome");
+  u8g2.drawFrame(0, 30, 256, 34);
+  u8g2.drawDisc(200, 46, 14);
+}
+
+void drawGray(void) {
+  uint8_t i;
+  u8g2.clearBuffer();
+  for( i = 0; i < 16; i++ ) {
+    u8g2.setGrayLevel(i);
+    u8g2.drawBox(i*16, 40, 16, 24);
+  }
+  u8g2.setGrayLevel(15);
+  u8g2.setFont(u8g2_font_ncenB14_tr);
+  u8g2.drawStr(0, 17, "Gray");
+  u8g2.drawStrAA(60, 17, "Anti-Aliased");
+  u8g2.setGrayLevel(6);
+  u8g2.drawDisc(230, 18, 14);
+  u8g2.setGrayLevel(15);
+  u8g2.setDrawColor(2);
+  u8g2.drawStrAA(178, 36, "XOR");
+  u8g2.setDrawColor(1);
+}
+
+void setup(void) {
+  Serial.begin(9600);
+  u8g2.begin();
+  mono_buf = u8g2.getBufferPtr();
+  mono_tile_height = u8g2.getBufferTileHeight();
+}
+
+void loop(void) {
+  uint32_t t_loop, t_lut, t_mono, t_gray;
+
+  /* monochrome frame buffer, converted to 4 bit in the display driver */
+  u8g2_SetupBuffer(u8g2.getU8g2(), mono_buf, mono_tile_height, u8g2_ll_hvline_vertical_top_lsb, U8G2_R0);
+  drawMono();
+  t_loop = measureConversion(0);
+  t_lut = measureConversion(1);
+  t_mono = measureSendBuffer();
+  
+  /* 4 bit frame buffer, sent without conversion */
+  u8g2.setGray4Buffer(gray_buf, 8);
+  drawGray();
+  t_gray = measureSendBuffer();
+
+  Serial.print(F("256x64 conversion: bit loop "));
+  Serial.print(t_loop);
+  Serial.print(F("us  lookup table "));
+  Serial.print(t_lut);
+  Serial.print(F("us  sendBuffer: monochrome "));
+  Serial.print(t_mono);
+  Serial.print(F("us  gray "));
+  Serial.print(t_gray);
+  Serial.println(F("us"));
+
+  delay(2000);
+}
@@ -395,6 +395,13 @@ Versatile_RotaryEncoder versatile_encoder(clk, dt, sw);
 
 MUIU8G2 mui;
 
+/*
+  The current form is compiled into this list, so that draw() and the cursor 
+  movement do not need to parse the form definition again. 
+  The size should be the number of elements of the largest form (form 10: 11 elements).
+*/
+mui_field_t mui_field_list[12];
+
 /*
   global variables which form the communication gateway between the user interface and the rest of the code
 */
@@ -540,6 +547,7 @@ void setup(void) {
   
   u8g2.begin();
   mui.begin(u8g2, fds_data, muif_list, sizeof(muif_list)/sizeof(muif_t));
+  mui.setFieldList(mui_field_list, sizeof(mui_field_list)/sizeof(mui_field_t));
   mui.gotoForm(/* form_id= */ 1, /* initial_cursor_position= */ 0);
 }
 
@@ -0,0 +1,135 @@
+/*
+
+  DisplayListBenchmark.ino
+
+  Frame time of the picture loop with and without the display list.
+  The display list records the picture during the first pass of the picture loop.
+  All pages are then drawn from the recording, so that draw() is called only once per frame.
+  The results are written to the serial monitor.
+
+  The display list is disabled by default: Uncomment
+  #define U8G2_WITH_DISPLAY_LIST in src/clib/u8g2.h
+
+  This sketch draws a small picture. "make bench" in extras/host runs the
+  page_buffer/GraphicsTest example with and without a display list on the host.
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Distributed under the 2-clause BSD license of U8g2, see LICENSE.
+
+*/
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+#ifdef U8X8_HAVE_HW_SPI
+#include <SPI.h>
+#endif
+#ifdef U8X8_HAVE_HW_I2C
+#include <Wire.h>
+#endif
+
+// Please UNCOMMENT one of the contructor lines below
+// U8g2 Contructor List (Picture Loop Page Buffer)
+// The complete list is available here: https://github.com/olikraus/u8g2/wiki/u8g2setupcpp
+// Please update the pin numbers according to your setup. Use U8X8_PIN_NONE if the reset pin is not connected
+//U8G2_NULL u8g2(U8G2_R0);	// null device, a 8x8 pixel display which does nothing
+//U8G2_SSD1306_128X64_NONAME_1_4W_SW_SPI u8g2(U8G2_R0, /* clock=*/ 13, /* data=*/ 11, /* cs=*/ 10, /* dc=*/ 9, /* reset=*/ 8);
+//U8G2_SSD1306_128X64_NONAME_1_4W_HW_SPI u8g2(U8G2_R0, /* cs=*/ 10, /* dc=*/ 9, /* reset=*/ 8);
+//U8G2_SSD1306_128X64_NONAME_1_HW_I2C u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);
+//U8G2_SH1106_128X64_NONAME_1_HW_I2C u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);
+//U8G2_ST7920_128X64_1_SW_SPI u8g2(U8G2_R0, /* clock=*/ 13, /* data=*/ 11, /* CS=*/ 10, /* reset=*/ 8);
+//U8G2_ST7565_EA_DOGM128_1_4W_HW_SPI u8g2(U8G2_R0, /* cs=*/ 10, /* dc=*/ 9, /* reset=*/ 8);
+//U8G2_UC1701_EA_DOGS102_1_4W_HW_SPI u8g2(U8G2_R0, /* cs=*/ 10, /* dc=*/ 9, /* reset=*/ 8);
+//U8G2_PCD8544_84X48_1_4W_HW_SPI u8g2(U8G2_R0, /* cs=*/ 10, /* dc=*/ 9, /* reset=*/ 8);	// Nokia 5110 Display
+// End of constructor list
+
+
+/* a picture with text, boxes, circles and lines, a is the animation step 0..7 */
+void draw(uint8_t a) {
+  u8g2.setFont(u8g2_font_6x10_tf);
+  u8g2.setFontPosTop();
+  u8g2.drawStr(10+a*2, 2, "U8g2");
+  u8g2.drawStr(10, 14, "Display List");
+  u8g2.drawFrame(0, 0, u8g2.getDisplayWidth(), u8g2.getDisplayHeight());
+  u8g2.drawBox(5, 28, 20, 10);
+  u8g2.drawBox(10+a, 33, 30, 7);
+  u8g2.drawDisc(60, 38, 9);
+  u8g2.drawCircle(84+a, 38, 7);
+  u8g2.drawLine(7+a, 50, 60, 60);
+  u8g2.drawLine(7+a*4, 50, 100, 60);
+}
+
+#ifdef U8G2_WITH_DISPLAY_LIST
+
+/*
+  Buffer for the display list, the required size is shown in the results.
+  If a picture does not fit, the picture loop is executed for each page as usual.
+*/
+#ifdef __AVR__
+#define DL_SIZE 256
+#else
+#define DL_SIZE 1024
+#endif
+u8g2_dl_t dl;
+uint8_t dl_buf[DL_SIZE];
+
+/* draw 64 frames, return the average time per frame in microseconds */
+uint32_t measure(void) {
+  uint32_t t;
+  uint8_t i;
+  t = micros();
+  for( i = 0; i < 64; i++ ) {
+    u8g2.firstPage();
+    do {
+      draw(i&7);
+    } while( u8g2.nextPage() );
+  }
+  t = micros() - t;
+  return t / 64;
+}
+
+void setup(void) {
+  Serial.begin(9600);
+  u8g2.begin();
+}
+
+void loop(void) {
+  uint32_t t_page, t_dl;
+
+  u8g2.setDisplayList(NULL, NULL, 0);
+  t_page = measure();
+
+  u8g2.setDisplayList(&dl, dl_buf, DL_SIZE);
+  t_dl = measure();
+
+  Serial.print(F("Page buffer: "));
+  Serial.print(t_page);
+  Serial.print(F("us/frame  Display list: "));
+  Serial.print(t_dl);
+  Serial.print(F("us/frame  Display list size: "));
+  Serial.print(u8g2.getDisplayListLen());
+  Serial.print(F(" of "));
+  Serial.print(DL_SIZE);
+  Serial.println(F(" bytes"));
+
+  delay(1000);
+}
+
+#else
+
+void setup(void) {
+  Serial.begin(9600);
+  u8g2.begin();
+}
+
+void loop(void) {
+  u8g2.firstPage();
+  do {
+    draw(0);
+  } while( u8g2.nextPage() );
+  Serial.println(F("Uncomment #define U8G2_WITH_DISPLAY_LIST in src/clib/u8g2.h"));
+  delay(1000);
+}
+
+#endif
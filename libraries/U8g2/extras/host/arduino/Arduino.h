@@ -0,0 +1,64 @@
+/*
+
+  Arduino.h
+  
+  Minimal Arduino API for the host build of the U8g2 examples, see ../Makefile.
+  Time is simulated: delay() and each frame advance millis(), see bench.cpp
+
+*/
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "Print.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define A6 20
+#define A7 21
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define F(s) (s)
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+
+class HardwareSerial : public Print
+{
+  public:
+    void begin(unsigned long baud) { (void)baud; }
+    size_t write(uint8_t c);
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+void setup(void);
+void loop(void);
+
+#endif
@@ -0,0 +1,92 @@
+/*
+
+  Print.h
+  
+  Minimal Arduino Print class for the host build of the U8g2 examples.
+
+*/
+
+#ifndef HOST_PRINT_H
+#define HOST_PRINT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print
+{
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+      size_t n = 0;
+      while( size-- > 0 )
+        n += write(*buffer++);
+      return n;
+    }
+    size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned long n, int base = DEC) { return printNumber(n, base); }
+    size_t print(long n, int base = DEC) 
+    {
+      if ( n < 0 && base == DEC )
+        return print('-') + printNumber(-(unsigned long)n, base);
+      return printNumber((unsigned long)n, base);
+    }
+    size_t print(unsigned char n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(int n, int base = DEC) { return print((long)n, base); }
+    size_t print(double d, int digits = 2) 
+    {
+      size_t n = 0;
+      unsigned long i;
+      if ( d < 0.0 )
+      {
+        n += print('-');
+        d = -d;
+      }
+      i = (unsigned long)d;
+      n += print(i);
+      if ( digits > 0 )
+        n += print('.');
+      d -= (double)i;
+      while( digits-- > 0 )
+      {
+        d *= 10.0;
+        n += print((char)('0' + (int)d));
+        d -= (double)(int)d;
+      }
+      return n;
+    }
+    
+    size_t println(void) { return write((const uint8_t *)"\r\n", 2); }
+    template <class T> size_t println(T v) { size_t n = print(v); return n + println(); }
+    template <class T> size_t println(T v, int b) { size_t n = print(v, b); return n + println(); }
+    
+  private:
+    size_t printNumber(unsigned long n, int base)
+    {
+      char buf[8*sizeof(long)+1];
+      char *s = buf + sizeof(buf) - 1;
+      *s = '\0';
+      if ( base < 2 )
+        base = 10;
+      do
+      {
+        char c = n % base;
+        n /= base;
+        *--s = c < 10 ? c + '0' : c + 'A' - 10;
+      } while( n > 0 );
+      return write(s);
+    }
+};
+
+#endif
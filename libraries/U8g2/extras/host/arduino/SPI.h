@@ -0,0 +1 @@
+/* SPI.h: not used by the memory display of the host build */
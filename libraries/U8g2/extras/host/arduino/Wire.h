@@ -0,0 +1 @@
+/* Wire.h: not used by the memory display of the host build */
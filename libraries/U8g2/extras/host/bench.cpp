@@ -0,0 +1,238 @@
+/*
+
+  bench.cpp
+  
+  Benchmark runner for the host build of the U8g2 examples, see Makefile.
+  
+  The sketch (HOST_SKETCH) is executed on the memory display (u8x8_d_memory.c)
+  for each display geometry. After the requested number of frames, the 
+  sketch is stopped and the frames/sec and the bus bytes per frame are reported.
+  A frame is one u8g2 picture: sendBuffer() or a complete firstPage/nextPage loop.
+  
+  usage: bench [-n <frames>] [-g <w>x<h>,...] [-d <dir>]
+    -n  number of frames for each geometry (default 500)
+    -g  comma separated list of display sizes in pixel, multiple of 8
+    -d  write each frame as PBM file into <dir> (golden image tests)
+  
+  With HOST_DISPLAY_LIST, the page buffer sketch is executed with a display list
+  of that many bytes (requires U8G2_WITH_DISPLAY_LIST) and the largest recording
+  is reported.
+  
+  The time is simulated: millis() advances with delay() and with each frame
+  (HOST_FRAME_MS), so the output only depends on the sketch and the frame count.
+  The menu "next" button is pressed every 40 frames.
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Distributed under the 2-clause BSD license of U8g2, see LICENSE.
+
+*/
+
+#include "u8g2_host.h"
+#include <stdio.h>
+#include <setjmp.h>
+#include <time.h>
+
+#ifndef HOST_SKETCH
+#define HOST_SKETCH "sketch"
+#endif
+
+/* 0: full buffer, 1: page buffer with one tile row */
+#ifndef HOST_PAGE_MODE
+#define HOST_PAGE_MODE 0
+#endif
+
+/* size of the display list in bytes, 0: no display list */
+#ifndef HOST_DISPLAY_LIST
+#define HOST_DISPLAY_LIST 0
+#endif
+
+#define HOST_FRAME_MS 10
+#define HOST_MENU_PERIOD 40
+
+/*========================================================*/
+/* Arduino API */
+
+static unsigned long host_millis;
+
+unsigned long millis(void) { return host_millis; }
+unsigned long micros(void) { return host_millis*1000UL; }
+void delay(unsigned long ms) { host_millis += ms; }
+void delayMicroseconds(unsigned int us) { (void)us; }
+void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+void digitalWrite(uint8_t pin, uint8_t val) { (void)pin; (void)val; }
+int digitalRead(uint8_t pin) { (void)pin; return HIGH; }
+
+size_t HardwareSerial::write(uint8_t c) { return fputc(c, stderr) == EOF ? 0 : 1; }
+HardwareSerial Serial;
+
+/*========================================================*/
+/* memory display */
+
+static uint8_t host_init_ram[8];
+static uint8_t host_init_buf[8];
+static uint32_t host_frame_limit;
+static uint32_t host_frames = 500;
+static const char *host_pbm_dir;
+static FILE *host_pbm_fp;
+static jmp_buf host_jmp;
+#if HOST_DISPLAY_LIST > 0
+static u8g2_dl_t host_dl;
+static uint8_t host_dl_buf[HOST_DISPLAY_LIST];
+static uint16_t host_dl_max;
+#endif
+
+/* menu buttons are low active, press "next" for some frames */
+static uint8_t host_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+  (void)arg_int;
+  (void)arg_ptr;
+  switch(msg)
+  {
+    case U8X8_MSG_GPIO_MENU_NEXT:
+      u8x8_SetGPIOResult(u8x8, u8x8_memory.frame_cnt % HOST_MENU_PERIOD < 4 ? 0 : 1);
+      break;
+    case U8X8_MSG_GPIO_MENU_SELECT:
+    case U8X8_MSG_GPIO_MENU_PREV:
+    case U8X8_MSG_GPIO_MENU_HOME:
+    case U8X8_MSG_GPIO_MENU_UP:
+    case U8X8_MSG_GPIO_MENU_DOWN:
+      u8x8_SetGPIOResult(u8x8, 1);
+      break;
+  }
+  return 1;
+}
+
+U8G2_MEMORY u8g2(U8G2_R0, 1, 1, host_init_ram, host_init_buf, 1, host_gpio_and_delay);
+
+static void host_pbm_out(const char *s)
+{
+  fputs(s, host_pbm_fp);
+}
+
+static void host_frame_cb(u8x8_t *u8x8)
+{
+  char name[512];
+  (void)u8x8;
+  host_millis += HOST_FRAME_MS;
+#if HOST_DISPLAY_LIST > 0
+  if ( host_dl_max < u8g2.getDisplayListLen() )
+    host_dl_max = u8g2.getDisplayListLen();
+#endif
+  if ( host_pbm_dir != NULL )
+  {
+    snprintf(name, sizeof(name), "%s/%s_%ux%u_%04lu.pbm", host_pbm_dir, HOST_SKETCH, 
+      u8x8_memory.display_info.pixel_width, u8x8_memory.display_info.pixel_height, (unsigned long)u8x8_memory.frame_cnt);
+    for( char *p = name + strlen(host_pbm_dir) + 1; *p != '\0'; p++ )
+      if ( *p == '/' )
+        *p = '_';
+    host_pbm_fp = fopen(name, "w");
+    if ( host_pbm_fp != NULL )
+    {
+      u8x8_memory_WritePBM(host_pbm_out);
+      fclose(host_pbm_fp);
+    }
+  }
+  if ( u8x8_memory.frame_cnt >= host_frame_limit )
+    longjmp(host_jmp, 1);	/* stop the sketch */
+}
+
+static double host_time(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+/* execute the sketch for the given display size, return 0 if the memory allocation failed */
+static int host_run(unsigned w, unsigned h)
+{
+  uint8_t tw = w/8, th = h/8;
+  uint8_t *ram = (uint8_t *)malloc((size_t)tw*th*8);
+  uint8_t *buf = (uint8_t *)malloc((size_t)tw*th*8);
+  static volatile double t;
+  double f;
+  
+  if ( ram == NULL || buf == NULL )
+  {
+    free(ram);
+    free(buf);
+    return 0;
+  }
+  u8g2_Setup_memory(u8g2.getU8g2(), U8G2_R0, tw, th, ram, buf, HOST_PAGE_MODE ? 1 : th, host_gpio_and_delay);
+  u8x8_memory.frame_cb = host_frame_cb;
+#if HOST_DISPLAY_LIST > 0
+  u8g2.setDisplayList(&host_dl, host_dl_buf, sizeof(host_dl_buf));
+  host_dl_max = 0;
+#endif
+  host_millis = 0;
+  host_frame_limit = 0xffffffffUL;
+  
+  if ( setjmp(host_jmp) == 0 )
+  {
+    setup();
+    /* do not count the frames of setup() */
+    u8x8_memory_ResetStatistics();
+    host_frame_limit = host_frames;
+    t = host_time();
+    for(;;)
+      loop();
+  }
+  t = host_time() - t;
+  
+  f = (double)u8x8_memory.frame_cnt;
+  printf("%-28s %4ux%-4u %7lu %10.0f %10.1f %8.1f %7.1f\n", HOST_SKETCH, w, h, 
+    (unsigned long)u8x8_memory.frame_cnt, 
+    t > 0.0 ? f/t : 0.0,
+    (double)(u8x8_memory.cmd_bytes + u8x8_memory.data_bytes)/f,
+    (double)u8x8_memory.cmd_bytes/f,
+    (double)u8x8_memory.transfer_cnt/f);
+#if HOST_DISPLAY_LIST > 0
+  printf("%-28s %4ux%-4u display list %u of %u bytes%s\n", HOST_SKETCH, w, h, 
+    host_dl_max, (unsigned)sizeof(host_dl_buf), host_dl_max > sizeof(host_dl_buf) ? ", too small" : "");
+#endif
+  
+  free(ram);
+  free(buf);
+  return 1;
+}
+
+int main(int argc, char **argv)
+{
+  const char *geometry = "128x64,128x32,64x48,256x64,240x128,320x240";
+  char *list, *p;
+  unsigned w, h;
+  int i;
+  
+  for( i = 1; i < argc; i++ )
+  {
+    if ( strcmp(argv[i], "-n") == 0 && i+1 < argc )
+      host_frames = strtoul(argv[++i], NULL, 10);
+    else if ( strcmp(argv[i], "-g") == 0 && i+1 < argc )
+      geometry = argv[++i];
+    else if ( strcmp(argv[i], "-d") == 0 && i+1 < argc )
+      host_pbm_dir = argv[++i];
+    else
+    {
+      fprintf(stderr, "usage: %s [-n <frames>] [-g <w>x<h>,...] [-d <dir>]\n", argv[0]);
+      return 1;
+    }
+  }
+  if ( host_frames == 0 )
+    host_frames = 1;
+  
+  printf("%-28s %9s %7s %10s %10s %8s %7s\n", "sketch", "size", "frames", "frames/s", "bytes/fr", "cmd/fr", "xfer/fr");
+  list = strdup(geometry);
+  for( p = strtok(list, ","); p != NULL; p = strtok(NULL, ",") )
+  {
+    if ( sscanf(p, "%ux%u", &w, &h) != 2 || w < 8 || h < 8 || w > 2040 || h > 2040 || w % 8 != 0 || h % 8 != 0 )
+    {
+      fprintf(stderr, "%s: size must be a multiple of 8 between 8 and 2040\n", p);
+      continue;
+    }
+    if ( host_run(w, h) == 0 )
+      fprintf(stderr, "%s: out of memory\n", p);
+  }
+  free(list);
+  return 0;
+}
@@ -0,0 +1,432 @@
+/*
+
+  fontgen.c
+
+  Writes stand-in fonts for the host build to stdout, see Makefile.
+
+  This source tree does not contain src/clib/u8g2_fonts.c. The stand-in fonts
+  have the names and about the glyph sizes, ascent and descent of the fonts,
+  which are used by the benchmark examples. The glyphs are simple patterns
+  in the u8g2 font format (run length encoded), so that the glyph decoder
+  does a similar amount of work. Frames/sec and bus bytes are close to the
+  real fonts, the pictures are not.
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Distributed under the 2-clause BSD license of U8g2, see LICENSE.
+
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#define FONT_MAX 40000
+
+struct font_desc
+{
+  const char *name;
+  uint8_t bbx_mode;		/* 0: proportional, 1: common height */
+  uint8_t is_mono;		/* all characters have the same advance */
+  uint8_t width;		/* advance of the monospace fonts, widest character of the others */
+  int8_t ascent;		/* capital A */
+  int8_t descent;		/* lower g */
+  uint16_t last;		/* last character, starting at 32, 0 for none */
+  uint16_t icon_first, icon_last;	/* icons and symbols, 0 for none */
+  uint8_t icon_w, icon_h;
+};
+
+static const struct font_desc font_list[] =
+{
+  { "u8g2_font_6x10_tf", 0, 1, 6, 7, -2, 255, 0, 0, 0, 0 },
+  { "u8g2_font_6x12_tr", 0, 1, 6, 8, -2, 127, 0, 0, 0, 0 },
+  { "u8g2_font_8x13B_tf", 0, 1, 8, 9, -2, 255, 0, 0, 0, 0 },
+  { "u8g2_font_cu12_tr", 0, 0, 7, 8, -2, 127, 0, 0, 0, 0 },
+  { "u8g2_font_cu12_hr", 1, 0, 7, 8, -2, 127, 0, 0, 0, 0 },
+  { "u8g2_font_helvB10_tr", 0, 0, 11, 10, -3, 127, 0, 0, 0, 0 },
+  { "u8g2_font_ncenB08_tr", 0, 0, 9, 8, -2, 127, 0, 0, 0, 0 },
+  { "u8g2_font_ncenB08_hr", 1, 0, 9, 8, -2, 127, 0, 0, 0, 0 },
+  { "u8g2_font_open_iconic_embedded_4x_t", 0, 0, 32, 32, 0, 0, 64, 78, 32, 32 },
+  { "u8g2_font_unifont_t_symbols", 0, 1, 8, 10, -2, 127, 0x2600, 0x26ff, 16, 14 },
+};
+
+/*========================================================================*/
+/* glyph bitmap */
+
+struct glyph
+{
+  uint16_t encoding;
+  uint8_t w, h;
+  int8_t x, y, d;
+  uint8_t pix[32*32];
+};
+
+static void glyph_set(struct glyph *g, int x, int y)
+{
+  if ( x >= 0 && x < g->w && y >= 0 && y < g->h )
+    g->pix[y*g->w+x] = 1;
+}
+
+/* a character: the outline of the ink box with one of four strokes inside */
+static void glyph_char_pattern(struct glyph *g)
+{
+  int i;
+  for( i = 0; i < g->w; i++ )
+  {
+    glyph_set(g, i, 0);
+    glyph_set(g, i, g->h-1);
+  }
+  for( i = 0; i < g->h; i++ )
+    glyph_set(g, 0, i);
+  switch(g->encoding & 3)
+  {
+    case 0:
+      for( i = 0; i < g->h; i++ )
+        glyph_set(g, g->w-1, i);
+      break;
+    case 1:
+      for( i = 0; i < g->w; i++ )
+        glyph_set(g, i, g->h/2);
+      break;
+    case 2:
+      for( i = 0; i < g->h; i++ )
+        glyph_set(g, i*g->w/g->h, i);
+      break;
+    default:
+      for( i = 0; i < g->h/2; i++ )
+        glyph_set(g, g->w-1, i+g->h/2);
+      break;
+  }
+}
+
+/* an icon: a frame around a disc, the radius depends on the encoding */
+static void glyph_icon_pattern(struct glyph *g)
+{
+  int x, y, r, cx, cy;
+  cx = g->w/2;
+  cy = g->h/2;
+  r = cx/2 + (g->encoding % 5);
+  for( y = 0; y < g->h; y++ )
+    for( x = 0; x < g->w; x++ )
+    {
+      if ( x < 2 || y < 2 || x >= g->w-2 || y >= g->h-2 )
+        glyph_set(g, x, y);
+      else if ( (x-cx)*(x-cx)+(y-cy)*(y-cy) <= r*r )
+        glyph_set(g, x, y);
+    }
+}
+
+static int is_narrow(uint16_t c)
+{
+  return strchr("!'(),.:;Iijl|`", c) != NULL;
+}
+
+static int is_wide(uint16_t c)
+{
+  return strchr("@MWmw", c) != NULL;
+}
+
+static int has_descender(uint16_t c)
+{
+  return strchr("(),;Qgjpqy", c) != NULL;
+}
+
+static void glyph_make(const struct font_desc *f, struct glyph *g, uint16_t c)
+{
+  struct glyph ink;
+  int w, top, bottom, y;
+
+  memset(g, 0, sizeof(struct glyph));
+  g->encoding = c;
+
+  if ( f->icon_last != 0 && c >= f->icon_first && c <= f->icon_last )
+  {
+    g->w = f->icon_w;
+    g->h = f->icon_h;
+    g->y = f->descent;
+    g->d = f->icon_w;
+    glyph_icon_pattern(g);
+    return;
+  }
+
+  if ( f->is_mono )
+  {
+    w = f->width - 1;
+    g->d = f->width;
+  }
+  else
+  {
+    w = f->width*2/3;
+    if ( is_narrow(c) )
+      w = 2;
+    if ( is_wide(c) )
+      w = f->width;
+    g->d = w+1;
+  }
+  if ( c == ' ' )
+    return;			/* no bitmap, only the advance */
+
+  /* lower case letters have 5/7 of the capital height */
+  top = f->ascent;
+  if ( c >= 'a' && c <= 'z' && strchr("bdfhklt", c) == NULL )
+    top = (f->ascent*5+3)/7;
+  bottom = has_descender(c) ? f->descent : 0;
+
+  memset(&ink, 0, sizeof(struct glyph));
+  ink.encoding = c;
+  ink.w = w;
+  ink.h = top - bottom;
+  glyph_char_pattern(&ink);
+
+  g->w = w;
+  g->h = ink.h;
+  g->y = bottom;
+  y = 0;
+  if ( f->bbx_mode == 1 )
+  {
+    /* common height: each glyph has the height of the font, the ink is placed inside */
+    g->h = f->ascent - f->descent;
+    g->y = f->descent;
+    y = f->ascent - top;
+  }
+  memcpy(g->pix + y*w, ink.pix, ink.w*ink.h);
+}
+
+/*========================================================================*/
+/* font encoding, see u8g2_font.c */
+
+static uint8_t bit_buf[256];
+static int bit_pos;
+
+static void bits_put(unsigned v, int cnt)
+{
+  int i;
+  for( i = 0; i < cnt; i++ )
+  {
+    if ( v & (1U<<i) )
+      bit_buf[bit_pos>>3] |= 1 << (bit_pos&7);
+    bit_pos++;
+  }
+}
+
+static void bits_put_signed(int v, int cnt)
+{
+  bits_put(v + (1<<(cnt-1)), cnt);
+}
+
+static int bits_unsigned(int max)
+{
+  int cnt = 1;
+  while ( (1<<cnt) <= max )
+    cnt++;
+  return cnt;
+}
+
+static int bits_signed(int min, int max)
+{
+  int cnt = 1;
+  while ( -(1<<(cnt-1)) > min || (1<<(cnt-1))-1 < max )
+    cnt++;
+  return cnt;
+}
+
+struct font_bits
+{
+  int w, h, x, y, d, b0, b1;
+};
+
+/* encode the glyph into bit_buf, return the number of bytes */
+static int glyph_encode(const struct glyph *g, const struct font_bits *fb)
+{
+  int n = g->w*g->h;
+  int i = 0;
+  int max0 = (1<<fb->b0)-1;
+  int max1 = (1<<fb->b1)-1;
+  int a, b, prev_a = -1, prev_b = -1;
+
+  memset(bit_buf, 0, sizeof(bit_buf));
+  bit_pos = 0;
+  bits_put(g->w, fb->w);
+  bits_put(g->h, fb->h);
+  bits_put_signed(g->x, fb->x);
+  bits_put_signed(g->y, fb->y);
+  bits_put_signed(g->d, fb->d);
+
+  while ( i < n )
+  {
+    a = 0;
+    while ( i < n && g->pix[i] == 0 && a < max0 )
+      a++, i++;
+    b = 0;
+    while ( i < n && g->pix[i] != 0 && b < max1 )
+      b++, i++;
+    if ( a == prev_a && b == prev_b )
+    {
+      /* repeat the previous pair */
+      bits_put(1, 1);
+    }
+    else
+    {
+      if ( prev_a >= 0 )
+        bits_put(0, 1);
+      bits_put(a, fb->b0);
+      bits_put(b, fb->b1);
+      prev_a = a;
+      prev_b = b;
+    }
+    if ( bit_pos > 8*250 )
+      return 256;
+  }
+  if ( prev_a >= 0 )
+    bits_put(0, 1);
+  return (bit_pos+7)/8;
+}
+
+static uint8_t font_buf[FONT_MAX];
+static struct glyph glyph_list[512];
+
+static int font_make(const struct font_desc *f)
+{
+  struct font_bits fb;
+  int cnt = 0;
+  int i, c, len;
+  int best, best_b0 = 0, best_b1 = 0;
+  int max_w = 0, max_h = 0, min_x = 0, max_x = 0, min_y = 0, max_y = 0, min_d = 0, max_d = 0;
+  int bbx_top = 0;
+  int pos, pos_A = -1, pos_a = -1, pos_unicode;
+
+  for( c = 32; c <= f->last && f->last != 0; c++ )
+  {
+    if ( c >= 128 && c < 160 )
+      continue;			/* not in the "f" fonts */
+    glyph_make(f, glyph_list+cnt++, c);
+  }
+  for( c = f->icon_first; c <= f->icon_last && f->icon_last != 0; c++ )
+    glyph_make(f, glyph_list+cnt++, c);
+
+  for( i = 0; i < cnt; i++ )
+  {
+    struct glyph *g = glyph_list+i;
+    if ( g->w > max_w ) max_w = g->w;
+    if ( g->h > max_h ) max_h = g->h;
+    if ( g->x < min_x ) min_x = g->x;
+    if ( g->x > max_x ) max_x = g->x;
+    if ( g->y < min_y ) min_y = g->y;
+    if ( g->y > max_y ) max_y = g->y;
+    if ( g->y + g->h > bbx_top ) bbx_top = g->y + g->h;
+    if ( g->d < min_d ) min_d = g->d;
+    if ( g->d > max_d ) max_d = g->d;
+  }
+  fb.w = bits_unsigned(max_w);
+  fb.h = bits_unsigned(max_h);
+  fb.x = bits_signed(min_x, max_x);
+  fb.y = bits_signed(min_y, max_y);
+  fb.d = bits_signed(min_d, max_d);
+
+  /* run length bits with the smallest font */
+  best = FONT_MAX;
+  for( fb.b0 = 2; fb.b0 <= 8; fb.b0++ )
+    for( fb.b1 = 2; fb.b1 <= 8; fb.b1++ )
+    {
+      len = 0;
+      for( i = 0; i < cnt; i++ )
+        len += glyph_encode(glyph_list+i, &fb) + 3;
+      if ( len < best )
+      {
+        best = len;
+        best_b0 = fb.b0;
+        best_b1 = fb.b1;
+      }
+    }
+  fb.b0 = best_b0;
+  fb.b1 = best_b1;
+
+  memset(font_buf, 0, sizeof(font_buf));
+  font_buf[0] = cnt > 255 ? 255 : cnt;
+  font_buf[1] = f->bbx_mode;
+  font_buf[2] = fb.b0;
+  font_buf[3] = fb.b1;
+  font_buf[4] = fb.w;
+  font_buf[5] = fb.h;
+  font_buf[6] = fb.x;
+  font_buf[7] = fb.y;
+  font_buf[8] = fb.d;
+  font_buf[9] = max_w;
+  font_buf[10] = bbx_top - min_y;
+  font_buf[11] = (uint8_t)(int8_t)min_x;
+  font_buf[12] = (uint8_t)(int8_t)min_y;
+  font_buf[13] = f->ascent;
+  font_buf[14] = (uint8_t)f->descent;
+  font_buf[15] = f->ascent;
+  font_buf[16] = (uint8_t)f->descent;
+
+  /* glyphs up to 255, the positions are relative to the end of the header */
+  pos = 23;
+  for( i = 0; i < cnt && glyph_list[i].encoding <= 255; i++ )
+  {
+    if ( pos_A < 0 && glyph_list[i].encoding >= 'A' )
+      pos_A = pos - 23;
+    if ( pos_a < 0 && glyph_list[i].encoding >= 'a' )
+      pos_a = pos - 23;
+    len = glyph_encode(glyph_list+i, &fb);
+    if ( len > 253 )
+      return -1;
+    font_buf[pos++] = glyph_list[i].encoding;
+    font_buf[pos++] = len+2;
+    memcpy(font_buf+pos, bit_buf, len);
+    pos += len;
+  }
+  if ( pos_A < 0 ) pos_A = pos - 23;
+  if ( pos_a < 0 ) pos_a = pos - 23;
+  font_buf[pos++] = 0;
+  font_buf[pos++] = 0;
+  font_buf[17] = pos_A >> 8;
+  font_buf[18] = pos_A & 255;
+  font_buf[19] = pos_a >> 8;
+  font_buf[20] = pos_a & 255;
+
+  /* unicode glyphs: a lookup table with one entry, which covers all glyphs */
+  pos_unicode = pos - 23;
+  font_buf[21] = pos_unicode >> 8;
+  font_buf[22] = pos_unicode & 255;
+  font_buf[pos++] = 0;
+  font_buf[pos++] = 4;
+  font_buf[pos++] = 0xff;
+  font_buf[pos++] = 0xff;
+  for( ; i < cnt; i++ )
+  {
+    len = glyph_encode(glyph_list+i, &fb);
+    if ( len > 252 )
+      return -1;
+    font_buf[pos++] = glyph_list[i].encoding >> 8;
+    font_buf[pos++] = glyph_list[i].encoding & 255;
+    font_buf[pos++] = len+3;
+    memcpy(font_buf+pos, bit_buf, len);
+    pos += len;
+  }
+  font_buf[pos++] = 0;
+  font_buf[pos++] = 0;
+  return pos;
+}
+
+int main(void)
+{
+  unsigned i;
+  int j, len;
+
+  printf("/* generated by fontgen.c, stand-in fonts for the host build */\n\n#include \"u8g2.h\"\n");
+  for( i = 0; i < sizeof(font_list)/sizeof(*font_list); i++ )
+  {
+    len = font_make(font_list+i);
+    if ( len < 0 )
+    {
+      fprintf(stderr, "fontgen: a glyph of %s does not fit\n", font_list[i].name);
+      return 1;
+    }
+    printf("\nconst uint8_t %s[%d] U8G2_FONT_SECTION(\"%s\") = {", font_list[i].name, len, font_list[i].name);
+    for( j = 0; j < len; j++ )
+      printf("%s%u%s", j % 16 == 0 ? "\n  " : "", font_buf[j], j+1 < len ? "," : "");
+    printf("\n};\n");
+  }
+  return 0;
+}
@@ -0,0 +1,237 @@
+/*
+
+  polygon.c
+
+  Polygon fill case of the host benchmark, see Makefile.
+
+  Random convex polygons with 3 to 6 points (the limit of u8g2_DrawPolygon)
+  are drawn with u8g2_DrawPolygon, with u8g2_FillPolygon (both fill rules)
+  and with u8g2_FillPath (one contour). The frames, which arrive at the memory
+  display, must be identical, in full buffer and in page buffer mode.
+  Then the draw time per polygon of u8g2_DrawPolygon and u8g2_FillPolygon
+  is reported.
+
+  The polygons are inside the display and strictly convex: u8g2_DrawPolygon
+  misses rows of polygons, which leave the display, and divides by zero for
+  some degenerate polygons.
+
+  usage: polygon [-n <polygons>]
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Distributed under the 2-clause BSD license of U8g2, see LICENSE.
+
+*/
+
+#include "u8g2.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define PG_W 128
+#define PG_H 64
+#define PG_MAX 6
+
+static uint8_t pg_ram[PG_W*PG_H/8];
+static uint8_t pg_buf[PG_W*PG_H/8];
+static uint8_t pg_frame[PG_W*PG_H/8];
+static u8g2_t u8g2;
+
+static u8g2_pg_point_t pg_pts[PG_MAX];
+static u8g2_pg_edge_t pg_edges[PG_MAX];
+static uint16_t pg_cnt;
+
+static uint8_t pg_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+  (void)u8x8;
+  (void)msg;
+  (void)arg_int;
+  (void)arg_ptr;
+  return 1;
+}
+
+static void pg_setup(uint8_t tile_buf_height)
+{
+  u8g2_Setup_memory(&u8g2, U8G2_R0, PG_W/8, PG_H/8, pg_ram, pg_buf, tile_buf_height, pg_gpio_and_delay);
+  u8g2_InitDisplay(&u8g2);
+}
+
+/* random strictly convex polygon inside the display, clockwise or counter clockwise */
+static void pg_random(void)
+{
+  double a[PG_MAX], t;
+  int16_t cx, cy, rx, ry;
+  int32_t c, c0;
+  uint16_t i, j, k;
+
+  for(;;)
+  {
+    pg_cnt = 3 + rand() % (PG_MAX-2);
+    for( i = 0; i < pg_cnt; i++ )
+      a[i] = rand() * (2.0*M_PI / RAND_MAX);
+    for( i = 1; i < pg_cnt; i++ )
+      for( j = i; j > 0 && a[j-1] > a[j]; j-- )
+      {
+        t = a[j]; a[j] = a[j-1]; a[j-1] = t;
+      }
+    cx = rand() % PG_W;
+    cy = rand() % PG_H;
+    rx = 1 + rand() % (PG_W/2);
+    ry = 1 + rand() % (PG_H/2);
+    k = rand() & 1;
+    for( i = 0; i < pg_cnt; i++ )
+    {
+      j = k ? i : pg_cnt-1-i;
+      pg_pts[i].x = cx + lround(rx*cos(a[j]));
+      pg_pts[i].y = cy + lround(ry*sin(a[j]));
+    }
+
+    c0 = 0;
+    for( i = 0; i < pg_cnt; i++ )
+    {
+      const u8g2_pg_point_t *p0 = pg_pts + i;
+      const u8g2_pg_point_t *p1 = pg_pts + (i+1) % pg_cnt;
+      const u8g2_pg_point_t *p2 = pg_pts + (i+2) % pg_cnt;
+      if ( p0->x < 0 || p0->y < 0 || p0->x >= PG_W || p0->y >= PG_H )
+        break;
+      c = (int32_t)(p1->x-p0->x)*(p2->y-p1->y) - (int32_t)(p1->y-p0->y)*(p2->x-p1->x);
+      if ( c == 0 || (i > 0 && (c > 0) != (c0 > 0)) )
+        break;
+      c0 = c;
+    }
+    if ( i == pg_cnt )
+      return;
+  }
+}
+
+static void pg_draw_old(void)
+{
+  uint16_t i;
+  u8g2_ClearPolygonXY();
+  for( i = 0; i < pg_cnt; i++ )
+    u8g2_AddPolygonXY(&u8g2, pg_pts[i].x, pg_pts[i].y);
+  u8g2_DrawPolygon(&u8g2);
+}
+
+static void pg_draw_even_odd(void)
+{
+  u8g2_FillPolygon(&u8g2, pg_pts, pg_cnt, pg_edges, U8G2_PG_EVEN_ODD);
+}
+
+static void pg_draw_non_zero(void)
+{
+  u8g2_FillPolygon(&u8g2, pg_pts, pg_cnt, pg_edges, U8G2_PG_NON_ZERO);
+}
+
+static void pg_draw_path(void)
+{
+  u8g2_FillPath(&u8g2, pg_pts, &pg_cnt, 1, pg_edges, U8G2_PG_EVEN_ODD);
+}
+
+/* picture loop, the frame is in pg_ram afterwards */
+static void pg_render(void (*draw)(void))
+{
+  u8g2_FirstPage(&u8g2);
+  do
+  {
+    draw();
+  } while( u8g2_NextPage(&u8g2) );
+}
+
+/* number of pixels, which differ from pg_frame */
+static unsigned long pg_diff(void)
+{
+  unsigned long d = 0;
+  size_t i;
+  uint8_t b;
+  for( i = 0; i < sizeof(pg_ram); i++ )
+    for( b = pg_ram[i] ^ pg_frame[i]; b != 0; b &= b-1 )
+      d++;
+  return d;
+}
+
+static unsigned long pg_compare(uint8_t tile_buf_height, unsigned long n, unsigned long *pixel)
+{
+  void (*fill[3])(void) = { pg_draw_even_odd, pg_draw_non_zero, pg_draw_path };
+  unsigned long d = 0;
+  unsigned long i;
+  size_t j;
+  uint8_t k;
+
+  pg_setup(tile_buf_height);
+  for( i = 0; i < n; i++ )
+  {
+    pg_random();
+    pg_render(pg_draw_old);
+    memcpy(pg_frame, pg_ram, sizeof(pg_frame));
+    for( j = 0; j < sizeof(pg_frame); j++ )
+      for( k = pg_frame[j]; k != 0; k &= k-1 )
+        (*pixel)++;
+    for( k = 0; k < 3; k++ )
+    {
+      pg_render(fill[k]);
+      d += pg_diff();
+    }
+  }
+  return d;
+}
+
+static double pg_time(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+/* us per polygon, drawn into the full buffer without transfer */
+static double pg_measure(void (*draw)(void), unsigned long n)
+{
+  static volatile double t;
+  unsigned long i;
+
+  pg_setup(PG_H/8);
+  srand(2);
+  t = 0.0;
+  for( i = 0; i < n; i++ )
+  {
+    pg_random();
+    u8g2_ClearBuffer(&u8g2);
+    t -= pg_time();
+    draw();
+    t += pg_time();
+  }
+  return t * 1e6 / n;
+}
+
+int main(int argc, char **argv)
+{
+  unsigned long n = 20000;
+  unsigned long pixel = 0;
+  unsigned long d_full, d_page;
+  int i;
+
+  for( i = 1; i < argc; i++ )
+  {
+    if ( strcmp(argv[i], "-n") == 0 && i+1 < argc )
+      n = strtoul(argv[++i], NULL, 10);
+    else
+    {
+      fprintf(stderr, "usage: %s [-n <polygons>]\n", argv[0]);
+      return 1;
+    }
+  }
+  if ( n == 0 )
+    n = 1;
+
+  srand(1);
+  d_full = pg_compare(PG_H/8, n, &pixel);
+  d_page = pg_compare(1, n, &pixel);
+  printf("polygon %ux%u: %lu polygons, %lu pixel, differences full buffer %lu, page buffer %lu\n",
+    PG_W, PG_H, 2*n, pixel, d_full, d_page);
+  printf("polygon %ux%u: DrawPolygon %.2f us, FillPolygon %.2f us per polygon\n", PG_W, PG_H,
+    pg_measure(pg_draw_old, n), pg_measure(pg_draw_even_odd, n));
+
+  return d_full != 0 || d_page != 0;
+}
@@ -0,0 +1,19 @@
+/*
+
+  u8g2_host.h
+  
+  Included before each example sketch of the host build (see Makefile).
+  The constructor lines of the sketch are commented, the sketch uses 
+  the memory display object u8g2 from bench.cpp instead.
+
+*/
+
+#ifndef U8G2_HOST_H
+#define U8G2_HOST_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+extern U8G2_MEMORY u8g2;
+
+#endif
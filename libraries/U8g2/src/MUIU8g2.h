@@ -57,6 +57,7 @@ class MUIU8G2
       mui_Init(&mui, (void *)u8g2.getU8g2(), fds, muif_list, muif_cnt);
     }
     mui_t *getMUI(void) { return &mui; }
+    void setFieldList(mui_field_t *field_list, uint8_t size) { mui_SetFieldList(&mui, field_list, size); }
 
     uint8_t getCurrentCursorFocusPosition(void) { return mui_GetCurrentCursorFocusPosition(&mui); }
     
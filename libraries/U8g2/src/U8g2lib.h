@@ -190,6 +190,25 @@ class U8G2
     void firstPage(void) { u8g2_FirstPage(&u8g2); }
     uint8_t nextPage(void) { return u8g2_NextPage(&u8g2); }
     
+#ifdef U8G2_WITH_DISPLAY_LIST
+    /* u8g2_display_list.c */
+    void setDisplayList(u8g2_dl_t *dl, uint8_t *buf, uint16_t size) { u8g2_SetDisplayList(&u8g2, dl, buf, size); }
+    uint16_t getDisplayListLen(void) { return u8g2_GetDisplayListLen(&u8g2); }
+#endif /* U8G2_WITH_DISPLAY_LIST */
+
+#ifdef U8G2_WITH_GRAY4
+    /* u8g2_gray.c */
+    void setGray4Buffer(uint8_t *buf, uint8_t tile_buf_height) { u8g2_SetupGray4Buffer(&u8g2, buf, tile_buf_height, u8g2.cb); }
+    uint16_t getGray4BufferSize(uint8_t tile_buf_height) { return u8g2_GetGray4BufferSize(&u8g2, tile_buf_height); }
+    void setGrayLevel(uint8_t level) { u8g2_SetGrayLevel(&u8g2, level); }
+    uint8_t getGrayLevel(void) { return u8g2_GetGrayLevel(&u8g2); }
+    void drawGray4Bitmap(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+      { u8g2_DrawGray4Bitmap(&u8g2, x, y, w, h, bitmap); }
+    u8g2_uint_t drawGlyphAA(u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding) { return u8g2_DrawGlyphAA(&u8g2, x, y, encoding); }
+    u8g2_uint_t drawStrAA(u8g2_uint_t x, u8g2_uint_t y, const char *s) { return u8g2_DrawStrAA(&u8g2, x, y, s); }
+    u8g2_uint_t drawUTF8AA(u8g2_uint_t x, u8g2_uint_t y, const char *s) { return u8g2_DrawUTF8AA(&u8g2, x, y, s); }
+#endif /* U8G2_WITH_GRAY4 */
+    
     #ifdef U8G2_USE_DYNAMIC_ALLOC
     void setBufferPtr(uint8_t *buf) { u8g2_SetBufferPtr(&u8g2, buf); }
     uint16_t getBufferSize() { return u8g2_GetBufferSize(&u8g2); }
@@ -260,6 +279,10 @@ class U8G2
     /* u8g2_polygon.c */
     void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2) 
       { u8g2_DrawTriangle(&u8g2, x0, y0, x1, y1, x2, y2); }
+    void fillPolygon(const u8g2_pg_point_t *pts, uint16_t cnt, u8g2_pg_edge_t *edges, uint8_t rule = U8G2_PG_EVEN_ODD)
+      { u8g2_FillPolygon(&u8g2, pts, cnt, edges, rule); }
+    void fillPath(const u8g2_pg_point_t *pts, const uint16_t *contour_end, uint8_t contour_cnt, u8g2_pg_edge_t *edges, uint8_t rule = U8G2_PG_EVEN_ODD)
+      { u8g2_FillPath(&u8g2, pts, contour_end, contour_cnt, edges, rule); }
       
     /* u8log_u8g2.c */
     void drawLog(u8g2_uint_t x, u8g2_uint_t y, class U8G2LOG &u8g2log);
@@ -435,12 +458,29 @@ class U8G2LOG
       u8log_Init(&u8log, width, height, buf);  
       return true;
     }
+
+    /* with additional history lines, the size of buf must be width*(height+history) */
+    bool begin(class U8G2 &u8g2, uint8_t width, uint8_t height, uint8_t history, uint8_t *buf)  { 
+      u8log_InitWithHistory(&u8log, width, height, history, buf);      
+      u8log_SetCallback(&u8log, u8log_u8g2_cb, u8g2.getU8g2());
+      return true;
+    }
+
+    bool begin(uint8_t width, uint8_t height, uint8_t history, uint8_t *buf) { 
+      u8log_InitWithHistory(&u8log, width, height, history, buf);  
+      return true;
+    }
     
     void setLineHeightOffset(int8_t line_height_offset) {
       u8log_SetLineHeightOffset(&u8log, line_height_offset); }
 
     void setRedrawMode(uint8_t is_redraw_line_for_each_char) {
       u8log_SetRedrawMode(&u8log, is_redraw_line_for_each_char); }
+
+    /* scroll back into the history, 0 shows the current output */
+    void setViewOffset(uint8_t view_offset) { u8log_SetViewOffset(&u8log, view_offset); }
+    uint8_t getViewOffset(void) { return u8log_GetViewOffset(&u8log); }
+    uint8_t getHistoryCnt(void) { return u8log_GetHistoryCnt(&u8log); }
     
     /* virtual function for print base class */    
     size_t write(uint8_t v) {
@@ -494,6 +534,14 @@ class U8G2_NULL : public U8G2 {
   }
 };
 
+/* memory display, keeps the display RAM (tile_width*tile_height*8 bytes) in memory, see u8x8_d_memory.c */
+/* tile_buf_height = tile_height for a full buffer, buf must have tile_width*tile_buf_height*8 bytes */
+class U8G2_MEMORY : public U8G2 {
+  public: U8G2_MEMORY(const u8g2_cb_t *rotation, uint8_t tile_width, uint8_t tile_height, uint8_t *ram, uint8_t *buf, uint8_t tile_buf_height, u8x8_msg_cb gpio_and_delay_cb = u8x8_dummy_cb) : U8G2() {
+    u8g2_Setup_memory(&u8g2, rotation, tile_width, tile_height, ram, buf, tile_buf_height, gpio_and_delay_cb);
+  }
+};
+
 
 /* Arduino constructor list start */
 /* generated code (codebuild), u8g2 project */
@@ -384,12 +384,33 @@ class U8X8LOG
       u8log_Init(&u8log, width, height, buf);  
       return true;
     }
+
+    /* with additional history lines, the size of buf must be width*(height+history) */
+    bool begin(class U8X8 &u8x8, uint8_t width, uint8_t height, uint8_t history, uint8_t *buf)  { 
+      u8log_InitWithHistory(&u8log, width, height, history, buf);      
+      u8log_SetCallback(&u8log, u8log_u8x8_cb, u8x8.getU8x8());
+      return true;
+    }
+
+    bool begin(uint8_t width, uint8_t height, uint8_t history, uint8_t *buf) { 
+      u8log_InitWithHistory(&u8log, width, height, history, buf);  
+      return true;
+    }
     
     void setLineHeightOffset(int8_t line_height_offset) {
       u8log_SetLineHeightOffset(&u8log, line_height_offset); }
 
     void setRedrawMode(uint8_t is_redraw_line_for_each_char) {
       u8log_SetRedrawMode(&u8log, is_redraw_line_for_each_char); }
+
+    /* redraw only changed lines, use the display start line for scrolling if supported */
+    void setIncrementalRedraw(void) {
+      u8log_SetCallback(&u8log, u8log_u8x8_start_line_cb, u8log.aux_data); }
+
+    /* scroll back into the history, 0 shows the current output */
+    void setViewOffset(uint8_t view_offset) { u8log_SetViewOffset(&u8log, view_offset); }
+    uint8_t getViewOffset(void) { return u8log_GetViewOffset(&u8log); }
+    uint8_t getHistoryCnt(void) { return u8log_GetHistoryCnt(&u8log); }
     
     /* virtual function for print base class */    
     size_t write(uint8_t v) {
@@ -432,6 +453,13 @@ class U8X8_NULL : public U8X8 {
   }
 };
 
+/* memory display, keeps the display RAM (tile_width*tile_height*8 bytes) in memory, see u8x8_d_memory.c */
+class U8X8_MEMORY : public U8X8 {
+  public: U8X8_MEMORY(uint8_t tile_width, uint8_t tile_height, uint8_t *ram, u8x8_msg_cb gpio_and_delay_cb = u8x8_dummy_cb) : U8X8() {
+    u8x8_Setup_memory(getU8x8(), tile_width, tile_height, ram, gpio_and_delay_cb);
+  }
+};
+
 
 // constructor list start
 /* generated code (codebuild), u8g2 project */
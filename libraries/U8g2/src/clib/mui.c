@@ -320,17 +320,28 @@ static int mui_find_uif(mui_t *ui, uint8_t id0, uint8_t id1)
 
 
 /*
-  assumes a valid position in ui->fds and calculates all the other variables
+  return the index of the field function of a compiled field or -1 if fds is not part of the field list
+*/
+static int mui_find_compiled_field(mui_t *ui, fds_t *fds)
+{
+  uint8_t i;
+  for( i = 0; i < ui->field_cnt; i++ )
+  {
+    if ( ui->field_list[i].fds == fds )
+      return ui->field_list[i].uif_idx;
+  }
+  return -1;
+}
+
+/*
+  assumes a valid position in ui->fds and calculates all the other variables except ui->uif
   some fields are always calculated like the ui->cmd and ui->len field
   other member vars are calculated only if the return value is 1
-  will return 1 if the field id was found.
-  will return 0 if the field id was not found in uif or if ui->fds points to something else than a field
+  will return 0 if ui->fds points to the end of the form
 */
-static uint8_t mui_prepare_current_field(mui_t *ui) MUI_NOINLINE;
-static uint8_t mui_prepare_current_field(mui_t *ui)
+static uint8_t mui_prepare_current_field_data(mui_t *ui) MUI_NOINLINE;
+static uint8_t mui_prepare_current_field_data(mui_t *ui)
 {
-  int muif_tidx;
-
   ui->uif = NULL;
   ui->dflags = 0;    
   ui->id0 = 0;
@@ -397,10 +408,29 @@ static uint8_t mui_prepare_current_field(mui_t *ui)
   }
 
   //MUI_DEBUG("mui_prepare_current_field cmd='%c' len=%d arg=%d\n", ui->cmd, ui->len, ui->arg);
+  return 1;
+}
 
+/*
+  assumes a valid position in ui->fds and calculates all the other variables
+  some fields are always calculated like the ui->cmd and ui->len field
+  other member vars are calculated only if the return value is 1
+  will return 1 if the field id was found.
+  will return 0 if the field id was not found in uif or if ui->fds points to something else than a field
+*/
+static uint8_t mui_prepare_current_field(mui_t *ui) MUI_NOINLINE;
+static uint8_t mui_prepare_current_field(mui_t *ui)
+{
+  int muif_tidx;
+
+  if ( mui_prepare_current_field_data(ui) == 0 )
+    return 0;
   
   /* find the field  */
-  muif_tidx = mui_find_uif(ui, ui->id0, ui->id1);
+  if ( ui->is_field_list_valid )
+    muif_tidx = mui_find_compiled_field(ui, ui->fds);   /* the field list contains all fields of the current form */
+  else
+    muif_tidx = mui_find_uif(ui, ui->id0, ui->id1);
   //printf("mui_prepare_current_field: muif_tidx=%d\n", muif_tidx);
   if ( muif_tidx >= 0 )
   {
@@ -445,6 +475,35 @@ static void mui_inner_loop_over_form(mui_t *ui, uint8_t (*task)(mui_t *ui))
   //MUI_DEBUG("mui_inner_loop_over_form end %p\n", task);
 }
 
+/*
+  same as mui_inner_loop_over_form, but for the compiled form (ui->field_list)
+  is_all_fields == 0: only cursor selectable and execute on select fields are visited, 
+    only ui->fds and ui->uif are assigned, the command is not parsed
+*/
+static void mui_loop_over_field_list(mui_t *ui, uint8_t (*task)(mui_t *ui), uint8_t is_all_fields) MUI_NOINLINE;
+static void mui_loop_over_field_list(mui_t *ui, uint8_t (*task)(mui_t *ui), uint8_t is_all_fields)
+{
+  fds_t *form_fds = ui->current_form_fds;
+  mui_field_t *field = ui->field_list;
+  uint8_t i;
+  
+  for( i = 0; i < ui->field_cnt; i++ )
+  {
+    if ( is_all_fields || (field->cflags & (MUIF_CFLAG_IS_CURSOR_SELECTABLE|MUIF_CFLAG_IS_EXECUTE_ON_SELECT)) )
+    {
+      ui->fds = field->fds;
+      if ( is_all_fields )
+        mui_prepare_current_field_data(ui);
+      ui->uif = ui->muif_tlist + field->uif_idx;
+      if ( task(ui) )
+        break;
+      if ( ui->current_form_fds != form_fds )
+        break;          /* the task has entered another form */
+    }
+    field++;
+  }
+}
+
 static void mui_loop_over_form(mui_t *ui, uint8_t (*task)(mui_t *ui)) MUI_NOINLINE;
 static void mui_loop_over_form(mui_t *ui, uint8_t (*task)(mui_t *ui))
 {
@@ -455,7 +514,28 @@ static void mui_loop_over_form(mui_t *ui, uint8_t (*task)(mui_t *ui))
   ui->target_fds = NULL;
   ui->tmp_fds = NULL;
   
-  mui_inner_loop_over_form(ui, task);  
+  if ( ui->is_field_list_valid )
+    mui_loop_over_field_list(ui, task, 1);
+  else
+    mui_inner_loop_over_form(ui, task);  
+}
+
+/*
+  same as mui_loop_over_form, but the task may only use ui->fds and ui->uif 
+  and must ignore fields which are neither cursor selectable nor execute on select
+*/
+static void mui_loop_over_cursor_fields(mui_t *ui, uint8_t (*task)(mui_t *ui)) MUI_NOINLINE;
+static void mui_loop_over_cursor_fields(mui_t *ui, uint8_t (*task)(mui_t *ui))
+{
+  if ( ui->is_field_list_valid == 0 )
+  {
+    mui_loop_over_form(ui, task);
+    return;
+  }
+  
+  ui->target_fds = NULL;
+  ui->tmp_fds = NULL;
+  mui_loop_over_field_list(ui, task, 0);
 }
 
 /*
@@ -610,9 +690,45 @@ static uint8_t mui_task_find_execute_on_select_field(mui_t *ui)
   return 0;     /* continue with the loop */
 }
 
+static uint8_t mui_task_compile_field(mui_t *ui)
+{
+  mui_field_t *field;
+  size_t uif_idx = ui->uif - ui->muif_tlist;
+  
+  if ( ui->field_cnt >= ui->field_list_size || uif_idx > 255 )
+  {
+    ui->tmp8 = 0;       /* does not fit into the field list */
+    return 1;         /* stop looping */
+  }
+  field = ui->field_list + ui->field_cnt;
+  field->fds = ui->fds;
+  field->uif_idx = uif_idx;
+  field->cflags = muif_get_cflags(ui->uif);
+  ui->field_cnt++;
+  return 0;     /* continue with the loop */
+}
+
 
 /* === utility functions for the user API === */
 
+/*
+  Compile the current form into ui->field_list. Drawing and cursor navigation will use the field list
+  instead of the form definition string. The field functions are not searched in muif_tlist again.
+  If the form has more fields than the field list, then the form definition string is used.
+*/
+static void mui_compile_form(mui_t *ui)
+{
+  ui->is_field_list_valid = 0;
+  ui->field_cnt = 0;
+  if ( ui->field_list == NULL || mui_IsFormActive(ui) == 0 )
+    return;
+  ui->tmp8 = 1;
+  mui_loop_over_form(ui, mui_task_compile_field);
+  ui->is_field_list_valid = ui->tmp8;
+  if ( ui->is_field_list_valid == 0 )
+    ui->field_cnt = 0;
+}
+
 static uint8_t mui_send_cursor_msg(mui_t *ui, uint8_t msg) MUI_NOINLINE;
 static uint8_t mui_send_cursor_msg(mui_t *ui, uint8_t msg)
 {
@@ -627,6 +743,19 @@ static uint8_t mui_send_cursor_msg(mui_t *ui, uint8_t msg)
 
 /* === user API === */
 
+/*
+  Assign a buffer for the compiled fields of the current form. 
+  size is the number of elements of field_list, it should be the max number of fields within a form.
+  Forms with more fields are not compiled, but still work. Use NULL to disable the field list.
+  Each form is compiled by mui_EnterForm() and mui_GotoForm().
+*/
+void mui_SetFieldList(mui_t *ui, mui_field_t *field_list, uint8_t size)
+{
+  ui->field_list = field_list;
+  ui->field_list_size = size;
+  mui_compile_form(ui);
+}
+
 /* 
   returns the field pos which has the current focus 
   If the first selectable field has the focus, then 0 will be returned
@@ -641,7 +770,7 @@ uint8_t mui_GetCurrentCursorFocusPosition(mui_t *ui)
 {
   //fds_t *fds = ui->fds;
   ui->tmp8 = 0;  
-  mui_loop_over_form(ui, mui_task_get_current_cursor_focus_position);
+  mui_loop_over_cursor_fields(ui, mui_task_get_current_cursor_focus_position);
   //ui->fds = fds;
   return ui->tmp8;
 }
@@ -654,12 +783,12 @@ void mui_Draw(mui_t *ui)
 
 static void mui_next_field(mui_t *ui)
 {
-  mui_loop_over_form(ui, mui_task_find_next_cursor_uif);
+  mui_loop_over_cursor_fields(ui, mui_task_find_next_cursor_uif);
   // ui->cursor_focus_position++;
   ui->cursor_focus_fds = ui->target_fds;      // NULL is ok  
   if ( ui->target_fds == NULL )
   {
-    mui_loop_over_form(ui, mui_task_find_first_cursor_uif);
+    mui_loop_over_cursor_fields(ui, mui_task_find_first_cursor_uif);
     ui->cursor_focus_fds = ui->target_fds;      // NULL is ok  
     // ui->cursor_focus_position = 0;
   }
@@ -749,6 +878,7 @@ void mui_EnterForm(mui_t *ui, fds_t *fds, uint8_t initial_cursor_position)
   
   /* assign the form, which should be entered */
   ui->current_form_fds = fds;
+  mui_compile_form(ui);
   
   /* inform all fields that we start a new form */
   MUI_DEBUG("mui_EnterForm: form_start, initial_cursor_position=%d\n", initial_cursor_position);
@@ -756,7 +886,7 @@ void mui_EnterForm(mui_t *ui, fds_t *fds, uint8_t initial_cursor_position)
   
   /* assign initional cursor focus */
   MUI_DEBUG("mui_EnterForm: find_first_cursor_uif\n");
-  mui_loop_over_form(ui, mui_task_find_first_cursor_uif);  
+  mui_loop_over_cursor_fields(ui, mui_task_find_first_cursor_uif);  
   ui->cursor_focus_fds = ui->target_fds;      // NULL is ok  
   MUI_DEBUG("mui_EnterForm: find_first_cursor_uif target_fds=%p\n", ui->target_fds);
   
@@ -788,6 +918,7 @@ void mui_LeaveForm(mui_t *ui)
   MUI_DEBUG("mui_LeaveForm: form_end\n");
   mui_loop_over_form(ui, mui_task_form_end);  
   ui->current_form_fds = NULL;
+  ui->is_field_list_valid = 0;
 }
 
 /* 0: error, form not found */
@@ -949,12 +1080,12 @@ void mui_PrevField(mui_t *ui)
       return;
     mui_send_cursor_msg(ui, MUIF_MSG_CURSOR_LEAVE);
  
-    mui_loop_over_form(ui, mui_task_find_prev_cursor_uif);
+    mui_loop_over_cursor_fields(ui, mui_task_find_prev_cursor_uif);
     ui->cursor_focus_fds = ui->target_fds;      // NULL is ok  
     if ( ui->target_fds == NULL )
     {
       //ui->cursor_focus_position = 0;
-      mui_loop_over_form(ui, mui_task_find_last_cursor_uif);
+      mui_loop_over_cursor_fields(ui, mui_task_find_last_cursor_uif);
       ui->cursor_focus_fds = ui->target_fds;      // NULL is ok  
     }
   } while( mui_send_cursor_enter_msg(ui) == 255 );
@@ -976,7 +1107,7 @@ void mui_SendSelect(mui_t *ui)
 */
 void mui_SendSelectWithExecuteOnSelectFieldSearch(mui_t *ui)
 {
-  mui_loop_over_form(ui, mui_task_find_execute_on_select_field);  /* Is there a exec on select field? */
+  mui_loop_over_cursor_fields(ui, mui_task_find_execute_on_select_field);  /* Is there a exec on select field? */
   if ( ui->target_fds != NULL )       /* yes, found, ui->fds already points to the field */
   {
     fds_t *exec_on_select_field = ui->target_fds;
@@ -139,6 +139,7 @@ typedef struct mui_struct mui_t;
 typedef const struct muif_struct muif_t;
 typedef uint8_t (*muif_cb)(mui_t *ui, uint8_t msg);
 typedef const char fds_t MUI_PROGMEM;
+typedef struct mui_field_struct mui_field_t;
 
 
 
@@ -218,6 +219,17 @@ struct muif_struct
 
 
 
+/* 
+  compiled field of the current form, see mui_SetFieldList() 
+  only commands with a field function (MUIF) are compiled
+*/
+struct mui_field_struct
+{
+  fds_t *fds;           // start of the command within the form definition
+  uint8_t uif_idx;    // index of the field function within muif_tlist
+  uint8_t cflags;       // copy of the config flags of the field function
+};
+
 /* must be smaller than or equal to 255 */
 #ifndef MUI_MAX_TEXT_LEN
 #define MUI_MAX_TEXT_LEN 41
@@ -282,6 +294,12 @@ struct mui_struct
   uint8_t menu_form_last_added;
   uint8_t menu_form_id[MUI_MENU_CACHE_CNT];
   uint8_t menu_form_cursor_focus_position[MUI_MENU_CACHE_CNT];
+  
+  /* compiled fields of the current form, assigned by mui_SetFieldList() */
+  mui_field_t *field_list;
+  uint8_t field_list_size;      // max number of fields in field_list
+  uint8_t field_cnt;             // number of fields of the current form
+  uint8_t is_field_list_valid;  // 1 if field_list contains the fields of the current form
 } ;
 
 #define mui_IsCursorFocus(mui) ((mui)->dflags & MUIF_DFLAG_IS_CURSOR_FOCUS)
@@ -578,6 +596,8 @@ uint8_t mui_fds_get_nth_token(mui_t *ui, uint8_t n) MUI_NOINLINE;
 uint8_t mui_fds_get_token_cnt(mui_t *ui) MUI_NOINLINE;
 
 void mui_Init(mui_t *ui, void *graphics_data, fds_t *fds, muif_t *muif_tlist, size_t muif_tcnt);
+/* optional: buffer for the compiled fields of the current form, size is the max number of fields of a form, use NULL to disable */
+void mui_SetFieldList(mui_t *ui, mui_field_t *field_list, uint8_t size);
 uint8_t mui_GetCurrentCursorFocusPosition(mui_t *ui) ;
 void mui_Draw(mui_t *ui);
 /* warning: The next function will overwrite the ui field variables like ui->arg, etc. 26 sep 2021: only ui->text is modified */
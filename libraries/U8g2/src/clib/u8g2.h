@@ -130,6 +130,32 @@
 #define U8G2_WITH_FONT_ROTATION
 #endif
 
+/*
+  The following macro enables the display list for the picture loop (u8g2_FirstPage/NextPage).
+  If a display list buffer is assigned with u8g2_SetDisplayList(), the first pass of the picture loop 
+  only records the draw procedures. All pages are then drawn from this recording, so that the 
+  user code of the picture loop is executed only once. Each page replays only those 
+  commands which intersect with the page.
+  If the recording does not fit into the buffer, the picture loop falls back to the normal behavior.
+  The display list is disabled by default, because the recording and replay code is linked into
+  every picture loop. Uncomment the following line to enable it. It requires U8G2_WITH_INTERSECTION.
+*/
+//#define U8G2_WITH_DISPLAY_LIST
+
+#ifndef U8G2_WITH_INTERSECTION
+#undef U8G2_WITH_DISPLAY_LIST
+#endif
+
+/*
+  The following macro enables the 4 bit gray scale buffer for 16 level gray scale 
+  controllers (SSD1322, SSD1325, SSD1327, SSD1362, SSD1363), see u8g2_SetupGray4Buffer().
+  Without the call to u8g2_SetupGray4Buffer(), nothing changes. The procedures are 
+  removed by the linker if they are not used.
+*/
+#ifndef U8G2_WITHOUT_GRAY4
+#define U8G2_WITH_GRAY4
+#endif
+
 /*
   U8glib V2 contains support for unicode plane 0 (Basic Multilingual Plane, BMP).
   The following macro activates this support. Deactivation would save some ROM.
@@ -310,6 +336,38 @@ struct u8g2_cb_struct
 
 typedef u8g2_uint_t (*u8g2_font_calc_vref_fnptr)(u8g2_t *u8g2);
 
+#ifdef U8G2_WITH_DISPLAY_LIST
+/* display list for the picture loop, see u8g2_display_list.c */
+typedef struct u8g2_dl_struct u8g2_dl_t;
+struct u8g2_dl_struct
+{
+  uint8_t *buf;			/* memory area for the recorded commands */
+  uint16_t size;		/* size of buf in bytes */
+  uint16_t len;			/* bytes required by the recorded commands, larger than size if the recording did not fit */
+  uint16_t cmd_pos;		/* start of the command, for which the bounding box is calculated */
+  u8g2_uint_t x0, y0, x1, y1;	/* bounding box of the command at cmd_pos */
+  
+  /* state, which had been recorded so far */
+  const uint8_t *font;
+  u8g2_font_calc_vref_fnptr font_calc_vref;
+  int8_t font_ref_ascent;
+  int8_t font_ref_descent;
+  uint8_t font_mode;		/* font_decode.is_transparent | font_decode.dir << 1 */
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  u8g2_uint_t clip_x0, clip_y0, clip_x1, clip_y1;
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+  uint8_t is_font_recorded;
+  
+  uint8_t mode;			/* U8G2_DL_MODE_IDLE, U8G2_DL_MODE_RECORD or U8G2_DL_MODE_REPLAY */
+  uint8_t depth;		/* nesting level of the string and glyph procedures */
+  uint8_t group_cnt;		/* number of lines in the open group at cmd_pos, 0 if no group is open */
+};
+
+#define U8G2_DL_MODE_IDLE 0
+#define U8G2_DL_MODE_RECORD 1
+#define U8G2_DL_MODE_REPLAY 2
+#endif /* U8G2_WITH_DISPLAY_LIST */
+
 
 struct u8g2_struct
 {
@@ -383,6 +441,14 @@ struct u8g2_struct
 	// the following variable should be renamed to is_buffer_auto_clear
   uint8_t is_auto_page_clear; 		/* set to 0 to disable automatic clear of the buffer in firstPage() and nextPage() */
   
+#ifdef U8G2_WITH_DISPLAY_LIST
+  u8g2_dl_t *dl;		/* display list for the picture loop, NULL if not used */
+#endif /* U8G2_WITH_DISPLAY_LIST */
+
+#ifdef U8G2_WITH_GRAY4
+  uint8_t is_gray4;		/* 1 if the buffer has 4 bit per pixel, assigned by u8g2_SetupGray4Buffer() */
+  uint8_t gray_level;		/* 0..15, value of the pixels for draw color 1 in the 4 bit buffer */
+#endif /* U8G2_WITH_GRAY4 */
 };
 
 #define u8g2_GetU8x8(u8g2) ((u8x8_t *)(u8g2))
@@ -466,6 +532,9 @@ void u8g2_SendF(u8g2_t * u8g2, const char *fmt, ...);
 /* null device setup */
 void u8g2_Setup_null(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 
+/* memory display setup, see u8x8_d_memory.c, buf must have tile_width*tile_buf_height*8 bytes */
+void u8g2_Setup_memory(u8g2_t *u8g2, const u8g2_cb_t *rotation, uint8_t tile_width, uint8_t tile_height, uint8_t *ram, uint8_t *buf, uint8_t tile_buf_height, u8x8_msg_cb gpio_and_delay_cb);
+
 /*==========================================*/
 /* u8g2_d_memory.c generated code start */
 uint8_t *u8g2_m_16_4_1(uint8_t *page_cnt);
@@ -1718,8 +1787,12 @@ uint8_t u8g2_NextPage(u8g2_t *u8g2);
 
 #ifdef U8G2_USE_DYNAMIC_ALLOC
 #define u8g2_SetBufferPtr(u8g2, buf) ((u8g2)->tile_buf_ptr = (buf));
+#ifdef U8G2_WITH_GRAY4
+#define u8g2_GetBufferSize(u8g2) ((u8g2)->u8x8.display_info->tile_width * ((u8g2)->is_gray4 ? 32 : 8) * (u8g2)->tile_buf_height)
+#else
 #define u8g2_GetBufferSize(u8g2) ((u8g2)->u8x8.display_info->tile_width * 8 * (u8g2)->tile_buf_height)
 #endif
+#endif
 #define u8g2_GetBufferPtr(u8g2) ((u8g2)->tile_buf_ptr)
 #define u8g2_GetBufferTileHeight(u8g2)	((u8g2)->tile_buf_height)
 #define u8g2_GetBufferTileWidth(u8g2)	(u8g2_GetU8x8(u8g2)->display_info->tile_width)
@@ -1738,6 +1811,67 @@ void u8g2_WriteBufferPBM2(u8g2_t *u8g2, void (*out)(const char *s));
 void u8g2_WriteBufferXBM2(u8g2_t *u8g2, void (*out)(const char *s));
 
 
+/*==========================================*/
+/* u8g2_display_list.c */
+
+#ifdef U8G2_WITH_DISPLAY_LIST
+/* assign a display list buffer to the picture loop, use dl = NULL to disable the display list */
+void u8g2_SetDisplayList(u8g2_t *u8g2, u8g2_dl_t *dl, uint8_t *buf, uint16_t size);
+/* number of bytes required by the last recording, valid after the first call to u8g2_NextPage */
+#define u8g2_GetDisplayListLen(u8g2) ((u8g2)->dl == NULL ? 0 : (u8g2)->dl->len)
+#define u8g2_IsDisplayListRecording(u8g2) ((u8g2)->dl != NULL && (u8g2)->dl->mode == U8G2_DL_MODE_RECORD)
+/* inside a string or glyph, which is recorded as one command */
+#define u8g2_IsDisplayListCapture(u8g2) (u8g2_IsDisplayListRecording(u8g2) && (u8g2)->dl->depth != 0)
+
+/* internal procedures, called from the picture loop and the draw procedures */
+void u8g2_dl_StartRecording(u8g2_t *u8g2);
+uint8_t u8g2_dl_EndRecording(u8g2_t *u8g2);
+uint8_t u8g2_dl_ReplayPage(u8g2_t *u8g2);
+void u8g2_dl_ExtendBox(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t x1, u8g2_uint_t y1);
+void u8g2_dl_RecordHVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+uint8_t u8g2_dl_RecordCmd(u8g2_t *u8g2, uint8_t op, u8g2_uint_t a, u8g2_uint_t b, u8g2_uint_t c, u8g2_uint_t d, const uint8_t *bitmap);
+void u8g2_dl_BeginCapture(u8g2_t *u8g2, uint8_t op, u8g2_uint_t x, u8g2_uint_t y, const void *data, uint16_t len);
+void u8g2_dl_EndCapture(u8g2_t *u8g2);
+
+/* command codes for u8g2_dl_RecordCmd() and u8g2_dl_BeginCapture() */
+#define U8G2_DL_OP_HVLINE 0
+#define U8G2_DL_OP_BOX 1
+#define U8G2_DL_OP_LINE 2
+#define U8G2_DL_OP_STR 3
+#define U8G2_DL_OP_UTF8 4
+#define U8G2_DL_OP_GLYPH 5
+#define U8G2_DL_OP_BITMAP 6
+#define U8G2_DL_OP_XBM 7
+#define U8G2_DL_OP_XBMP 8
+#define U8G2_DL_OP_FONT 9
+#define U8G2_DL_OP_CLIP 10
+#define U8G2_DL_OP_STATE 11
+#define U8G2_DL_OP_GROUP 12
+#endif /* U8G2_WITH_DISPLAY_LIST */
+
+
+/*==========================================*/
+/* u8g2_gray.c */
+
+#ifdef U8G2_WITH_GRAY4
+/* replace the buffer with a 4 bit gray scale buffer, which is sent with U8X8_MSG_DISPLAY_DRAW_GRAY4 */
+void u8g2_SetupGray4Buffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, const u8g2_cb_t *u8g2_cb);
+#define u8g2_GetGray4BufferSize(u8g2, tile_buf_height) ((u8g2)->u8x8.display_info->tile_width * 32 * (tile_buf_height))
+#define u8g2_IsGray4Buffer(u8g2) ((u8g2)->is_gray4)
+/* 0..15, used for draw color 1 */
+#define u8g2_SetGrayLevel(u8g2, level) ((u8g2)->gray_level = (level) & 15)
+#define u8g2_GetGrayLevel(u8g2) ((u8g2)->gray_level)
+
+void u8g2_ll_hvline_gray4(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+void u8g2_DrawGray4Bitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
+
+/* glyphs with smoothed edges, same as u8g2_DrawGlyph/Str/UTF8 with a monochrome buffer */
+u8g2_uint_t u8g2_DrawGlyphAA(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding);
+u8g2_uint_t u8g2_DrawStrAA(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str);
+u8g2_uint_t u8g2_DrawUTF8AA(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str);
+#endif /* U8G2_WITH_GRAY4 */
+
+
 /*==========================================*/
 /* u8g2_ll_hvline.c */
 /*
@@ -1853,6 +1987,36 @@ void u8g2_AddPolygonXY(u8g2_t *u8g2, int16_t x, int16_t y);
 void u8g2_DrawPolygon(u8g2_t *u8g2);
 void u8g2_DrawTriangle(u8g2_t *u8g2, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2);
 
+/* edge table polygon filler: points and edge table are provided by the caller, see u8g2_polygon.c */
+struct u8g2_pg_point_struct
+{
+  int16_t x;
+  int16_t y;
+};
+typedef struct u8g2_pg_point_struct u8g2_pg_point_t;
+
+/* one entry for each point of the polygon */
+struct u8g2_pg_edge_struct
+{
+  int16_t x;		/* intersection with the current scan line, rounded up */
+  int16_t q;		/* x increment for the next scan line */
+  uint16_t r;		/* remainder, x - r/h is the exact intersection */
+  uint16_t m;		/* remainder increment, 0 <= m < h */
+  uint16_t h;		/* height of the edge */
+  int16_t y0;		/* first scan line */
+  int16_t y1;		/* last scan line + 1 */
+  int8_t dir;		/* 1: top-down edge, -1: bottom-up edge */
+};
+typedef struct u8g2_pg_edge_struct u8g2_pg_edge_t;
+
+/* fill rules */
+#define U8G2_PG_EVEN_ODD 0
+#define U8G2_PG_NON_ZERO 1
+
+void u8g2_FillPolygon(u8g2_t *u8g2, const u8g2_pg_point_t *pts, uint16_t cnt, u8g2_pg_edge_t *edges, uint8_t rule);
+/* several contours (e.g. with holes), contour_end[i] is the index after the last point of contour i */
+void u8g2_FillPath(u8g2_t *u8g2, const u8g2_pg_point_t *pts, const uint16_t *contour_end, uint8_t contour_cnt, u8g2_pg_edge_t *edges, uint8_t rule);
+
 
 
 /*==========================================*/
@@ -88,6 +88,10 @@ void u8g2_DrawBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t cnt
   u8g2_uint_t w;
   w = cnt;
   w *= 8;
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2->dl != NULL && u8g2_dl_RecordCmd(u8g2, U8G2_DL_OP_BITMAP, x, y, cnt, h, bitmap) )
+    return;
+#endif /* U8G2_WITH_DISPLAY_LIST */
 #ifdef U8G2_WITH_INTERSECTION
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
@@ -170,6 +174,10 @@ void u8g2_DrawXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g
   blen = w;
   blen += 7;
   blen >>= 3;
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2->dl != NULL && u8g2_dl_RecordCmd(u8g2, U8G2_DL_OP_XBM, x, y, w, h, bitmap) )
+    return;
+#endif /* U8G2_WITH_DISPLAY_LIST */
 #ifdef U8G2_WITH_INTERSECTION
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
@@ -258,6 +266,10 @@ void u8g2_DrawXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8
   blen = w;
   blen += 7;
   blen >>= 3;
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2->dl != NULL && u8g2_dl_RecordCmd(u8g2, U8G2_DL_OP_XBMP, x, y, w, h, bitmap) )
+    return;
+#endif /* U8G2_WITH_DISPLAY_LIST */
 #ifdef U8G2_WITH_INTERSECTION
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
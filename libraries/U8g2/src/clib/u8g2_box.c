@@ -41,6 +41,10 @@
 */
 void u8g2_DrawBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
 {
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2->dl != NULL && u8g2_dl_RecordCmd(u8g2, U8G2_DL_OP_BOX, x, y, w, h, NULL) )
+    return;
+#endif /* U8G2_WITH_DISPLAY_LIST */
 #ifdef U8G2_WITH_INTERSECTION
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
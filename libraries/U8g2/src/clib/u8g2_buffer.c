@@ -43,6 +43,10 @@ void u8g2_ClearBuffer(u8g2_t *u8g2)
   cnt = u8g2_GetU8x8(u8g2)->display_info->tile_width;
   cnt *= u8g2->tile_buf_height;
   cnt *= 8;
+#ifdef U8G2_WITH_GRAY4
+  if ( u8g2->is_gray4 )
+    cnt *= 4;
+#endif /* U8G2_WITH_GRAY4 */
   memset(u8g2->tile_buf_ptr, 0, cnt);
 }
 
@@ -59,6 +63,15 @@ static void u8g2_send_tile_row(u8g2_t *u8g2, uint8_t src_tile_row, uint8_t dest_
   ptr = u8g2->tile_buf_ptr;
   offset *= w;
   offset *= 8;
+#ifdef U8G2_WITH_GRAY4
+  if ( u8g2->is_gray4 )
+  {
+    offset *= 4;
+    ptr += offset;
+    u8x8_DrawGray4Tile(u8g2_GetU8x8(u8g2), 0, dest_tile_row, w, ptr);
+    return;
+  }
+#endif /* U8G2_WITH_GRAY4 */
   ptr += offset;
   u8x8_DrawTile(u8g2_GetU8x8(u8g2), 0, dest_tile_row, w, ptr);
 }
@@ -111,11 +124,35 @@ void u8g2_FirstPage(u8g2_t *u8g2)
     u8g2_ClearBuffer(u8g2);
   }
   u8g2_SetBufferCurrTileRow(u8g2, 0);
+#ifdef U8G2_WITH_DISPLAY_LIST
+  u8g2_dl_StartRecording(u8g2);
+#endif /* U8G2_WITH_DISPLAY_LIST */
 }
 
 uint8_t u8g2_NextPage(u8g2_t *u8g2)
 {
   uint8_t row;
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2_IsDisplayListRecording(u8g2) )
+  {
+    /* the first pass did only record the picture, draw all pages from the display list */
+    if ( u8g2_dl_EndRecording(u8g2) == 0 )
+      return 1;		/* display list overflow: execute the picture loop for each page */
+    for(;;)
+    {
+      u8g2_send_buffer(u8g2);
+      row = u8g2->tile_curr_row;
+      row += u8g2->tile_buf_height;
+      if ( row >= u8g2_GetU8x8(u8g2)->display_info->tile_height )
+	break;
+      u8g2_ClearBuffer(u8g2);
+      u8g2_SetBufferCurrTileRow(u8g2, row);
+      u8g2_dl_ReplayPage(u8g2);
+    }
+    u8x8_RefreshDisplay( u8g2_GetU8x8(u8g2) );
+    return 0;
+  }
+#endif /* U8G2_WITH_DISPLAY_LIST */
   u8g2_send_buffer(u8g2);
   row = u8g2->tile_curr_row;
   row += u8g2->tile_buf_height;
@@ -161,6 +198,23 @@ void u8g2_UpdateDisplayArea(u8g2_t *u8g2, uint8_t  tx, uint8_t ty, uint8_t tw, u
 
   page_size = u8g2->pixel_buf_width;  /* 8*u8g2->u8g2_GetU8x8(u8g2)->display_info->tile_width */
     
+#ifdef U8G2_WITH_GRAY4
+  if ( u8g2->is_gray4 )
+  {
+    ptr = u8g2_GetBufferPtr(u8g2);
+    ptr += tx*4;
+    ptr += page_size*4*ty;
+    while( th > 0 )
+    {
+      u8x8_DrawGray4Tile( u8g2_GetU8x8(u8g2), tx, ty, tw, ptr );
+      ptr += page_size*4;
+      ty++;
+      th--;
+    }
+    return;
+  }
+#endif /* U8G2_WITH_GRAY4 */
+
   ptr = u8g2_GetBufferPtr(u8g2);
   ptr += tx*8;
   ptr += page_size*ty;
@@ -0,0 +1,552 @@
+/*
+
+  u8g2_display_list.c
+
+  Display list for the picture loop (u8g2_FirstPage/NextPage)
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Distributed under the 2-clause BSD license of U8g2, see LICENSE.
+
+  In page mode, the picture loop executes the user code once for each page.
+  With a display list, the first pass records the draw procedures into a buffer
+  and draws nothing. All pages are then drawn from the recording and each page
+  only executes the commands, which intersect with the page.
+
+  Each command starts with one byte: op << 4 | flag << 2 | draw_color.
+  The arguments follow as u8g2_uint_t values in native byte order:
+
+    HVLINE	x, y, len				flag: dir
+    BOX		x, y, w, h
+    LINE	x1, y1, x2, y2
+    STR, UTF8	x0, y0, x1, y1, x, y, string	bounding box, position and the string including the terminating 0
+    GLYPH	x0, y0, x1, y1, x, y, encoding	bounding box, position and the 16 bit encoding
+    BITMAP, XBM, XBMP	x, y, w, h, ptr		flag: bitmap_transparency, w is the byte count for BITMAP
+    FONT	font, font_calc_vref, ascent, descent, mode
+    CLIP	x0, y0, x1, y1
+    STATE	-				flag: bitmap_transparency
+    GROUP	x0, y0, x1, y1, len		bounding box and the size (uint16_t) of the following HVLINE commands
+
+  Strings and glyphs are recorded as one command, the bounding box is taken from the
+  lines, which are drawn by the font procedures during the recording.
+  All other procedures are recorded as HVLINE commands, which are clipped already.
+  Up to U8G2_DL_GROUP_MAX consecutive HVLINE commands are put into a GROUP, so that 
+  a page can skip them with one intersection test.
+  FONT and CLIP commands are added if the state differs from the previously recorded state.
+  CLIP, FONT and STATE at the end of the recording restore the state after the last page.
+
+  The recorded font, bitmap and string pointers must remain valid until the
+  picture loop has finished.
+
+*/
+
+#include "u8g2.h"
+
+#ifdef U8G2_WITH_DISPLAY_LIST
+
+#define U8G2_DL_CMD(op, flag, color) ((uint8_t)(((op)<<4)|((flag)<<2)|(color)))
+
+/* max number of lines in a group, limits the size of the bounding box */
+#define U8G2_DL_GROUP_MAX 32
+
+/* number of u8g2_uint_t arguments for each op */
+static const uint8_t u8g2_dl_arg_cnt[13] = { 3, 4, 4, 6, 6, 6, 4, 4, 4, 0, 4, 0, 4 };
+
+/*
+  Assign a buffer for the display list.
+  Use dl = NULL to disable the display list.
+  The display list is only used in page mode (the buffer is smaller than the display) and
+  if the automatic clear of the buffer is enabled.
+*/
+void u8g2_SetDisplayList(u8g2_t *u8g2, u8g2_dl_t *dl, uint8_t *buf, uint16_t size)
+{
+  u8g2->dl = dl;
+  if ( dl == NULL )
+    return;
+  dl->buf = buf;
+  dl->size = size;
+  dl->len = 0;
+  dl->depth = 0;
+  dl->mode = U8G2_DL_MODE_IDLE;
+}
+
+/*===============================================*/
+/* record */
+
+/* the length keeps counting if the buffer is full, this is the size the user would need */
+static void u8g2_dl_put(u8g2_dl_t *dl, const void *data, uint16_t n)
+{
+  const uint8_t *src = (const uint8_t *)data;
+  uint8_t *dest;
+
+  if ( dl->len <= dl->size && n <= dl->size - dl->len )
+  {
+    dest = dl->buf + dl->len;
+    while( n > 0 )
+    {
+      *dest++ = *src++;
+      dl->len++;
+      n--;
+    }
+  }
+  else
+  {
+    if ( dl->len > 0x0ffff - n )
+      dl->len = 0x0ffff;
+    else
+      dl->len += n;
+  }
+}
+
+static void u8g2_dl_put_byte(u8g2_dl_t *dl, uint8_t b)
+{
+  u8g2_dl_put(dl, &b, 1);
+}
+
+static void u8g2_dl_put_uint(u8g2_dl_t *dl, u8g2_uint_t v)
+{
+  u8g2_dl_put(dl, &v, sizeof(u8g2_uint_t));
+}
+
+static uint8_t *u8g2_dl_set_uint(uint8_t *p, u8g2_uint_t v)
+{
+  const uint8_t *src = (const uint8_t *)&v;
+  uint8_t n = sizeof(u8g2_uint_t);
+  while( n > 0 )
+  {
+    *p++ = *src++;
+    n--;
+  }
+  return p;
+}
+
+/* write the bounding box into the command at cmd_pos */
+static uint8_t *u8g2_dl_set_box(u8g2_dl_t *dl)
+{
+  uint8_t *p = dl->buf + dl->cmd_pos + 1;
+  p = u8g2_dl_set_uint(p, dl->x0);
+  p = u8g2_dl_set_uint(p, dl->y0);
+  p = u8g2_dl_set_uint(p, dl->x1);
+  return u8g2_dl_set_uint(p, dl->y1);
+}
+
+static void u8g2_dl_reset_box(u8g2_dl_t *dl)
+{
+  dl->x0 = (u8g2_uint_t)~(u8g2_uint_t)0;
+  dl->y0 = (u8g2_uint_t)~(u8g2_uint_t)0;
+  dl->x1 = 0;
+  dl->y1 = 0;
+}
+
+static void u8g2_dl_close_group(u8g2_dl_t *dl)
+{
+  uint8_t *p;
+  uint16_t len;
+
+  if ( dl->group_cnt == 0 )
+    return;
+  dl->group_cnt = 0;
+  if ( dl->len > dl->size )
+    return;		/* the display list will not be used */
+  p = u8g2_dl_set_box(dl);
+  len = dl->len - (uint16_t)(p + 2 - dl->buf);
+  p[0] = ((const uint8_t *)&len)[0];
+  p[1] = ((const uint8_t *)&len)[1];
+}
+
+static uint8_t u8g2_dl_get_font_mode(u8g2_t *u8g2)
+{
+  uint8_t mode = u8g2->font_decode.is_transparent;
+#ifdef U8G2_WITH_FONT_ROTATION
+  mode |= u8g2->font_decode.dir << 1;
+#endif
+  return mode;
+}
+
+static void u8g2_dl_record_font(u8g2_t *u8g2)
+{
+  u8g2_dl_t *dl = u8g2->dl;
+  uint8_t mode = u8g2_dl_get_font_mode(u8g2);
+
+  if ( u8g2->font == NULL )
+    return;
+  if ( dl->is_font_recorded != 0
+      && dl->font == u8g2->font
+      && dl->font_calc_vref == u8g2->font_calc_vref
+      && dl->font_ref_ascent == u8g2->font_ref_ascent
+      && dl->font_ref_descent == u8g2->font_ref_descent
+      && dl->font_mode == mode )
+    return;
+  dl->is_font_recorded = 1;
+  dl->font = u8g2->font;
+  dl->font_calc_vref = u8g2->font_calc_vref;
+  dl->font_ref_ascent = u8g2->font_ref_ascent;
+  dl->font_ref_descent = u8g2->font_ref_descent;
+  dl->font_mode = mode;
+
+  u8g2_dl_close_group(dl);
+  u8g2_dl_put_byte(dl, U8G2_DL_CMD(U8G2_DL_OP_FONT, 0, 0));
+  u8g2_dl_put(dl, &(u8g2->font), sizeof(u8g2->font));
+  u8g2_dl_put(dl, &(u8g2->font_calc_vref), sizeof(u8g2->font_calc_vref));
+  u8g2_dl_put_byte(dl, (uint8_t)u8g2->font_ref_ascent);
+  u8g2_dl_put_byte(dl, (uint8_t)u8g2->font_ref_descent);
+  u8g2_dl_put_byte(dl, mode);
+}
+
+static void u8g2_dl_record_clip(u8g2_t *u8g2, uint8_t is_forced)
+{
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  u8g2_dl_t *dl = u8g2->dl;
+  if ( is_forced == 0
+      && dl->clip_x0 == u8g2->clip_x0
+      && dl->clip_y0 == u8g2->clip_y0
+      && dl->clip_x1 == u8g2->clip_x1
+      && dl->clip_y1 == u8g2->clip_y1 )
+    return;
+  dl->clip_x0 = u8g2->clip_x0;
+  dl->clip_y0 = u8g2->clip_y0;
+  dl->clip_x1 = u8g2->clip_x1;
+  dl->clip_y1 = u8g2->clip_y1;
+  u8g2_dl_close_group(dl);
+  u8g2_dl_put_byte(dl, U8G2_DL_CMD(U8G2_DL_OP_CLIP, 0, 0));
+  u8g2_dl_put_uint(dl, u8g2->clip_x0);
+  u8g2_dl_put_uint(dl, u8g2->clip_y0);
+  u8g2_dl_put_uint(dl, u8g2->clip_x1);
+  u8g2_dl_put_uint(dl, u8g2->clip_y1);
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+}
+
+/*
+  Called by u8g2_FirstPage(): Start recording if a display list is assigned and page mode is active.
+  During the recording, the page window covers the whole display, so that nothing is skipped
+  by the intersection tests of the draw procedures.
+*/
+void u8g2_dl_StartRecording(u8g2_t *u8g2)
+{
+  u8g2_dl_t *dl = u8g2->dl;
+  uint8_t tile_height;
+
+  if ( dl == NULL )
+    return;
+  dl->mode = U8G2_DL_MODE_IDLE;
+  tile_height = u8g2_GetU8x8(u8g2)->display_info->tile_height;
+  if ( u8g2->tile_buf_height >= tile_height )
+    return;		/* full buffer mode, the picture loop is executed only once anyway */
+  if ( u8g2->is_auto_page_clear == 0 )
+    return;		/* the user code might depend on the previous buffer content */
+#ifdef U8G2_WITH_GRAY4
+  if ( u8g2->is_gray4 != 0 )
+    return;		/* the gray level is not part of the recording */
+#endif /* U8G2_WITH_GRAY4 */
+
+  dl->mode = U8G2_DL_MODE_RECORD;
+  dl->len = 0;
+  dl->depth = 0;
+  dl->group_cnt = 0;
+  dl->is_font_recorded = 0;
+
+  u8g2->buf_y0 = 0;
+  u8g2->buf_y1 = tile_height;
+  u8g2->buf_y1 *= 8;
+  u8g2->cb->update_page_win(u8g2);
+
+  /* all pages start with the clip window of the first pass */
+  u8g2_dl_record_clip(u8g2, 1);
+}
+
+/*
+  Called by u8g2_NextPage() after the first pass of the picture loop.
+  Returns 1 if the first page has been drawn from the display list.
+  Returns 0 if the display list did not fit into the buffer: The picture loop
+  must be repeated for each page.
+*/
+uint8_t u8g2_dl_EndRecording(u8g2_t *u8g2)
+{
+  u8g2_dl_t *dl = u8g2->dl;
+
+  u8g2_dl_close_group(dl);
+  u8g2_dl_record_clip(u8g2, 0);
+  u8g2_dl_record_font(u8g2);
+  u8g2_dl_put_byte(dl, U8G2_DL_CMD(U8G2_DL_OP_STATE, u8g2->bitmap_transparency, u8g2->draw_color));
+
+  /* restore the page window of the first page */
+  u8g2_SetBufferCurrTileRow(u8g2, 0);
+  if ( dl->len > dl->size )
+  {
+    dl->mode = U8G2_DL_MODE_IDLE;
+    return 0;
+  }
+  dl->mode = U8G2_DL_MODE_REPLAY;
+  u8g2_dl_ReplayPage(u8g2);
+  return 1;
+}
+
+/*
+  Extend the bounding box of the current string or glyph.
+  Also called by u8g2_font_decode_glyph(), which skips the decoding of the glyph during the recording.
+*/
+void u8g2_dl_ExtendBox(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t x1, u8g2_uint_t y1)
+{
+  u8g2_dl_t *dl = u8g2->dl;
+  if ( dl->x0 > x0 ) dl->x0 = x0;
+  if ( dl->y0 > y0 ) dl->y0 = y0;
+  if ( dl->x1 < x1 ) dl->x1 = x1;
+  if ( dl->y1 < y1 ) dl->y1 = y1;
+}
+
+/* called by u8g2_DrawHVLine() with the clipped line */
+void u8g2_dl_RecordHVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_dl_t *dl = u8g2->dl;
+  u8g2_uint_t x1, y1;
+
+  if ( dl->depth == 0 )
+  {
+    u8g2_dl_record_clip(u8g2, 0);
+    if ( dl->group_cnt == 0 )
+    {
+      dl->cmd_pos = dl->len;
+      u8g2_dl_put_byte(dl, U8G2_DL_CMD(U8G2_DL_OP_GROUP, 0, 0));
+      /* space for the bounding box and the size, filled by u8g2_dl_close_group() */
+      u8g2_dl_put_uint(dl, 0);
+      u8g2_dl_put_uint(dl, 0);
+      u8g2_dl_put_uint(dl, 0);
+      u8g2_dl_put_uint(dl, 0);
+      u8g2_dl_put_byte(dl, 0);
+      u8g2_dl_put_byte(dl, 0);
+      u8g2_dl_reset_box(dl);
+    }
+    u8g2_dl_put_byte(dl, U8G2_DL_CMD(U8G2_DL_OP_HVLINE, dir, u8g2->draw_color));
+    u8g2_dl_put_uint(dl, x);
+    u8g2_dl_put_uint(dl, y);
+    u8g2_dl_put_uint(dl, len);
+  }
+  
+  /* extend the bounding box of the group or the string */
+  x1 = x+1;
+  y1 = y+1;
+  if ( dir == 0 )
+    x1 = x+len;
+  else
+    y1 = y+len;
+  u8g2_dl_ExtendBox(u8g2, x, y, x1, y1);
+  
+  if ( dl->depth == 0 )
+  {
+    dl->group_cnt++;
+    if ( dl->group_cnt >= U8G2_DL_GROUP_MAX )
+      u8g2_dl_close_group(dl);
+  }
+}
+
+/*
+  Called by the box, line and bitmap procedures.
+  Returns 1 if the procedure has been recorded: The caller must return without drawing.
+*/
+uint8_t u8g2_dl_RecordCmd(u8g2_t *u8g2, uint8_t op, u8g2_uint_t a, u8g2_uint_t b, u8g2_uint_t c, u8g2_uint_t d, const uint8_t *bitmap)
+{
+  u8g2_dl_t *dl = u8g2->dl;
+
+  if ( dl->mode != U8G2_DL_MODE_RECORD || dl->depth != 0 )
+    return 0;
+  u8g2_dl_close_group(dl);
+  u8g2_dl_record_clip(u8g2, 0);
+  u8g2_dl_put_byte(dl, U8G2_DL_CMD(op, u8g2->bitmap_transparency, u8g2->draw_color));
+  u8g2_dl_put_uint(dl, a);
+  u8g2_dl_put_uint(dl, b);
+  u8g2_dl_put_uint(dl, c);
+  u8g2_dl_put_uint(dl, d);
+  if ( op >= U8G2_DL_OP_BITMAP )
+    u8g2_dl_put(dl, &bitmap, sizeof(bitmap));
+  return 1;
+}
+
+/*
+  Called at the beginning of the string and glyph procedures.
+  The procedure continues, but u8g2_DrawHVLine() will only calculate the bounding box.
+  len = 0: data is a string, which is recorded including the terminating 0.
+*/
+void u8g2_dl_BeginCapture(u8g2_t *u8g2, uint8_t op, u8g2_uint_t x, u8g2_uint_t y, const void *data, uint16_t len)
+{
+  u8g2_dl_t *dl = u8g2->dl;
+
+  if ( dl->mode != U8G2_DL_MODE_RECORD )
+    return;
+  if ( dl->depth++ != 0 )
+    return;
+  u8g2_dl_close_group(dl);
+  u8g2_dl_record_clip(u8g2, 0);
+  u8g2_dl_record_font(u8g2);
+  if ( len == 0 )
+  {
+    while( ((const char *)data)[len] != '\0' )
+      len++;
+    len++;
+  }
+  dl->cmd_pos = dl->len;
+  u8g2_dl_put_byte(dl, U8G2_DL_CMD(op, 0, u8g2->draw_color));
+  /* space for the bounding box, filled by u8g2_dl_EndCapture() */
+  u8g2_dl_put_uint(dl, 0);
+  u8g2_dl_put_uint(dl, 0);
+  u8g2_dl_put_uint(dl, 0);
+  u8g2_dl_put_uint(dl, 0);
+  u8g2_dl_put_uint(dl, x);
+  u8g2_dl_put_uint(dl, y);
+  u8g2_dl_put(dl, data, len);
+  u8g2_dl_reset_box(dl);
+}
+
+void u8g2_dl_EndCapture(u8g2_t *u8g2)
+{
+  u8g2_dl_t *dl = u8g2->dl;
+
+  if ( dl->mode != U8G2_DL_MODE_RECORD )
+    return;
+  if ( --dl->depth != 0 )
+    return;
+  if ( dl->x0 >= dl->x1 )
+  {
+    /* nothing visible, remove the command */
+    dl->len = dl->cmd_pos;
+    return;
+  }
+  if ( dl->len > dl->size )
+    return;		/* the command did not fit, the display list will not be used */
+  u8g2_dl_set_box(dl);
+}
+
+/*===============================================*/
+/* replay */
+
+static const uint8_t *u8g2_dl_get(const uint8_t *p, void *data, uint8_t n)
+{
+  uint8_t *dest = (uint8_t *)data;
+  while( n > 0 )
+  {
+    *dest++ = *p++;
+    n--;
+  }
+  return p;
+}
+
+/*
+  Called by u8g2_NextPage() after the buffer has been cleared for the next page.
+  Returns 0 if the display list is not replayed.
+*/
+uint8_t u8g2_dl_ReplayPage(u8g2_t *u8g2)
+{
+  u8g2_dl_t *dl = u8g2->dl;
+  const uint8_t *p;
+  const uint8_t *end;
+  const uint8_t *ptr;
+  u8g2_uint_t v[6];
+  uint8_t cmd, op, flag, i;
+
+  if ( dl == NULL || dl->mode != U8G2_DL_MODE_REPLAY )
+    return 0;
+  p = dl->buf;
+  end = p + dl->len;
+  while( p < end )
+  {
+    cmd = *p++;
+    op = cmd >> 4;
+    flag = (cmd >> 2) & 3;
+    for( i = 0; i < u8g2_dl_arg_cnt[op]; i++ )
+      p = u8g2_dl_get(p, v+i, sizeof(u8g2_uint_t));
+    switch(op)
+    {
+      case U8G2_DL_OP_HVLINE:
+	/* lines are culled by their group */
+	u8g2->draw_color = cmd & 3;
+	u8g2_DrawHVLine(u8g2, v[0], v[1], v[2], flag);
+	break;
+      case U8G2_DL_OP_BOX:
+	u8g2->draw_color = cmd & 3;
+	u8g2_DrawBox(u8g2, v[0], v[1], v[2], v[3]);
+	break;
+      case U8G2_DL_OP_LINE:
+	/* u8g2_DrawLine() has no intersection test */
+	if ( u8g2_IsIntersection(u8g2,
+	      v[0] < v[2] ? v[0] : v[2], v[1] < v[3] ? v[1] : v[3],
+	      (v[0] < v[2] ? v[2] : v[0])+1, (v[1] < v[3] ? v[3] : v[1])+1) != 0 )
+	{
+	  u8g2->draw_color = cmd & 3;
+	  u8g2_DrawLine(u8g2, v[0], v[1], v[2], v[3]);
+	}
+	break;
+      case U8G2_DL_OP_STR:
+      case U8G2_DL_OP_UTF8:
+	ptr = p;
+	while( *p != 0 )
+	  p++;
+	p++;
+	if ( u8g2_IsIntersection(u8g2, v[0], v[1], v[2], v[3]) != 0 )
+	{
+	  u8g2->draw_color = cmd & 3;
+	  if ( op == U8G2_DL_OP_STR )
+	    u8g2_DrawStr(u8g2, v[4], v[5], (const char *)ptr);
+	  else
+	    u8g2_DrawUTF8(u8g2, v[4], v[5], (const char *)ptr);
+	}
+	break;
+      case U8G2_DL_OP_GLYPH:
+	{
+	  uint16_t encoding;
+	  p = u8g2_dl_get(p, &encoding, sizeof(encoding));
+	  if ( u8g2_IsIntersection(u8g2, v[0], v[1], v[2], v[3]) != 0 )
+	  {
+	    u8g2->draw_color = cmd & 3;
+	    u8g2_DrawGlyph(u8g2, v[4], v[5], encoding);
+	  }
+	}
+	break;
+      case U8G2_DL_OP_BITMAP:
+      case U8G2_DL_OP_XBM:
+      case U8G2_DL_OP_XBMP:
+	/* bitmaps are culled by the intersection test of the bitmap procedures */
+	p = u8g2_dl_get(p, &ptr, sizeof(ptr));
+	u8g2->draw_color = cmd & 3;
+	u8g2->bitmap_transparency = flag;
+	if ( op == U8G2_DL_OP_BITMAP )
+	  u8g2_DrawBitmap(u8g2, v[0], v[1], v[2], v[3], ptr);
+	else if ( op == U8G2_DL_OP_XBM )
+	  u8g2_DrawXBM(u8g2, v[0], v[1], v[2], v[3], ptr);
+	else
+	  u8g2_DrawXBMP(u8g2, v[0], v[1], v[2], v[3], ptr);
+	break;
+      case U8G2_DL_OP_FONT:
+	p = u8g2_dl_get(p, &ptr, sizeof(ptr));
+	u8g2_SetFont(u8g2, ptr);
+	p = u8g2_dl_get(p, &(u8g2->font_calc_vref), sizeof(u8g2->font_calc_vref));
+	u8g2->font_ref_ascent = (int8_t)*p++;
+	u8g2->font_ref_descent = (int8_t)*p++;
+	u8g2->font_decode.is_transparent = *p & 1;
+#ifdef U8G2_WITH_FONT_ROTATION
+	u8g2->font_decode.dir = *p >> 1;
+#endif
+	p++;
+	break;
+      case U8G2_DL_OP_CLIP:
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+	u8g2_SetClipWindow(u8g2, v[0], v[1], v[2], v[3]);
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+	break;
+      case U8G2_DL_OP_STATE:
+	u8g2->draw_color = cmd & 3;
+	u8g2->bitmap_transparency = flag;
+	break;
+      case U8G2_DL_OP_GROUP:
+	{
+	  uint16_t len;
+	  p = u8g2_dl_get(p, &len, sizeof(len));
+	  /* continue with the lines of the group only if the group is visible */
+	  if ( u8g2_IsIntersection(u8g2, v[0], v[1], v[2], v[3]) == 0 )
+	    p += len;
+	}
+	break;
+    }
+  }
+  return 1;
+}
+
+#endif /* U8G2_WITH_DISPLAY_LIST */
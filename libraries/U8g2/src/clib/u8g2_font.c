@@ -681,6 +681,14 @@ int8_t u8g2_font_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
       
       if ( u8g2_IsIntersection(u8g2, x0, y0, x1, y1) == 0 ) 
 	return d;
+#ifdef U8G2_WITH_DISPLAY_LIST
+      if ( u8g2_IsDisplayListCapture(u8g2) )
+      {
+	/* the glyph is drawn during the replay, only its bounding box is required now */
+	u8g2_dl_ExtendBox(u8g2, x0, y0, x1, y1);
+	return d;
+      }
+#endif /* U8G2_WITH_DISPLAY_LIST */
     }
 #endif /* U8G2_WITH_INTERSECTION */
    
@@ -935,6 +943,11 @@ void u8g2_SetFontMode(u8g2_t *u8g2, uint8_t is_transparent)
 
 u8g2_uint_t u8g2_DrawGlyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding)
 {
+  u8g2_uint_t delta;
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2->dl != NULL )
+    u8g2_dl_BeginCapture(u8g2, U8G2_DL_OP_GLYPH, x, y, &encoding, sizeof(encoding));
+#endif /* U8G2_WITH_DISPLAY_LIST */
 #ifdef U8G2_WITH_FONT_ROTATION
   switch(u8g2->font_decode.dir)
   {
@@ -954,7 +967,12 @@ u8g2_uint_t u8g2_DrawGlyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t
 #else
   y += u8g2->font_calc_vref(u8g2);
 #endif
-  return u8g2_font_draw_glyph(u8g2, x, y, encoding);
+  delta = u8g2_font_draw_glyph(u8g2, x, y, encoding);
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2->dl != NULL )
+    u8g2_dl_EndCapture(u8g2);
+#endif /* U8G2_WITH_DISPLAY_LIST */
+  return delta;
 }
 
 u8g2_uint_t u8g2_DrawGlyphX2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding)
@@ -968,6 +986,19 @@ static u8g2_uint_t u8g2_draw_string(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
 {
   uint16_t e;
   u8g2_uint_t delta, sum;
+#ifdef U8G2_WITH_DISPLAY_LIST
+  uint8_t is_capture = 0;
+  /* record the string as one command instead of one command per glyph */
+  if ( u8g2->dl != NULL )
+  {
+    if ( u8g2->u8x8.next_cb == u8x8_ascii_next )
+      is_capture = U8G2_DL_OP_STR;
+    else if ( u8g2->u8x8.next_cb == u8x8_utf8_next )
+      is_capture = U8G2_DL_OP_UTF8;
+    if ( is_capture != 0 )
+      u8g2_dl_BeginCapture(u8g2, is_capture, x, y, str, 0);
+  }
+#endif /* U8G2_WITH_DISPLAY_LIST */
   u8x8_utf8_init(u8g2_GetU8x8(u8g2));
   sum = 0;
   for(;;)
@@ -1010,6 +1041,10 @@ static u8g2_uint_t u8g2_draw_string(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
       sum += delta;    
     }
   }
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( is_capture != 0 )
+    u8g2_dl_EndCapture(u8g2);
+#endif /* U8G2_WITH_DISPLAY_LIST */
   return sum;
 }
 
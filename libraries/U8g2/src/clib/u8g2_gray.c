@@ -0,0 +1,422 @@
+/*
+
+  u8g2_gray.c
+
+  4 bit (16 level) gray scale buffer for SSD1322, SSD1325, SSD1327, SSD1362 and SSD1363
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Distributed under the 2-clause BSD license of U8g2, see LICENSE.
+
+  Buffer layout:
+    Each pixel row has tile_width*4 bytes, one tile row (8 pixel rows)
+    has tile_width*32 bytes. The high nibble of a byte is the left pixel.
+    This is the format of the U8X8_MSG_DISPLAY_DRAW_GRAY4 message, so the
+    buffer is sent to the display without conversion.
+
+  Draw color:
+    0: set the pixel to 0
+    1: set the pixel to the gray level (u8g2_SetGrayLevel)
+    2: XOR the pixel with 15
+
+  Usage:
+    u8g2_Setup_ssd1322_nhd_256x64_1(&u8g2, ...);	// any setup procedure of the display
+    u8g2_SetupGray4Buffer(&u8g2, buf, 8, U8G2_R0);	// buf has 256*64/2 bytes for the full buffer
+
+*/
+
+#include "u8g2.h"
+
+#ifdef U8G2_WITH_GRAY4
+
+/*
+  Replace the buffer of u8g2 with a 4 bit gray scale buffer.
+  buf must have u8g2_GetGray4BufferSize(u8g2, tile_buf_height) bytes.
+  All draw procedures and the picture loop can be used as before.
+*/
+void u8g2_SetupGray4Buffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, const u8g2_cb_t *u8g2_cb)
+{
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_gray4, u8g2_cb);
+  u8g2->is_gray4 = 1;
+}
+
+/*
+  x,y		Upper left position of the line within the local buffer (not the display!)
+  len		length of the line in pixel, len must not be 0
+  dir		0: horizontal line (left to right)
+		1: vertical line (top to bottom)
+  asumption:
+    all clipping done
+*/
+void u8g2_ll_hvline_gray4(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  uint16_t offset;
+  uint16_t stride;
+  uint8_t *ptr;
+  uint8_t mask;
+  uint8_t value;
+  uint8_t is_xor;
+
+  stride = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  stride *= 4;
+
+  offset = y;		/* y might be 8 or 16 bit, but we need 16 bit, so use a 16 bit variable */
+  offset *= stride;
+  offset += x>>1;
+  ptr = u8g2->tile_buf_ptr;
+  ptr += offset;
+
+  mask = 0xf0;
+  if ( x & 1 )
+    mask = 0x0f;
+
+  is_xor = 0;
+  value = 0;
+  if ( u8g2->draw_color == 1 )
+    value = u8g2->gray_level * 0x11;
+  else if ( u8g2->draw_color != 0 )
+    is_xor = 1;
+
+  if ( dir == 0 )
+  {
+    if ( mask == 0x0f )
+    {
+      /* odd start position, the first pixel is in the low nibble */
+      if ( is_xor )
+	*ptr ^= 0x0f;
+      else
+	*ptr = (*ptr & 0xf0) | (value & 0x0f);
+      ptr++;
+      len--;
+    }
+    /* two pixel per byte */
+    while( len >= 2 )
+    {
+      if ( is_xor )
+	*ptr ^= 0xff;
+      else
+	*ptr = value;
+      ptr++;
+      len -= 2;
+    }
+    if ( len != 0 )
+    {
+      if ( is_xor )
+	*ptr ^= 0xf0;
+      else
+	*ptr = (*ptr & 0x0f) | (value & 0xf0);
+    }
+  }
+  else
+  {
+    do
+    {
+      if ( is_xor )
+	*ptr ^= mask;
+      else
+	*ptr = (*ptr & ~mask) | (value & mask);
+      ptr += stride;
+      len--;
+    } while( len != 0 );
+  }
+}
+
+/*============================================*/
+/* 4 bit bitmap */
+
+/*
+  Draw a bitmap with 4 bit per pixel. The high nibble of the first byte is
+  the upper left pixel, each row starts with a new byte ((w+1)/2 bytes per row).
+  The bitmap must be stored in PROGMEM on AVR systems.
+  Pixels with value 0 are not drawn if u8g2_SetBitmapMode() is set to transparent.
+  The draw color is not used. With a monochrome buffer, all pixels with value 8
+  or higher are set and all other pixels are cleared.
+*/
+void u8g2_DrawGray4Bitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+  uint8_t draw_color = u8g2->draw_color;
+  uint8_t gray_level = u8g2->gray_level;
+  const uint8_t *row;
+  u8g2_uint_t i, run;
+  uint8_t level, next;
+
+#ifdef U8G2_WITH_INTERSECTION
+  if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 )
+    return;
+#endif /* U8G2_WITH_INTERSECTION */
+
+  if ( w == 0 )
+    return;
+
+  row = bitmap;
+  while( h > 0 )
+  {
+    /* draw the row as runs of the same gray level */
+    level = u8x8_pgm_read(row) >> 4;
+    run = 1;
+    for( i = 1; i <= w; i++ )
+    {
+      next = 0x0ff;		/* end of the row */
+      if ( i < w )
+      {
+	next = u8x8_pgm_read(row + (i>>1));
+	if ( (i & 1) == 0 )
+	  next >>= 4;
+	next &= 15;
+      }
+      if ( next == level )
+      {
+	run++;
+	continue;
+      }
+      if ( level != 0 || u8g2->bitmap_transparency == 0 )
+      {
+	if ( u8g2->is_gray4 )
+	{
+	  u8g2->draw_color = 1;
+	  u8g2->gray_level = level;
+	}
+	else
+	{
+	  u8g2->draw_color = level >= 8 ? 1 : 0;
+	}
+	u8g2_DrawHVLine(u8g2, x+i-run, y, run, 0);
+      }
+      level = next;
+      run = 1;
+    }
+    row += (w+1)>>1;
+    y++;
+    h--;
+  }
+
+  u8g2->draw_color = draw_color;
+  u8g2->gray_level = gray_level;
+}
+
+/*============================================*/
+/* anti-aliased text */
+
+/*
+  The fonts have only one bit per pixel. The anti-aliased procedures draw the
+  glyph and smooth the steps of diagonal edges: Each background pixel, which
+  has glyph pixels on two orthogonal sides (inner corner of a step), is set to
+  half of the gray level, unless it is already brighter.
+
+  Each glyph is drawn twice into a mask: The first pass calculates the bounding
+  box of the visible glyph pixels, the second pass sets the pixels of the mask.
+  The mask is then copied to the buffer. All pixels, which are changed, are
+  inside the bounding box, so the clip window is respected.
+
+  The font is always drawn in transparent mode.
+  Glyphs which are larger than U8G2_GRAY4_AA_MAX pixel, draw color 0 and 2 and
+  monochrome buffers are drawn without smoothing.
+*/
+
+#define U8G2_GRAY4_AA_MAX 64
+#define U8G2_GRAY4_AA_STRIDE (U8G2_GRAY4_AA_MAX/8)
+
+static u8g2_uint_t u8g2_gray4_aa_x0, u8g2_gray4_aa_y0, u8g2_gray4_aa_x1, u8g2_gray4_aa_y1;	/* x1 and y1 are excluded */
+static uint8_t u8g2_gray4_aa_mask[U8G2_GRAY4_AA_STRIDE*U8G2_GRAY4_AA_MAX];
+
+static void u8g2_gray4_aa_box_hvline(U8X8_UNUSED u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_uint_t x1 = x+1;
+  u8g2_uint_t y1 = y+1;
+  if ( dir == 0 )
+    x1 = x+len;
+  else
+    y1 = y+len;
+  if ( u8g2_gray4_aa_x0 > x )
+    u8g2_gray4_aa_x0 = x;
+  if ( u8g2_gray4_aa_y0 > y )
+    u8g2_gray4_aa_y0 = y;
+  if ( u8g2_gray4_aa_x1 < x1 )
+    u8g2_gray4_aa_x1 = x1;
+  if ( u8g2_gray4_aa_y1 < y1 )
+    u8g2_gray4_aa_y1 = y1;
+}
+
+static void u8g2_gray4_aa_mask_hvline(U8X8_UNUSED u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  x -= u8g2_gray4_aa_x0;
+  y -= u8g2_gray4_aa_y0;
+  do
+  {
+    u8g2_gray4_aa_mask[y*U8G2_GRAY4_AA_STRIDE + (x>>3)] |= 1<<(x&7);
+    if ( dir == 0 )
+      x++;
+    else
+      y++;
+    len--;
+  } while( len != 0 );
+}
+
+/* returns 0 for positions outside of the mask, w and h are the size of the mask */
+static uint8_t u8g2_gray4_aa_get(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  if ( x >= w || y >= h )	/* also true for x = -1 or y = -1 */
+    return 0;
+  return (u8g2_gray4_aa_mask[y*U8G2_GRAY4_AA_STRIDE + (x>>3)] >> (x&7)) & 1;
+}
+
+static void u8g2_gray4_aa_copy_mask(u8g2_t *u8g2)
+{
+  u8g2_uint_t w = u8g2_gray4_aa_x1 - u8g2_gray4_aa_x0;
+  u8g2_uint_t h = u8g2_gray4_aa_y1 - u8g2_gray4_aa_y0;
+  u8g2_uint_t x, y, run;
+  uint8_t l, r, u, d;
+  uint8_t half = (u8g2->gray_level+1)>>1;
+  uint16_t stride;
+  uint16_t offset;
+  uint8_t *ptr;
+  uint8_t v;
+
+  stride = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  stride *= 4;
+
+  for( y = 0; y < h; y++ )
+  {
+    run = 0;
+    for( x = 0; x <= w; x++ )
+    {
+      if ( u8g2_gray4_aa_get(x, y, w, h) )
+      {
+	run++;
+	continue;
+      }
+      if ( run != 0 )
+      {
+	u8g2_ll_hvline_gray4(u8g2, u8g2_gray4_aa_x0+x-run, u8g2_gray4_aa_y0+y, run, 0);
+	run = 0;
+      }
+      if ( x == w || u8g2->draw_color != 1 )
+	continue;
+
+      /* background pixel, check for an inner corner */
+      l = u8g2_gray4_aa_get(x-1, y, w, h);
+      r = u8g2_gray4_aa_get(x+1, y, w, h);
+      u = u8g2_gray4_aa_get(x, y-1, w, h);
+      d = u8g2_gray4_aa_get(x, y+1, w, h);
+      if ( (l|r) & (u|d) )
+      {
+	offset = u8g2_gray4_aa_y0+y;
+	offset *= stride;
+	offset += (u8g2_gray4_aa_x0+x)>>1;
+	ptr = u8g2->tile_buf_ptr + offset;
+	if ( (u8g2_gray4_aa_x0+x) & 1 )
+	{
+	  v = *ptr & 0x0f;
+	  if ( v < half )
+	    *ptr = (*ptr & 0xf0) | half;
+	}
+	else
+	{
+	  v = *ptr >> 4;
+	  if ( v < half )
+	    *ptr = (*ptr & 0x0f) | (half << 4);
+	}
+      }
+    }
+  }
+}
+
+u8g2_uint_t u8g2_DrawGlyphAA(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding)
+{
+  u8g2_draw_ll_hvline_cb ll_hvline = u8g2->ll_hvline;
+  uint8_t is_transparent = u8g2->font_decode.is_transparent;
+  u8g2_uint_t delta;
+  uint16_t i, cnt;
+
+  if ( u8g2->is_gray4 == 0 )
+    return u8g2_DrawGlyph(u8g2, x, y, encoding);
+
+  /* first pass: bounding box of the visible pixels */
+  u8g2->font_decode.is_transparent = 1;
+  u8g2_gray4_aa_x0 = (u8g2_uint_t)~(u8g2_uint_t)0;
+  u8g2_gray4_aa_y0 = (u8g2_uint_t)~(u8g2_uint_t)0;
+  u8g2_gray4_aa_x1 = 0;
+  u8g2_gray4_aa_y1 = 0;
+  u8g2->ll_hvline = u8g2_gray4_aa_box_hvline;
+  delta = u8g2_DrawGlyph(u8g2, x, y, encoding);
+
+  if ( u8g2_gray4_aa_x1 > u8g2_gray4_aa_x0 )
+  {
+    if ( u8g2_gray4_aa_x1 - u8g2_gray4_aa_x0 <= U8G2_GRAY4_AA_MAX && u8g2_gray4_aa_y1 - u8g2_gray4_aa_y0 <= U8G2_GRAY4_AA_MAX )
+    {
+      /* second pass: draw into the mask */
+      cnt = u8g2_gray4_aa_y1 - u8g2_gray4_aa_y0;
+      cnt *= U8G2_GRAY4_AA_STRIDE;
+      for( i = 0; i < cnt; i++ )
+	u8g2_gray4_aa_mask[i] = 0;
+      u8g2->ll_hvline = u8g2_gray4_aa_mask_hvline;
+      u8g2_DrawGlyph(u8g2, x, y, encoding);
+      u8g2->ll_hvline = ll_hvline;
+      u8g2_gray4_aa_copy_mask(u8g2);
+    }
+    else
+    {
+      /* glyph is too large for the mask */
+      u8g2->ll_hvline = ll_hvline;
+      u8g2_DrawGlyph(u8g2, x, y, encoding);
+    }
+  }
+
+  u8g2->ll_hvline = ll_hvline;
+  u8g2->font_decode.is_transparent = is_transparent;
+  return delta;
+}
+
+static u8g2_uint_t u8g2_draw_string_aa(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str)
+{
+  uint16_t e;
+  u8g2_uint_t delta, sum;
+  u8x8_utf8_init(u8g2_GetU8x8(u8g2));
+  sum = 0;
+  for(;;)
+  {
+    e = u8g2->u8x8.next_cb(u8g2_GetU8x8(u8g2), (uint8_t)*str);
+    if ( e == 0x0ffff )
+      break;
+    str++;
+    if ( e != 0x0fffe )
+    {
+      delta = u8g2_DrawGlyphAA(u8g2, x, y, e);
+#ifdef U8G2_WITH_FONT_ROTATION
+      switch(u8g2->font_decode.dir)
+      {
+	case 0:
+	  x += delta;
+	  break;
+	case 1:
+	  y += delta;
+	  break;
+	case 2:
+	  x -= delta;
+	  break;
+	case 3:
+	  y -= delta;
+	  break;
+      }
+#else
+      x += delta;
+#endif
+      sum += delta;
+    }
+  }
+  return sum;
+}
+
+u8g2_uint_t u8g2_DrawStrAA(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str)
+{
+  u8g2->u8x8.next_cb = u8x8_ascii_next;
+  return u8g2_draw_string_aa(u8g2, x, y, str);
+}
+
+u8g2_uint_t u8g2_DrawUTF8AA(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str)
+{
+  u8g2->u8x8.next_cb = u8x8_utf8_next;
+  return u8g2_draw_string_aa(u8g2, x, y, str);
+}
+
+#endif /* U8G2_WITH_GRAY4 */
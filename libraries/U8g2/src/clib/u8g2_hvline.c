@@ -195,6 +195,13 @@ void u8g2_DrawHVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len
 	  return;
       }
       
+#ifdef U8G2_WITH_DISPLAY_LIST
+      if ( u8g2_IsDisplayListRecording(u8g2) )
+      {
+	u8g2_dl_RecordHVLine(u8g2, x, y, len, dir);
+	return;
+      }
+#endif /* U8G2_WITH_DISPLAY_LIST */
       
       u8g2->cb->draw_l90(u8g2, x, y, len, dir);
     }
@@ -46,6 +46,11 @@ void u8g2_DrawLine(u8g2_t *u8g2, u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2,
 
   uint8_t swapxy = 0;
   
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2->dl != NULL && u8g2_dl_RecordCmd(u8g2, U8G2_DL_OP_LINE, x1, y1, x2, y2, NULL) )
+    return;
+#endif /* U8G2_WITH_DISPLAY_LIST */
+
   /* no intersection check at the moment, should be added... */
 
   if ( x1 > x2 ) dx = x1-x2; else dx = x2-x1;
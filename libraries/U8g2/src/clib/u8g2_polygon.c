@@ -344,3 +344,245 @@ void u8g2_DrawTriangle(u8g2_t *u8g2, int16_t x0, int16_t y0, int16_t x1, int16_t
   u8g2_DrawPolygon(u8g2);
 }
 
+
+/*===========================================*/
+/* edge table polygon filler */
+
+/*
+  u8g2_FillPolygon() and u8g2_FillPath() fill polygons with any number of points.
+  There are no global variables: The points and the edge table are provided by the caller.
+  The edge table must have one entry for each point. It is overwritten by the fill procedure.
+  
+  The pixel (x,y) is set, if the point (x,y) is inside the polygon. Points on a left or upper edge 
+  belong to the polygon, points on a right or lower edge do not belong to the polygon:
+  The polygon (0,0), (10,0), (10,5), (0,5) sets the same pixels as u8g2_DrawBox(u8g2, 0, 0, 10, 5).
+  Polygons with a common edge do not overlap and there is no gap between them.
+  
+  Algorithm:
+  1. The non horizontal edges, which intersect with the current page and clip window, are copied 
+     into the edge table. The edge table is sorted by the upper y position of the edges.
+  2. The edge table is processed scan line by scan line, but only for the scan lines of the current page.
+     The active edges are kept at the start of the unprocessed part of the edge table and are sorted by x.
+     Edges, which start above the page, are moved to the first scan line of the page.
+  3. The fill rule decides, which spans between the active edges are drawn. The spans are 
+     clipped and drawn directly with the draw procedure of the display rotation.
+
+  The x position of an edge is the smallest integer, which is not left of the exact intersection
+  with the scan line: x - r/h is the exact intersection, 0 <= r < h. The next scan line
+  adds q + m/h to the exact intersection.
+  
+  Coordinates must be within -16384..16383.
+*/
+
+static void pg_edge_swap(u8g2_pg_edge_t *a, u8g2_pg_edge_t *b)
+{
+  u8g2_pg_edge_t t = *a;
+  *a = *b;
+  *b = t;
+}
+
+/* 
+  calculate the intersection with the scan line y, y >= y0 
+  before this call, x is the upper x position and q is the lower x position of the edge
+*/
+static void pg_edge_init(u8g2_pg_edge_t *e, int16_t y)
+{
+  uint16_t h = e->h;
+  uint16_t dx;
+  uint32_t p;
+  
+  p = (uint16_t)(y - e->y0);		/* number of skipped scan lines */
+  if ( e->q >= e->x )
+  {
+    dx = (uint16_t)e->q - (uint16_t)e->x;
+    e->q = dx / h;
+    e->m = dx % h;
+    p *= dx;
+    e->x += (int16_t)(p / h);
+    e->r = p % h;
+    if ( e->r != 0 )
+    {
+      e->x++;
+      e->r = h - e->r;
+    }
+  }
+  else
+  {
+    dx = (uint16_t)e->x - (uint16_t)e->q;
+    e->q = -(int16_t)(dx / h);
+    e->m = dx % h;
+    if ( e->m != 0 )
+    {
+      e->q--;
+      e->m = h - e->m;
+    }
+    p *= dx;
+    e->x -= (int16_t)(p / h);
+    e->r = p % h;
+  }
+}
+
+static void pg_edge_next(u8g2_pg_edge_t *e)
+{
+  if ( e->r < e->m )
+  {
+    e->r += e->h - e->m;
+    e->x++;
+  }
+  else
+  {
+    e->r -= e->m;
+  }
+  e->x += e->q;
+}
+
+/* draw the span x0 (included) to x1 (excluded) */
+static void pg_span(u8g2_t *u8g2, int16_t x0, int16_t x1, int16_t y)
+{
+  if ( x0 < (int16_t)u8g2->user_x0 )
+    x0 = u8g2->user_x0;
+  if ( x1 > (int16_t)u8g2->user_x1 )
+    x1 = u8g2->user_x1;
+  if ( x0 >= x1 )
+    return;
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2_IsDisplayListRecording(u8g2) )
+  {
+    u8g2_DrawHVLine(u8g2, x0, y, x1-x0, 0);
+    return;
+  }
+#endif /* U8G2_WITH_DISPLAY_LIST */
+  /* the span is already clipped against the user window */
+  u8g2->cb->draw_l90(u8g2, x0, y, x1-x0, 0);
+}
+
+void u8g2_FillPath(u8g2_t *u8g2, const u8g2_pg_point_t *pts, const uint16_t *contour_end, uint8_t contour_cnt, u8g2_pg_edge_t *edges, uint8_t rule)
+{
+  const u8g2_pg_point_t *p0, *p1;
+  u8g2_pg_edge_t *e;
+  uint16_t first, i, j;
+  uint16_t cnt;		/* number of edges in the edge table */
+  uint16_t active;	/* first active edge */
+  uint16_t next;		/* first edge, which is not yet active */
+  uint8_t c;
+  int16_t win_y0, win_y1, y, y_end;
+  int16_t x_min, x_max;
+  int16_t x;
+  int16_t w, w_prev;
+
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  if ( u8g2->is_page_clip_window_intersection == 0 )
+    return;
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+
+  win_y0 = u8g2->user_y0;
+  win_y1 = u8g2->user_y1;
+  
+  /* build the edge table, only edges which intersect with the window rows are required */
+  cnt = 0;
+  first = 0;
+  x_min = 0x7fff;
+  x_max = -0x7fff;
+  y = win_y1;
+  y_end = win_y0;
+  for( c = 0; c < contour_cnt; c++ )
+  {
+    for( i = first; i < contour_end[c]; i++ )
+    {
+      p0 = pts + i;
+      p1 = pts + (i+1 < contour_end[c] ? i+1 : first);
+      if ( p0->y == p1->y )
+	continue;
+      e = edges + cnt;
+      if ( p0->y < p1->y )
+      {
+	e->dir = 1;
+      }
+      else
+      {
+	e->dir = -1;
+	p1 = p0;
+	p0 = pts + (i+1 < contour_end[c] ? i+1 : first);
+      }
+      if ( p1->y <= win_y0 || p0->y >= win_y1 )
+	continue;
+      e->y0 = p0->y;
+      e->y1 = p1->y;
+      e->h = (uint16_t)p1->y - (uint16_t)p0->y;
+      e->x = p0->x;
+      e->q = p1->x;
+      if ( x_min > p0->x ) x_min = p0->x;
+      if ( x_min > p1->x ) x_min = p1->x;
+      if ( x_max < p0->x ) x_max = p0->x;
+      if ( x_max < p1->x ) x_max = p1->x;
+      if ( y > p0->y ) y = p0->y;
+      if ( y_end < p1->y ) y_end = p1->y;
+      
+      /* insertion sort by the upper y position */
+      for( j = cnt; j > 0 && edges[j-1].y0 > edges[j].y0; j-- )
+	pg_edge_swap(edges+j-1, edges+j);
+      cnt++;
+    }
+    first = contour_end[c];
+  }
+  
+  /* clip against the window */
+  if ( x_max < (int16_t)u8g2->user_x0 || x_min >= (int16_t)u8g2->user_x1 )
+    return;
+  if ( y < win_y0 )
+    y = win_y0;
+  if ( y_end > win_y1 )
+    y_end = win_y1;
+  
+  active = 0;
+  next = 0;
+  for( ; y < y_end; y++ )
+  {
+    /* activate the edges, which start at this scan line (or above the window) */
+    while( next < cnt && edges[next].y0 <= y )
+    {
+      pg_edge_init(edges+next, y);
+      next++;
+    }
+    
+    /* sort the active edges by x, the order changes only at intersections of the edges */
+    for( i = active+1; i < next; i++ )
+      for( j = i; j > active && edges[j-1].x > edges[j].x; j-- )
+	pg_edge_swap(edges+j-1, edges+j);
+    
+    /* draw the spans, w is the winding number left of the current edge */
+    w = 0;
+    x = 0;
+    for( i = active; i < next; i++ )
+    {
+      w_prev = w;
+      if ( rule == U8G2_PG_EVEN_ODD )
+	w ^= 1;
+      else
+	w += edges[i].dir;
+      if ( w_prev == 0 )
+	x = edges[i].x;
+      else if ( w == 0 )
+	pg_span(u8g2, x, edges[i].x, y);
+    }
+    
+    /* move to the next scan line, remove finished edges */
+    for( i = active; i < next; i++ )
+    {
+      if ( edges[i].y1 <= y+1 )
+      {
+	pg_edge_swap(edges+i, edges+active);
+	active++;
+      }
+      else
+      {
+	pg_edge_next(edges+i);
+      }
+    }
+  }
+}
+
+void u8g2_FillPolygon(u8g2_t *u8g2, const u8g2_pg_point_t *pts, uint16_t cnt, u8g2_pg_edge_t *edges, uint8_t rule)
+{
+  u8g2_FillPath(u8g2, pts, &cnt, 1, edges, rule);
+}
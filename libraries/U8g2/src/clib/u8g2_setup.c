@@ -88,6 +88,13 @@ void u8g2_SetupBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, u8g2_
   u8g2->font_height_mode = 0; /* issue 2046 */
   u8g2->draw_color = 1;
   u8g2->is_auto_page_clear = 1;
+#ifdef U8G2_WITH_DISPLAY_LIST
+  u8g2->dl = NULL;
+#endif /* U8G2_WITH_DISPLAY_LIST */
+#ifdef U8G2_WITH_GRAY4
+  u8g2->is_gray4 = 0;
+  u8g2->gray_level = 15;
+#endif /* U8G2_WITH_GRAY4 */
   
   u8g2->cb = u8g2_cb;
   u8g2->cb->update_dimension(u8g2);
@@ -464,6 +471,14 @@ void u8g2_Setup_null(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_c
   u8g2_SetupBuffer(u8g2, buf, 1, u8g2_ll_hvline_vertical_top_lsb, rotation);
 }
 
+/* setup for the memory display, see u8x8_d_memory.c */
+void u8g2_Setup_memory(u8g2_t *u8g2, const u8g2_cb_t *rotation, uint8_t tile_width, uint8_t tile_height, uint8_t *ram, uint8_t *buf, uint8_t tile_buf_height, u8x8_msg_cb gpio_and_delay_cb)
+{
+  u8x8_memory_Init(tile_width, tile_height, ram);
+  u8g2_SetupDisplay(u8g2, u8x8_d_memory, u8x8_cad_001, u8x8_byte_memory, gpio_and_delay_cb);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+
 
   
   
\ No newline at end of file
@@ -50,39 +50,57 @@ static uint8_t u8log_is_on_screen(u8log_t *u8log, uint8_t x, uint8_t y)
 }
 */
 
+/*
+  The screen buffer is a ring buffer with buf_height rows. The terminal lines
+  start at first_row, the history_cnt rows before first_row contain the 
+  history. Scrolling only moves first_row.
+*/
+
+/* return the row in the screen buffer for the terminal line (line < height) */
+static uint8_t *u8log_get_row(u8log_t *u8log, uint8_t line)
+{
+  uint16_t row = u8log->first_row;
+  row += line;
+  if ( row >= u8log->buf_height )
+    row -= u8log->buf_height;
+  return u8log->screen_buffer + row * u8log->width;
+}
+
+static void u8log_clear_row(u8log_t *u8log, uint8_t line)
+{
+  memset(u8log_get_row(u8log, line), ' ', u8log->width);
+}
+
 static void u8log_clear_screen(u8log_t *u8log)
 {
-  uint8_t *dest = u8log->screen_buffer;
-  uint16_t cnt = u8log->height;
-  cnt *= u8log->width;
-  do
-  {
-    *dest++ = ' ';
-    cnt--;
-  } while( cnt > 0 );
-  
+  uint8_t line;
+  for( line = 0; line < u8log->height; line++ )
+    u8log_clear_row(u8log, line);
+  u8log->scroll_cnt = u8log->height;		/* all lines are new */
+  u8log->update_first = 0;
 }
 
 
-/* scroll the content of the complete buffer, set redraw_line to 255 */
+/* scroll the terminal lines by one line, the first line goes to the history */
 static void u8log_scroll_up(u8log_t *u8log)
 {
-  uint8_t *dest = u8log->screen_buffer;
-  uint8_t *src = dest+u8log->width;
-  uint16_t cnt = u8log->height;
-  cnt--;
-  cnt *= u8log->width;
-  do
-  {
-    *dest++ = *src++;
-    cnt--;
-  } while( cnt > 0 );
-  cnt = u8log->width;
-  do
-  {
-    *dest++ = ' ';
-    cnt--;
-  } while(cnt > 0);
+  u8log->first_row++;
+  if ( u8log->first_row >= u8log->buf_height )
+    u8log->first_row = 0;
+  u8log_clear_row(u8log, u8log->height-1);
+  
+  if ( u8log->history_cnt < u8log->buf_height - u8log->height )
+    u8log->history_cnt++;
+  /* keep the scrolled back view at the same text, as long as it is in the history */
+  if ( u8log->view_offset != 0 && u8log->view_offset < u8log->history_cnt )
+    u8log->view_offset++;
+
+  if ( u8log->scroll_cnt < 255 )
+    u8log->scroll_cnt++;
+  if ( u8log->update_first > u8log->height )
+    u8log->update_first = u8log->height;
+  if ( u8log->update_first > 0 )
+    u8log->update_first--;
   
   if ( u8log->is_redraw_line_for_each_char )
     u8log->is_redraw_all = 1;
@@ -114,8 +132,10 @@ static void u8log_cursor_on_screen(u8log_t *u8log)
 static void u8log_write_to_screen(u8log_t *u8log, uint8_t c)
 {
   u8log_cursor_on_screen(u8log);
-  u8log->screen_buffer[u8log->cursor_y * u8log->width + u8log->cursor_x] = c;
+  u8log_get_row(u8log, u8log->cursor_y)[u8log->cursor_x] = c;
   u8log->cursor_x++;
+  if ( u8log->update_first > u8log->cursor_y )
+    u8log->update_first = u8log->cursor_y;
   
   if ( u8log->is_redraw_line_for_each_char )
   {
@@ -169,15 +189,29 @@ void u8log_write_char(u8log_t *u8log, uint8_t c)
   }
 }
 
-void u8log_Init(u8log_t *u8log, uint8_t width, uint8_t height, uint8_t *buf)
+/*
+  history: number of additional lines, which keep the text scrolled out of the terminal.
+  The size of buf must be width*(height+history) bytes. history is limited to 255-height lines,
+  buf may be smaller than width*(height+history) in this case.
+*/
+void u8log_InitWithHistory(u8log_t *u8log, uint8_t width, uint8_t height, uint8_t history, uint8_t *buf)
 {
   memset(u8log, 0, sizeof(u8log_t));
   u8log->width = width;
   u8log->height = height;
+  /* buf_height is 8 bit */
+  if ( history > 255 - height )
+    history = 255 - height;
+  u8log->buf_height = height + history;
   u8log->screen_buffer = buf;
   u8log_clear_screen(u8log);
 }
 
+void u8log_Init(u8log_t *u8log, uint8_t width, uint8_t height, uint8_t *buf)
+{
+  u8log_InitWithHistory(u8log, width, height, 0, buf);
+}
+
 void u8log_SetCallback(u8log_t *u8log, u8log_cb cb, void *aux_data)
 {
   u8log->cb = cb;
@@ -197,17 +231,35 @@ void u8log_SetLineHeightOffset(u8log_t *u8log, int8_t line_height_offset)
 
 
 
+static void u8log_redraw(u8log_t *u8log)
+{
+  if ( u8log->cb != 0 )
+  {
+    u8log->cb(u8log);
+  }
+  u8log->is_redraw_line = 0;
+  u8log->is_redraw_all = 0;
+  u8log->scroll_cnt = 0;
+  u8log->update_first = 255;
+}
+
+/*
+  The display is not updated while the view is scrolled back into the history.
+*/
 void u8log_WriteChar(u8log_t *u8log, uint8_t c)
 {
   u8log_write_char(u8log, c);
   if ( u8log->is_redraw_line || u8log->is_redraw_all )
   {
-    if ( u8log->cb != 0 )
+    if ( u8log->view_offset != 0 )
+    {
+      u8log->is_redraw_line = 0;
+      u8log->is_redraw_all = 0;
+    }
+    else
     {
-      u8log->cb(u8log);
+      u8log_redraw(u8log);
     }
-    u8log->is_redraw_line = 0;
-    u8log->is_redraw_all = 0;
   }
 }
 
@@ -259,3 +311,35 @@ void u8log_WriteDec16(u8log_t *u8log, uint16_t v, uint8_t d)
 {
   u8log_WriteString(u8log, u8x8_u16toa(v, d));
 }
+
+/* 
+  return the text of a line of the view (line < height), the line has width chars 
+  without '\0' at the end. With view offset 0 this is the terminal line.
+*/
+uint8_t *u8log_GetLine(u8log_t *u8log, uint8_t line)
+{
+  uint16_t row = u8log->first_row;
+  row += u8log->buf_height;
+  row -= u8log->view_offset;
+  row += line;
+  while ( row >= u8log->buf_height )
+    row -= u8log->buf_height;
+  return u8log->screen_buffer + row * u8log->width;
+}
+
+/*
+  Scroll the view back into the history by view_offset lines (limited to 
+  u8log_GetHistoryCnt()) and redraw the view. 0 returns to the live view.
+*/
+void u8log_SetViewOffset(u8log_t *u8log, uint8_t view_offset)
+{
+  if ( view_offset > u8log->history_cnt )
+    view_offset = u8log->history_cnt;
+  if ( u8log->view_offset == view_offset )
+    return;
+  u8log->view_offset = view_offset;
+  u8log->scroll_cnt = u8log->height;		/* all lines are new */
+  u8log->update_first = 0;
+  u8log->is_redraw_all = 1;
+  u8log_redraw(u8log);
+}
@@ -36,25 +36,24 @@
 
 #include "u8x8.h"
 
-static void u8x8_DrawLogLine(u8x8_t *u8x8, uint8_t disp_x, uint8_t disp_y, uint8_t buf_y, u8log_t *u8log) U8X8_NOINLINE;
-static void u8x8_DrawLogLine(u8x8_t *u8x8, uint8_t disp_x, uint8_t disp_y, uint8_t buf_y, u8log_t *u8log)
+static void u8x8_DrawLogLine(u8x8_t *u8x8, uint8_t disp_x, uint8_t disp_y, uint8_t line, u8log_t *u8log) U8X8_NOINLINE;
+static void u8x8_DrawLogLine(u8x8_t *u8x8, uint8_t disp_x, uint8_t disp_y, uint8_t line, u8log_t *u8log)
 {
   uint8_t buf_x;
-  uint8_t c;
+  uint8_t *s = u8log_GetLine(u8log, line);
   for( buf_x = 0; buf_x < u8log->width; buf_x++ )
   {
-    c = u8log->screen_buffer[buf_y * u8log->width + buf_x];
-    u8x8_DrawGlyph(u8x8, disp_x, disp_y, c);
+    u8x8_DrawGlyph(u8x8, disp_x, disp_y, *s++);
     disp_x++;
   }
 }
 
 void u8x8_DrawLog(u8x8_t *u8x8, uint8_t x, uint8_t y, u8log_t *u8log)
 {
-  uint8_t buf_y;
-  for( buf_y = 0; buf_y < u8log->height; buf_y++ )
+  uint8_t line;
+  for( line = 0; line < u8log->height; line++ )
   {
-    u8x8_DrawLogLine(u8x8, x, y, buf_y, u8log);
+    u8x8_DrawLogLine(u8x8, x, y, line, u8log);
     y++;
   }
 }
@@ -73,3 +72,59 @@ void u8log_u8x8_cb(u8log_t * u8log)
   }
 }
 
+/*
+  u8log callback for u8x8 with incremental redraw.
+  
+  Only the lines changed since the last callback are drawn. If the terminal 
+  has scrolled, all lines are drawn, except if the terminal covers all rows 
+  of the display and the display supports U8X8_MSG_DISPLAY_SET_START_LINE:
+  Then the display start line is moved by the number of scrolled lines and 
+  only the new lines are drawn.
+  
+  The terminal is drawn at the upper left corner of the display. Other output
+  to the display (u8x8_DrawString, u8x8_DrawLog, ...) will appear shifted by
+  the start line.
+*/
+void u8log_u8x8_start_line_cb(u8log_t * u8log)
+{
+  u8x8_t *u8x8 = (u8x8_t *)(u8log->aux_data);
+  uint8_t rows = u8x8_GetRows(u8x8);
+  uint8_t line, last, y;
+  
+  if ( u8log->update_first >= u8log->height )
+    return;		/* nothing has changed */
+  
+  line = u8log->update_first;
+  if ( u8log->scroll_cnt >= u8log->height )
+  {
+    line = 0;
+  }
+  else if ( u8log->scroll_cnt > 0 )
+  {
+    line = 0;
+    if ( u8log->height == rows )
+    {
+      y = u8log->start_row + u8log->scroll_cnt;
+      if ( y >= rows )
+        y -= rows;
+      if ( u8x8_SetStartLine(u8x8, y*8) != 0 )
+      {
+        u8log->start_row = y;
+        line = u8log->update_first;
+      }
+    }
+  }
+  
+  last = u8log->cursor_y;
+  if ( last >= u8log->height || u8log->scroll_cnt > 0 )
+    last = u8log->height-1;
+
+  y = u8log->start_row + line;
+  for( ; line <= last; line++ )
+  {
+    if ( y >= rows )
+      y -= rows;
+    u8x8_DrawLogLine(u8x8, 0, y, line, u8log);
+    y++;
+  }
+}
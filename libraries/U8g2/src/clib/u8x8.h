@@ -363,6 +363,7 @@ struct u8x8_struct
   uint8_t debounce_last_pin_state;
   uint8_t debounce_state;
   uint8_t debounce_result_msg;	/* result msg or event after debounce */
+  uint8_t start_line;		/* U8X8_MSG_DISPLAY_SET_START_LINE: current display RAM start line */
 #ifdef U8X8_WITH_USER_PTR
   void *user_ptr;
 #endif
@@ -416,7 +417,7 @@ struct u8log_struct
   void *aux_data;		/* pointer to u8x8 or u8g2 */
   uint8_t width, height;	/* size of the terminal */
   u8log_cb cb;			/* callback redraw function */
-  uint8_t *screen_buffer;	/* size must be width*height bytes */
+  uint8_t *screen_buffer;	/* size must be width*(height+history) bytes */
   uint8_t is_redraw_line_for_each_char;
   int8_t line_height_offset;		/* extra offset for the line height (u8g2 only) */
   
@@ -427,6 +428,15 @@ struct u8log_struct
   uint8_t is_redraw_line;
   uint8_t is_redraw_all;
   uint8_t is_redraw_all_required_for_next_nl; /* in nl mode, redraw all instead of current line */
+  
+  /* ring buffer and incremental redraw */
+  uint8_t buf_height;		/* number of lines in screen_buffer: height plus the history lines */
+  uint8_t first_row;		/* row of the first terminal line in screen_buffer */
+  uint8_t history_cnt;	/* number of valid history lines before the first terminal line */
+  uint8_t view_offset;	/* number of lines the view is scrolled back into the history, 0: live view */
+  uint8_t scroll_cnt;		/* lines scrolled since the last callback, height or more: all lines are new */
+  uint8_t update_first;	/* first terminal line changed since the last callback, height or more: none */
+  uint8_t start_row;		/* u8log_u8x8_start_line_cb: display tile row of the first terminal line */
 };
 
 
@@ -533,6 +543,48 @@ void u8x8_d_helper_display_init(u8x8_t *u8g2);
 */
 #define U8X8_MSG_DISPLAY_REFRESH 16
 
+/*
+  Name: 	U8X8_MSG_DISPLAY_DRAW_GRAY4
+  Args:	
+    arg_int: -
+    arg_ptr: pointer to u8x8_tile_t
+        uint8_t *tile_ptr;	pointer to the first byte of the first pixel row
+	uint8_t cnt;		number of tiles
+	uint8_t x_pos;		first tile x position
+	uint8_t y_pos;		first tile y position 
+  Tasks:
+    Draw cnt tiles with 4 bit per pixel (16 gray levels) for 4 bit gray 
+    scale controllers. The tiles are not stored as 8 byte blocks, instead
+    "tile_ptr" points to 8 pixel rows with 4*cnt bytes each. The rows are 
+    4*display_info->tile_width bytes apart, which is the layout of the 4 bit 
+    buffer of u8g2_SetupGray4Buffer(). 
+    The high nibble of the first byte is the upper left pixel, a 
+    nibble value of 15 is the brightest level.
+    Only some gray scale displays support this message. Others return 0.
+  Use
+    uint8_t u8x8_DrawGray4Tile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr)
+  to send the message to the display handler.
+*/
+#define U8X8_MSG_DISPLAY_DRAW_GRAY4 17
+
+/*
+  Name: 	U8X8_MSG_DISPLAY_SET_START_LINE
+  Args:	
+    arg_int: display RAM pixel row, which is shown in the first line of the display (0..8*tile_height-1)
+    arg_ptr: -
+  Tasks:
+    Scroll the display content without changing the display RAM. The RAM rows 
+    wrap around, so the RAM row arg_int-1 is shown in the last line of the display.
+    The tile positions of U8X8_MSG_DISPLAY_DRAW_TILE refer to the RAM and
+    will appear shifted by the start line.
+    The start line must be kept after U8X8_MSG_DISPLAY_DRAW_TILE.
+    Only supported if the display RAM height matches the display height. Others return 0.
+  Use
+    uint8_t u8x8_SetStartLine(u8x8_t *u8x8, uint8_t line)
+  to send the message to the display handler.
+*/
+#define U8X8_MSG_DISPLAY_SET_START_LINE 18
+
 /*==========================================*/
 /* u8x8_setup.c */
 
@@ -551,6 +603,8 @@ void u8x8_Setup(u8x8_t *u8x8, u8x8_msg_cb display_cb, u8x8_msg_cb cad_cb, u8x8_m
 /*==========================================*/
 /* u8x8_display.c */
 uint8_t u8x8_DrawTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr);
+uint8_t u8x8_DrawGray4Tile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr);	/* returns 0 if not supported by the display */
+uint8_t u8x8_SetStartLine(u8x8_t *u8x8, uint8_t line);	/* returns 0 if not supported by the display */
 
 /* 
   After a call to u8x8_SetupDefaults, 
@@ -1055,6 +1109,14 @@ uint8_t u8x8_d_gp1294ai_256x48(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void
 
 
 
+/*==========================================*/
+/* u8x8_gray.c */
+
+/* expand monochrome tiles for 4 bit gray scale controllers, see U8X8_MSG_DISPLAY_DRAW_GRAY4 for the gray scale data */
+void u8x8_ConvertColumnPairTo4bpp(uint8_t *dest, uint8_t a, uint8_t b, uint8_t stride);
+uint8_t *u8x8_ConvertTileTo4bpp(uint8_t *dest, const uint8_t *tile, uint8_t pair_cnt, uint8_t stride);
+void u8x8_SendGray4Rows(u8x8_t *u8x8, uint8_t *ptr, uint8_t cnt);
+
 /*==========================================*/
 /* u8x8_8x8.c */
 
@@ -1128,6 +1190,34 @@ uint8_t u8x8_UserInterfaceSelectionList(u8x8_t *u8x8, const char *title, uint8_t
 /* u8x8_message.c  */
 uint8_t u8x8_UserInterfaceMessage(u8x8_t *u8x8, const char *title1, const char *title2, const char *title3, const char *buttons);
 
+/*==========================================*/
+/* u8x8_d_memory.c */
+
+typedef struct u8x8_memory_struct u8x8_memory_t;
+
+struct u8x8_memory_struct
+{
+  uint8_t *ram;		/* display RAM, tile_width*tile_height*8 bytes, vertical top lsb like the u8g2 buffer */
+  void (*frame_cb)(u8x8_t *u8x8);	/* called for each U8X8_MSG_DISPLAY_REFRESH (end of a u8g2 picture), can be NULL */
+  u8x8_display_info_t display_info;
+  uint8_t dc;			/* current DC line of the byte callback */
+  
+  /* statistics, cleared by u8x8_memory_ResetStatistics() */
+  uint32_t cmd_bytes;		/* bytes sent with DC=0 */
+  uint32_t data_bytes;		/* bytes sent with DC=1 */
+  uint32_t transfer_cnt;	/* number of transfers (chip select) */
+  uint32_t frame_cnt;		/* number of U8X8_MSG_DISPLAY_REFRESH */
+};
+
+extern u8x8_memory_t u8x8_memory;
+
+void u8x8_memory_Init(uint8_t tile_width, uint8_t tile_height, uint8_t *ram);
+void u8x8_memory_ResetStatistics(void);
+void u8x8_memory_WritePBM(void (*out)(const char *s));
+uint8_t u8x8_d_memory(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+uint8_t u8x8_byte_memory(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+void u8x8_Setup_memory(u8x8_t *u8x8, uint8_t tile_width, uint8_t tile_height, uint8_t *ram, u8x8_msg_cb gpio_and_delay_cb);
+
 /*==========================================*/
 /* u8x8_capture.c */
 
@@ -1157,6 +1247,7 @@ uint8_t u8x8_UserInterfaceInputValue(u8x8_t *u8x8, const char *title, const char
 /*==========================================*/
 /* u8log.c */
 void u8log_Init(u8log_t *u8log, uint8_t width, uint8_t height, uint8_t *buf);
+void u8log_InitWithHistory(u8log_t *u8log, uint8_t width, uint8_t height, uint8_t history, uint8_t *buf);
 void u8log_SetCallback(u8log_t *u8log, u8log_cb cb, void *aux_data);
 void u8log_SetRedrawMode(u8log_t *u8log, uint8_t is_redraw_line_for_each_char);
 void u8log_SetLineHeightOffset(u8log_t *u8log, int8_t line_height_offset);
@@ -1167,11 +1258,16 @@ void u8log_WriteHex16(u8log_t *u8log, uint16_t v);
 void u8log_WriteHex32(u8log_t *u8log, uint32_t v);
 void u8log_WriteDec8(u8log_t *u8log, uint8_t v, uint8_t d);
 void u8log_WriteDec16(u8log_t *u8log, uint16_t v, uint8_t d);
+uint8_t *u8log_GetLine(u8log_t *u8log, uint8_t line);
+void u8log_SetViewOffset(u8log_t *u8log, uint8_t view_offset);
+#define u8log_GetViewOffset(u8log) ((u8log)->view_offset)
+#define u8log_GetHistoryCnt(u8log) ((u8log)->history_cnt)
 
 /*==========================================*/
 /* u8log_u8x8.c */
 void u8x8_DrawLog(u8x8_t *u8x8, uint8_t x, uint8_t y, u8log_t *u8log);
 void u8log_u8x8_cb(u8log_t * u8log);
+void u8log_u8x8_start_line_cb(u8log_t * u8log);
 
 
 /*==========================================*/
@@ -0,0 +1,189 @@
+/*
+
+  u8x8_d_memory.c
+  
+  Memory display: Keeps the display RAM in memory and counts the bytes sent to the display.
+  
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Distributed under the 2-clause BSD license of U8g2, see LICENSE.
+
+*/
+
+#include "u8x8.h"
+#include <string.h>
+
+/*
+  The memory display accepts any size up to 255x255 tiles. The display RAM
+  has the same layout as the u8g2 buffer (vertical top lsb, u8x8_capture_get_pixel_1):
+  tile_width*tile_height*8 bytes.
+  
+  The tiles are sent to the byte callback like a SSD1306 controller in page 
+  addressing mode (three command bytes and the tile data per tile row). 
+  u8x8_byte_memory counts the command and data bytes, so that the bus 
+  traffic of a picture can be measured without hardware.
+  
+  There is only one memory display, the state is kept in the global u8x8_memory.
+*/
+
+u8x8_memory_t u8x8_memory;
+
+static const u8x8_display_info_t u8x8_memory_display_info =
+{
+  /* chip_enable_level = */ 0,
+  /* chip_disable_level = */ 1,
+  
+  /* post_chip_enable_wait_ns = */ 0,
+  /* pre_chip_disable_wait_ns = */ 0,
+  /* reset_pulse_width_ms = */ 0, 
+  /* post_reset_wait_ms = */ 0, 
+  /* sda_setup_time_ns = */ 0,		
+  /* sck_pulse_width_ns = */ 0,
+  /* sck_clock_hz = */ 8000000UL,
+  /* spi_mode = */ 0,
+  /* i2c_bus_clock_100kHz = */ 4,
+  /* data_setup_time_ns = */ 0,
+  /* write_pulse_width_ns = */ 0,
+  /* tile_width = */ 16,		/* replaced by u8x8_memory_Init() */
+  /* tile_hight = */ 8,
+  /* default_x_offset = */ 0,
+  /* flipmode_x_offset = */ 0,
+  /* pixel_width = */ 128,
+  /* pixel_height = */ 64
+};
+
+/*
+  Prepare the memory display for the u8x8 or u8g2 setup.
+  ram must have tile_width*tile_height*8 bytes.
+*/
+void u8x8_memory_Init(uint8_t tile_width, uint8_t tile_height, uint8_t *ram)
+{
+  memset(&u8x8_memory, 0, sizeof(u8x8_memory_t));
+  u8x8_memory.display_info = u8x8_memory_display_info;
+  u8x8_memory.display_info.tile_width = tile_width;
+  u8x8_memory.display_info.tile_height = tile_height;
+  u8x8_memory.display_info.pixel_width = (uint16_t)tile_width*8;
+  u8x8_memory.display_info.pixel_height = (uint16_t)tile_height*8;
+  u8x8_memory.ram = ram;
+}
+
+void u8x8_memory_ResetStatistics(void)
+{
+  u8x8_memory.cmd_bytes = 0;
+  u8x8_memory.data_bytes = 0;
+  u8x8_memory.transfer_cnt = 0;
+  u8x8_memory.frame_cnt = 0;
+}
+
+/* write the display RAM as PBM image, see u8x8_capture_write_pbm_pre() */
+void u8x8_memory_WritePBM(void (*out)(const char *s))
+{
+  u8x8_capture_write_pbm_pre(u8x8_memory.display_info.tile_width, u8x8_memory.display_info.tile_height, out);
+  u8x8_capture_write_pbm_buffer(u8x8_memory.ram, u8x8_memory.display_info.tile_width, u8x8_memory.display_info.tile_height, u8x8_capture_get_pixel_1, out);
+}
+
+uint8_t u8x8_d_memory(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+  uint8_t x, y, c, n;
+  uint8_t *ptr;
+  uint8_t *dest;
+  
+  switch(msg)
+  {
+    case U8X8_MSG_DISPLAY_SETUP_MEMORY:
+      u8x8_d_helper_display_setup_memory(u8x8, &u8x8_memory.display_info);
+      break;
+    case U8X8_MSG_DISPLAY_INIT:
+      u8x8_d_helper_display_init(u8x8);
+      memset(u8x8_memory.ram, 0, (size_t)u8x8_memory.display_info.tile_width*u8x8_memory.display_info.tile_height*8);
+      break;
+    case U8X8_MSG_DISPLAY_SET_POWER_SAVE:
+      u8x8_cad_StartTransfer(u8x8);
+      u8x8_cad_SendCmd(u8x8, arg_int == 0 ? 0x0af : 0x0ae );
+      u8x8_cad_EndTransfer(u8x8);
+      break;
+    case U8X8_MSG_DISPLAY_SET_FLIP_MODE:	/* accepted, but the RAM content is not flipped */
+      u8x8_cad_StartTransfer(u8x8);
+      u8x8_cad_SendCmd(u8x8, arg_int == 0 ? 0x0a1 : 0x0a0 );
+      u8x8_cad_SendCmd(u8x8, arg_int == 0 ? 0x0c8 : 0x0c0 );
+      u8x8_cad_EndTransfer(u8x8);
+      break;
+#ifdef U8X8_WITH_SET_CONTRAST
+    case U8X8_MSG_DISPLAY_SET_CONTRAST:
+      u8x8_cad_StartTransfer(u8x8);
+      u8x8_cad_SendCmd(u8x8, 0x081 );
+      u8x8_cad_SendArg(u8x8, arg_int );
+      u8x8_cad_EndTransfer(u8x8);
+      break;
+#endif
+    case U8X8_MSG_DISPLAY_DRAW_TILE:
+      x = ((u8x8_tile_t *)arg_ptr)->x_pos;
+      y = ((u8x8_tile_t *)arg_ptr)->y_pos;
+      u8x8_cad_StartTransfer(u8x8);
+      u8x8_cad_SendCmd(u8x8, 0x0b0 | (y & 15));		/* page */
+      u8x8_cad_SendCmd(u8x8, 0x010 | ((x >> 1) & 15));	/* column x*8, upper nibble */
+      u8x8_cad_SendCmd(u8x8, 0x000 | ((x & 1) << 3));	/* column x*8, lower nibble */
+      do
+      {
+	c = ((u8x8_tile_t *)arg_ptr)->cnt;
+	ptr = ((u8x8_tile_t *)arg_ptr)->tile_ptr;
+	while( c > 0 )
+	{
+	  n = c > 31 ? 31 : c;	/* SendData can not handle more than 255 bytes */
+	  if ( x < u8x8_memory.display_info.tile_width && y < u8x8_memory.display_info.tile_height )
+	  {
+	    dest = u8x8_memory.ram;
+	    dest += ((size_t)y*u8x8_memory.display_info.tile_width + x)*8;
+	    memcpy(dest, ptr, (size_t)(x + n > u8x8_memory.display_info.tile_width ? u8x8_memory.display_info.tile_width - x : n)*8);
+	  }
+	  u8x8_cad_SendData(u8x8, n*8, ptr);
+	  ptr += n*8;
+	  x += n;
+	  c -= n;
+	}
+	arg_int--;
+      } while( arg_int > 0 );
+      u8x8_cad_EndTransfer(u8x8);
+      break;
+    case U8X8_MSG_DISPLAY_REFRESH:
+      u8x8_memory.frame_cnt++;
+      if ( u8x8_memory.frame_cb != NULL )
+	u8x8_memory.frame_cb(u8x8);
+      break;
+    default:
+      return 0;
+  }
+  return 1;
+}
+
+/* byte callback for the memory display, counts the bytes sent */
+uint8_t u8x8_byte_memory(U8X8_UNUSED u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, U8X8_UNUSED void *arg_ptr)
+{
+  switch(msg)
+  {
+    case U8X8_MSG_BYTE_SEND:
+      if ( u8x8_memory.dc == 0 )
+	u8x8_memory.cmd_bytes += arg_int;
+      else
+	u8x8_memory.data_bytes += arg_int;
+      break;
+    case U8X8_MSG_BYTE_SET_DC:
+      u8x8_memory.dc = arg_int;
+      break;
+    case U8X8_MSG_BYTE_START_TRANSFER:
+      u8x8_memory.transfer_cnt++;
+      break;
+    case U8X8_MSG_BYTE_INIT:
+    case U8X8_MSG_BYTE_END_TRANSFER:
+      break;
+    default:
+      return 0;
+  }
+  return 1;
+}
+
+void u8x8_Setup_memory(u8x8_t *u8x8, uint8_t tile_width, uint8_t tile_height, uint8_t *ram, u8x8_msg_cb gpio_and_delay_cb)
+{
+  u8x8_memory_Init(tile_width, tile_height, ram);
+  u8x8_Setup(u8x8, u8x8_d_memory, u8x8_cad_001, u8x8_byte_memory, gpio_and_delay_cb);
+}
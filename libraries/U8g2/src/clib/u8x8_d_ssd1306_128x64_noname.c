@@ -294,13 +294,19 @@ static uint8_t u8x8_d_ssd1306_sh1106_generic(u8x8_t *u8x8, uint8_t msg, uint8_t
       u8x8_cad_EndTransfer(u8x8);
       break;
 #endif
+    case U8X8_MSG_DISPLAY_SET_START_LINE:
+      u8x8->start_line = arg_int & 63;
+      u8x8_cad_StartTransfer(u8x8);
+      u8x8_cad_SendCmd(u8x8, 0x040 | u8x8->start_line );
+      u8x8_cad_EndTransfer(u8x8);
+      break;
     case U8X8_MSG_DISPLAY_DRAW_TILE:
       u8x8_cad_StartTransfer(u8x8);
       x = ((u8x8_tile_t *)arg_ptr)->x_pos;    
       x *= 8;
       x += u8x8->x_offset;
     
-      u8x8_cad_SendCmd(u8x8, 0x040 );	/* set line offset to 0 */
+      u8x8_cad_SendCmd(u8x8, 0x040 | u8x8->start_line );	/* set line offset, 0 unless changed by U8X8_MSG_DISPLAY_SET_START_LINE */
     
       u8x8_cad_SendCmd(u8x8, 0x010 | (x>>4) );
       u8x8_cad_SendArg(u8x8, 0x000 | ((x&15)));					/* probably wrong, should be SendCmd */
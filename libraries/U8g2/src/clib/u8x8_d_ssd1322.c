@@ -92,55 +92,18 @@ static uint8_t u8x8_ssd1322_to32_dest_buf[32];
 
 static uint8_t *u8x8_ssd1322_8to32(U8X8_UNUSED u8x8_t *u8x8, uint8_t *ptr)
 {
-  uint8_t v;
-  uint8_t a,b;
-  uint8_t i, j;
-  uint8_t *dest;
-  
-  for( j = 0; j < 4; j++ )
-  {
-    dest = u8x8_ssd1322_to32_dest_buf;
-    dest += j;
-    a =*ptr;
-    ptr++;
-    b = *ptr;
-    ptr++;
-    for( i = 0; i < 8; i++ )
-    {
-      v = 0;
-      if ( a&1 ) v |= 0xf0;
-      if ( b&1 ) v |= 0x0f;
-      *dest = v;
-      dest+=4;
-      a >>= 1;
-      b >>= 1;
-    }
-  }
-  
-  return u8x8_ssd1322_to32_dest_buf;
+  return u8x8_ConvertTileTo4bpp(u8x8_ssd1322_to32_dest_buf, ptr, 4, 4);
 }
 
 static uint8_t *u8x8_ssd1322_4to32(U8X8_UNUSED u8x8_t *u8x8, uint8_t *ptr)
 {
-  uint8_t v;
-  uint8_t a;
-  uint8_t i, j;
-  uint8_t *dest;
+  uint8_t j;
   
+  /* each column is doubled */
   for( j = 0; j < 4; j++ )
   {
-    dest = u8x8_ssd1322_to32_dest_buf;
-    dest += j;
-    a =*ptr;
+    u8x8_ConvertColumnPairTo4bpp(u8x8_ssd1322_to32_dest_buf+j, *ptr, *ptr, 4);
     ptr++;
-    for( i = 0; i < 8; i++ )
-    {
-      v = 0;
-      if ( a&1 ) v = 0xff;
-      *dest = v;
-      dest+=4;
-      a >>= 1;
-    }
   }
   
   return u8x8_ssd1322_to32_dest_buf;
@@ -215,6 +178,26 @@ uint8_t u8x8_d_ssd1322_common(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *
 	arg_int--;
       } while( arg_int > 0 );
       
+      u8x8_cad_EndTransfer(u8x8);
+      break;
+    case U8X8_MSG_DISPLAY_DRAW_GRAY4:
+      u8x8_cad_StartTransfer(u8x8);
+      x = ((u8x8_tile_t *)arg_ptr)->x_pos;    
+      x *= 2;		// only every 4th col can be addressed
+      x += u8x8->x_offset;
+      c = ((u8x8_tile_t *)arg_ptr)->cnt;
+    
+      y = (((u8x8_tile_t *)arg_ptr)->y_pos);
+      y *= 8;
+
+      u8x8_cad_SendCmd(u8x8, 0x075 );	/* set row address */
+      u8x8_cad_SendArg(u8x8, y);
+      u8x8_cad_SendArg(u8x8, y+7);
+      u8x8_cad_SendCmd(u8x8, 0x015 );	/* set column address for all tiles */
+      u8x8_cad_SendArg(u8x8, x );	/* start */
+      u8x8_cad_SendArg(u8x8, x+2*c-1 );	/* end */
+      u8x8_cad_SendCmd(u8x8, 0x05c );	/* write to ram */
+      u8x8_SendGray4Rows(u8x8, ((u8x8_tile_t *)arg_ptr)->tile_ptr, c);
       u8x8_cad_EndTransfer(u8x8);
       break;
     default:
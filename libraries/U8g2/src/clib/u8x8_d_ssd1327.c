@@ -96,32 +96,7 @@ static uint8_t u8x8_ssd1327_8to32_dest_buf[32];
 
 static uint8_t *u8x8_ssd1327_8to32(U8X8_UNUSED u8x8_t *u8x8, uint8_t *ptr)
 {
-  uint8_t v;
-  uint8_t a,b;
-  uint8_t i, j;
-  uint8_t *dest;
-  
-  for( j = 0; j < 4; j++ )
-  {
-    dest = u8x8_ssd1327_8to32_dest_buf;
-    dest += j;
-    a =*ptr;
-    ptr++;
-    b = *ptr;
-    ptr++;
-    for( i = 0; i < 8; i++ )
-    {
-      v = 0;
-      if ( a&1 ) v |= 0xf0;
-      if ( b&1 ) v |= 0x0f;
-      *dest = v;
-      dest+=4;
-      a >>= 1;
-      b >>= 1;
-    }
-  }
-  
-  return u8x8_ssd1327_8to32_dest_buf;
+  return u8x8_ConvertTileTo4bpp(u8x8_ssd1327_8to32_dest_buf, ptr, 4, 4);
 }
 
 
@@ -194,6 +169,25 @@ static uint8_t u8x8_d_ssd1327_96x96_generic(u8x8_t *u8x8, uint8_t msg, uint8_t a
 	arg_int--;
       } while( arg_int > 0 );
       
+      u8x8_cad_EndTransfer(u8x8);
+      break;
+    case U8X8_MSG_DISPLAY_DRAW_GRAY4:
+      u8x8_cad_StartTransfer(u8x8);
+      x = ((u8x8_tile_t *)arg_ptr)->x_pos;    
+      x *= 4;
+      x+=u8x8->x_offset/2;
+      c = ((u8x8_tile_t *)arg_ptr)->cnt;
+    
+      y = (((u8x8_tile_t *)arg_ptr)->y_pos);
+      y *= 8;
+
+      u8x8_cad_SendCmd(u8x8, 0x075 );	/* set row address */
+      u8x8_cad_SendArg(u8x8, y);
+      u8x8_cad_SendArg(u8x8, y+7);
+      u8x8_cad_SendCmd(u8x8, 0x015 );	/* set column address for all tiles */
+      u8x8_cad_SendArg(u8x8, x );	/* start */
+      u8x8_cad_SendArg(u8x8, x+4*c-1 );	/* end */
+      u8x8_SendGray4Rows(u8x8, ((u8x8_tile_t *)arg_ptr)->tile_ptr, c);
       u8x8_cad_EndTransfer(u8x8);
       break;
     default:
@@ -77,7 +77,6 @@ static uint8_t u8x8_ssd1363_to32_dest_buf[32];
 
 static uint8_t *u8x8_ssd1363_8to32(U8X8_UNUSED u8x8_t *u8x8, uint8_t *ptr)
 {
-  uint8_t a;
   uint8_t i;
   uint8_t *dest;
 
@@ -90,36 +89,39 @@ static uint8_t *u8x8_ssd1363_8to32(U8X8_UNUSED u8x8_t *u8x8, uint8_t *ptr)
     return u8x8_ssd1363_to32_dest_buf;
   }
   
-  a = 1;
+  /* the SSD1363 expects the right pixel of a pair in the high nibble and swapped pairs */
+  u8x8_ConvertColumnPairTo4bpp(dest+1, ptr[1], ptr[0], 4);
+  u8x8_ConvertColumnPairTo4bpp(dest+0, ptr[3], ptr[2], 4);
+  u8x8_ConvertColumnPairTo4bpp(dest+3, ptr[5], ptr[4], 4);
+  u8x8_ConvertColumnPairTo4bpp(dest+2, ptr[7], ptr[6], 4);
+  
+  return u8x8_ssd1363_to32_dest_buf;
+}
+
+/*
+  input:
+    8 rows of one 4 bit tile (4 Bytes per row), see U8X8_MSG_DISPLAY_DRAW_GRAY4
+  output:
+    Tile for SSD1363 (32 Bytes), nibbles and pixel pairs are swapped
+*/
+static uint8_t *u8x8_ssd1363_gray4to32(u8x8_t *u8x8, uint8_t *ptr)
+{
+  uint16_t stride;
+  uint8_t i;
+  uint8_t *dest;
+
+  stride = u8x8->display_info->tile_width;
+  stride *= 4;
+  dest = u8x8_ssd1363_to32_dest_buf;
   for( i = 0; i < 8; i++ )
   {
-    dest[0] = 0;
-    dest[1] = 0;
-    dest[2] = 0;
-    dest[3] = 0;
-    if ( ptr[0] & a )
-      dest[1] |= 0x0f;
-    if ( ptr[1] & a )
-      dest[1] |= 0xf0;
-    if ( ptr[2] & a )
-      dest[0] |= 0x0f;
-    if ( ptr[3] & a )
-      dest[0] |= 0xf0;
-
-    if ( ptr[4] & a )
-      dest[3] |= 0x0f;
-    if ( ptr[5] & a )
-      dest[3] |= 0xf0;
-    if ( ptr[6] & a )
-      dest[2] |= 0x0f;
-    if ( ptr[7] & a )
-      dest[2] |= 0xf0;
-    
-    a <<= 1;
+    dest[0] = (ptr[1] << 4) | (ptr[1] >> 4);
+    dest[1] = (ptr[0] << 4) | (ptr[0] >> 4);
+    dest[2] = (ptr[3] << 4) | (ptr[3] >> 4);
+    dest[3] = (ptr[2] << 4) | (ptr[2] >> 4);
     dest += 4;
-  }  
-
-    
+    ptr += stride;
+  }
   return u8x8_ssd1363_to32_dest_buf;
 }
 
@@ -192,6 +194,37 @@ uint8_t u8x8_d_ssd1363_common(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *
 	arg_int--;
       } while( arg_int > 0 );
       
+      u8x8_cad_EndTransfer(u8x8);
+      break;
+    case U8X8_MSG_DISPLAY_DRAW_GRAY4:
+      u8x8_cad_StartTransfer(u8x8);
+      x = ((u8x8_tile_t *)arg_ptr)->x_pos;    
+      x *= 2;		// only every 4th col can be addressed
+      x += u8x8->x_offset;
+      c = ((u8x8_tile_t *)arg_ptr)->cnt;
+    
+      y = (((u8x8_tile_t *)arg_ptr)->y_pos);
+      y *= 8;
+
+      u8x8_cad_SendCmd(u8x8, 0x075 );	/* set row address */
+      u8x8_cad_SendArg(u8x8, y);
+      u8x8_cad_SendArg(u8x8, y+7);
+      ptr = ((u8x8_tile_t *)arg_ptr)->tile_ptr;
+      do
+      {
+	u8x8_cad_SendCmd(u8x8, 0x015 );	/* set column address */
+	u8x8_cad_SendArg(u8x8, x );	/* start */
+	u8x8_cad_SendArg(u8x8, x+1 );	/* end */
+
+	u8x8_cad_SendCmd(u8x8, 0x05c );	/* write to ram */
+	
+	u8x8_cad_SendData(u8x8, 32, u8x8_ssd1363_gray4to32(u8x8, ptr));
+	
+	ptr += 4;
+	x += 2;
+	c--;
+      } while( c > 0 );
+      
       u8x8_cad_EndTransfer(u8x8);
       break;
     default:
@@ -89,6 +89,21 @@ uint8_t u8x8_DrawTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *
   return u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_DRAW_TILE, 1, (void *)&tile);
 }
 
+uint8_t u8x8_DrawGray4Tile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr)
+{
+  u8x8_tile_t tile;
+  tile.x_pos = x;
+  tile.y_pos = y;
+  tile.cnt = cnt;
+  tile.tile_ptr = tile_ptr;
+  return u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_DRAW_GRAY4, 1, (void *)&tile);
+}
+
+uint8_t u8x8_SetStartLine(u8x8_t *u8x8, uint8_t line)
+{
+  return u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_SET_START_LINE, line, NULL);
+}
+
 /* should be implemented as macro */
 void u8x8_SetupMemory(u8x8_t *u8x8)
 {
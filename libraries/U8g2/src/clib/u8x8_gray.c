@@ -0,0 +1,108 @@
+/*
+
+  u8x8_gray.c
+
+  helper procedures for 4 bit (16 level) gray scale controllers (SSD1322, SSD1325, SSD1327, SSD1362, ...)
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Distributed under the 2-clause BSD license of U8g2, see LICENSE.
+
+*/
+
+#include "u8x8.h"
+
+/*
+  Monochrome tiles are expanded to 4 bit per pixel with a lookup table.
+
+  Two neighbour columns a (left) and b (right) of a tile form one byte in each of
+  the 8 output rows: 0xf0 for a set bit in a, 0x0f for a set bit in b.
+  The lower four bits of a and b (rows 0..3) are combined into the table index
+  (a & 0x0f) | (b << 4). The table entry contains the four output bytes for these rows.
+  Rows 4..7 use the index (a >> 4) | (b & 0xf0) in the same way.
+
+  This replaces the bit by bit loop of the 8to32 procedures,
+  only two table lookups are required for each column pair.
+*/
+
+#define U8X8_GRAY_NIBBLE(k, r) ((((k)>>(r))&1 ? 0xf0 : 0) | (((k)>>((r)+4))&1 ? 0x0f : 0))
+#define U8X8_GRAY_ENTRY(k) U8X8_GRAY_NIBBLE(k,0), U8X8_GRAY_NIBBLE(k,1), U8X8_GRAY_NIBBLE(k,2), U8X8_GRAY_NIBBLE(k,3)
+#define U8X8_GRAY_ENTRY4(k) U8X8_GRAY_ENTRY(k), U8X8_GRAY_ENTRY((k)+1), U8X8_GRAY_ENTRY((k)+2), U8X8_GRAY_ENTRY((k)+3)
+#define U8X8_GRAY_ENTRY16(k) U8X8_GRAY_ENTRY4(k), U8X8_GRAY_ENTRY4((k)+4), U8X8_GRAY_ENTRY4((k)+8), U8X8_GRAY_ENTRY4((k)+12)
+#define U8X8_GRAY_ENTRY64(k) U8X8_GRAY_ENTRY16(k), U8X8_GRAY_ENTRY16((k)+16), U8X8_GRAY_ENTRY16((k)+32), U8X8_GRAY_ENTRY16((k)+48)
+
+static const uint8_t u8x8_gray_nibble_lut[256*4] U8X8_PROGMEM =
+{
+  U8X8_GRAY_ENTRY64(0), U8X8_GRAY_ENTRY64(64), U8X8_GRAY_ENTRY64(128), U8X8_GRAY_ENTRY64(192)
+};
+
+/*
+  expand the column pair a (left pixel, high nibble) and b (right pixel, low nibble)
+  into 8 bytes, which are written to dest, dest+stride, dest+2*stride, ...
+  The lowest bit of a and b is written to dest.
+*/
+void u8x8_ConvertColumnPairTo4bpp(uint8_t *dest, uint8_t a, uint8_t b, uint8_t stride)
+{
+  const uint8_t *lut;
+  uint8_t i;
+
+  lut = u8x8_gray_nibble_lut;
+  lut += (uint16_t)((uint8_t)((a & 0x0f) | (b << 4)))*4;
+  for( i = 0; i < 4; i++ )
+  {
+    *dest = u8x8_pgm_read(lut);
+    lut++;
+    dest += stride;
+  }
+
+  lut = u8x8_gray_nibble_lut;
+  lut += (uint16_t)((uint8_t)((a >> 4) | (b & 0xf0)))*4;
+  for( i = 0; i < 4; i++ )
+  {
+    *dest = u8x8_pgm_read(lut);
+    lut++;
+    dest += stride;
+  }
+}
+
+/*
+  input:
+    one tile (8 Bytes), only the first 2*pair_cnt columns are used
+  output:
+    8 rows with pair_cnt bytes each, rows are stride bytes apart
+    pair_cnt = 4, stride = 4: 32 byte tile for SSD1322, SSD1325, SSD1327, SSD1362
+    pair_cnt = 3, stride = 3: 24 byte tile (six columns)
+  returns dest
+*/
+uint8_t *u8x8_ConvertTileTo4bpp(uint8_t *dest, const uint8_t *tile, uint8_t pair_cnt, uint8_t stride)
+{
+  uint8_t j;
+  for( j = 0; j < pair_cnt; j++ )
+  {
+    u8x8_ConvertColumnPairTo4bpp(dest+j, tile[0], tile[1], stride);
+    tile += 2;
+  }
+  return dest;
+}
+
+/*
+  Send the 8 pixel rows of a U8X8_MSG_DISPLAY_DRAW_GRAY4 message to the display RAM.
+  The caller must set the address window of the controller to cnt tiles.
+  Each row has cnt*4 bytes, rows are tile_width*4 bytes apart in the source buffer.
+  cnt must not exceed 63.
+*/
+void u8x8_SendGray4Rows(u8x8_t *u8x8, uint8_t *ptr, uint8_t cnt)
+{
+  uint16_t stride;
+  uint8_t i;
+
+  stride = u8x8->display_info->tile_width;
+  stride *= 4;
+  cnt *= 4;
+  for( i = 0; i < 8; i++ )
+  {
+    u8x8_cad_SendData(u8x8, cnt, ptr);
+    ptr += stride;
+  }
+}
+
@@ -100,6 +100,7 @@ void u8x8_SetupDefaults(u8x8_t *u8x8)
     u8x8->byte_cb = u8x8_dummy_cb;
     u8x8->gpio_and_delay_cb = u8x8_dummy_cb;
     u8x8->is_font_inverse_mode = 0;
+    u8x8->start_line = 0;
     //u8x8->device_address = 0;
     u8x8->utf8_state = 0;		/* also reset by u8x8_utf8_init */
     u8x8->bus_clock = 0;		/* issue 769 */